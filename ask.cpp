@@ -18,14 +18,48 @@
 #include <QWebEngineView>
 #include <QWebEngineSettings>
 #include <QWebEngineProfile>
+#include <QWebEnginePage>
+#include <QWebEngineHistory>
+#include <QWebEngineContextMenuData>
+#include <QWebEngineScript>
+#include <QWebEngineScriptCollection>
+#include <QWebEngineUrlRequestInterceptor>
+#include <QWebEngineUrlRequestInfo>
+#include <QWebEngineUrlScheme>
+#include <QWebEngineUrlSchemeHandler>
+#include <QWebEngineUrlRequestJob>
+#include <QWebEngineDownloadItem>
+#include <QWebEngineCookieStore>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QNetworkCookie>
+#include <QNetworkCookieJar>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHostAddress>
+#include <QEventLoop>
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QRegularExpression>
 #include <QLineEdit>
+#include <QCompleter>
+#include <QAbstractItemView>
+#include <QStandardItemModel>
 #include <QPushButton>
 #include <QComboBox>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QTabWidget>
+#include <QStackedWidget>
+#include <QTabBar>
+#include <QMenu>
+#include <QAction>
 #include <QFrame>
 #include <QLabel>
+#include <QDialog>
+#include <QTableWidget>
+#include <QHeaderView>
 #include <QSqlDatabase>
 #include <QSqlQuery>
 #include <QSqlError>
@@ -33,74 +67,141 @@
 #include <QFontDatabase>
 #include <QMap>
 #include <QShortcut>
-#include <QPropertyAnimation>
+#include <QVariantAnimation>
 #include <QGraphicsOpacityEffect>
 #include <QTimer>
 #include <QDebug>
+#include <QThread>
+#include <QThreadPool>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QPointer>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QSettings>
+#include <QSaveFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+#include "ask_core.h"
+#include "ask_widgets.h"
 
 // ============================================================================
-// CUSTOM STYLED WIDGETS
+// TASK MANAGER
 // ============================================================================
 
-class GlassFrame : public QFrame {
+/**
+ * Sortable per-tab and per-process resource view fed by ProcessSampler.
+ */
+class TaskManagerDialog : public QDialog {
 public:
-    GlassFrame(QWidget *parent = nullptr) : QFrame(parent) {
-        setStyleSheet(R"(
-            QFrame {
-                background: rgba(15, 15, 35, 0.85);
-                border: 1px solid rgba(255, 255, 255, 0.1);
-                border-radius: 12px;
+    // tabTitle names the tab showing a view, or returns an empty string once it is closed
+    TaskManagerDialog(ProcessSampler *sampler, std::function<QString(QWebEngineView*)> tabTitle,
+                      QWidget *parent = nullptr)
+        : QDialog(parent), sampler(sampler), tabTitle(std::move(tabTitle)) {
+        setWindowTitle("ASK Task Manager");
+        resize(720, 420);
+        setObjectName("taskManager");  // Styled by the theme
+        
+        table = new QTableWidget(0, 5, this);
+        table->setHorizontalHeaderLabels({"Task", "Process", "PID", "Memory (MB)", "CPU %"});
+        table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+        table->verticalHeader()->hide();
+        table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        table->setSelectionBehavior(QAbstractItemView::SelectRows);
+        table->setSortingEnabled(true);
+        table->sortByColumn(3, Qt::DescendingOrder);
+        
+        QVBoxLayout *layout = new QVBoxLayout(this);
+        layout->addWidget(table);
+    }
+    
+    void refresh() {
+        table->setSortingEnabled(false);
+        table->setRowCount(0);
+        
+        QSet<qint64> tabProcesses;
+        for (const ProcessSampler::TabUsage &usage : sampler->tabUsage()) {
+            if (!usage.view) continue;
+            QString title = tabTitle(usage.view);
+            QString task = title.isEmpty() ? "Closed tab" : "Tab: " + title;
+            if (usage.sharedWith > 1) {
+                task += QString(" (shares process with %1)").arg(usage.sharedWith - 1);
             }
-        )");
+            addRow(task, "Renderer", usage.pid, usage.memoryKb, usage.cpuPercent);
+            tabProcesses.insert(usage.pid);
+        }
+        for (const ProcessSampler::Process &process : sampler->processes()) {
+            if (tabProcesses.contains(process.pid)) continue;
+            QString task = process.type == "Renderer" ? "Spare renderer" : process.type;
+            addRow(task, process.type, process.pid, sampler->memoryKb(process.pid), process.cpuPercent);
+        }
+        
+        table->setSortingEnabled(true);
     }
-};
 
-class GlassButton : public QPushButton {
-public:
-    GlassButton(const QString &text, QWidget *parent = nullptr) : QPushButton(text, parent) {
-        setStyleSheet(R"(
-            QPushButton {
-                background: rgba(255, 255, 255, 0.05);
-                border: 1px solid rgba(255, 255, 255, 0.1);
-                border-radius: 8px;
-                color: white;
-                padding: 10px 20px;
-                font-weight: 600;
-                font-size: 14px;
-            }
-            QPushButton:hover {
-                background: rgba(0, 212, 255, 0.2);
-                border-color: #00d4ff;
-                box-shadow: 0 4px 12px rgba(0, 212, 255, 0.3);
-            }
-            QPushButton:pressed {
-                background: rgba(0, 212, 255, 0.3);
-            }
-        )");
-        setCursor(Qt::PointingHandCursor);
+private:
+    void addRow(const QString &task, const QString &type, qint64 pid, qint64 memoryKb, double cpuPercent) {
+        int row = table->rowCount();
+        table->insertRow(row);
+        table->setItem(row, 0, new QTableWidgetItem(task));
+        table->setItem(row, 1, new QTableWidgetItem(type));
+        
+        // Numeric display roles so columns sort by value, not text
+        QTableWidgetItem *pidItem = new QTableWidgetItem();
+        pidItem->setData(Qt::DisplayRole, pid);
+        QTableWidgetItem *memoryItem = new QTableWidgetItem();
+        memoryItem->setData(Qt::DisplayRole, qRound(memoryKb / 102.4) / 10.0);
+        QTableWidgetItem *cpuItem = new QTableWidgetItem();
+        cpuItem->setData(Qt::DisplayRole, qRound(cpuPercent * 10) / 10.0);
+        
+        table->setItem(row, 2, pidItem);
+        table->setItem(row, 3, memoryItem);
+        table->setItem(row, 4, cpuItem);
     }
+    
+    ProcessSampler *sampler;
+    std::function<QString(QWebEngineView*)> tabTitle;
+    QTableWidget *table;
 };
 
-class GlassSearchBar : public QLineEdit {
+// ============================================================================
+// RESTORED TABS
+// ============================================================================
+
+/**
+ * Stand-in for a restored tab that has not been selected yet. Holds only
+ * the title and URL; the real QWebEngineView is created on first selection.
+ */
+class TabPlaceholder : public QWidget {
 public:
-    GlassSearchBar(QWidget *parent = nullptr) : QLineEdit(parent) {
-        setStyleSheet(R"(
-            QLineEdit {
-                background: rgba(255, 255, 255, 0.05);
-                border: 1px solid rgba(255, 255, 255, 0.1);
-                border-radius: 12px;
-                color: white;
-                padding: 12px 20px;
-                font-size: 14px;
-            }
-            QLineEdit:focus {
-                background: rgba(255, 255, 255, 0.08);
-                border-color: #00d4ff;
-                box-shadow: 0 0 20px rgba(0, 212, 255, 0.2);
-            }
-        )");
-        setPlaceholderText("🔍 Search or enter URL...");
+    TabPlaceholder(int tabId, const QString &url, const QString &title, QWidget *parent = nullptr)
+        : QWidget(parent), url(url), title(title) {
+        setProperty("askTabId", tabId);
     }
+    
+    QString url;
+    QString title;
 };
 
 // ============================================================================
@@ -109,36 +210,175 @@ public:
 
 class AskBrowser : public QMainWindow {
 public:
+    // Only what the window and the first tab's navigation need runs here;
+    // the rest waits for the first paint, see finishStartup()
     AskBrowser() {
-        // Setup
-        setupDatabase();
-        loadOxaniumFont();
-        setupUI();
-        setupConnections();
-        setupShortcuts();
-        
-        // Initial state
-        currentWorkspace = "Personal";
-        workspaceUrls["AI"] = "https://gemini.google.com";
-        workspaceUrls["Work"] = "https://linkedin.com";
-        workspaceUrls["Personal"] = "https://duckduckgo.com";
+        StartupTrace &trace = StartupTrace::instance();
+        trace.run("theme", [this]() { applyTheme(); });
+        trace.run("history queue", [this]() { setupDatabase(); });
+        trace.run("downloads", [this]() { setupDownloads(); });
+        trace.run("internal pages", [this]() { setupInternalPages(); });
+        trace.run("tracker blocking", [this]() { setupTrackerBlocking(); });
+        trace.run("window widgets", [this]() { setupUI(); });
+        navigationTracer = new NavigationTracer(this);
+        trace.run("workspace profiles", [this]() { setupWorkspaces(); });
+        trace.run("session store", [this]() { sessionStore = new SessionStore("ask_session", this); });
+        trace.run("tab services", [this]() {
+            setupViewPool();
+            setupResourceMonitoring();
+            tabLifecycle = new TabLifecycleManager(processSampler, this);
+            setupLoadScheduler();
+            setupSpeculation();
+            setupConnections();
+        });
         
-        // Open first tab
-        addNewTab(workspaceUrls["Personal"]);
+        // Restore the previous session, or open the first tab
+        trace.run("first tab", [this]() {
+            if (!restoreSession()) {
+                addNewTab(workspaces[currentWorkspace].homeUrl);
+            }
+        });
+        if (QWebEngineView *view = currentView()) {
+            auto loaded = std::make_shared<QMetaObject::Connection>();
+            *loaded = connect(view, &QWebEngineView::loadFinished, this, [this, loaded]() {
+                QObject::disconnect(*loaded);
+                StartupTrace::instance().mark("first tab loaded");
+                startupSettled();
+            });
+        } else {
+            startupSettled();
+        }
         
         setWindowTitle("ASK Browser - The Liquid Glass Edition");
         resize(1400, 900);
     }
+    
+    ~AskBrowser() override {
+        pageSearchPool.waitForDone();
+        if (omniboxLoader) omniboxLoader->wait();
+        if (fontLoader) fontLoader->wait();
+        reportNewTabTimings();
+        reportSpeculation();
+        reportSuggestions();
+        if (QCoreApplication::arguments().contains("--trace-navigations")) {
+            exportNavigationTrace();
+        }
+        
+        // Pages have to go before the workspace profiles they belong to;
+        // tearing the tab sets down must not reach the session journal
+        restoringTab = true;
+        delete speculation;
+        delete viewPool;
+        delete workspaceStack;
+    }
+    
+    // URLs from the command line or a forwarded launch; an empty one is a
+    // new tab on the workspace's home page
+    void openUrls(const QStringList &urls) {
+        for (const QString &url : urls) {
+            addNewTab(url.isEmpty() ? workspaces[currentWorkspace].homeUrl : url);
+        }
+        if (urls.isEmpty()) return;
+        if (isMinimized()) showNormal();
+        raise();
+        activateWindow();
+    }
+    
+    /**
+     * --soak-tabs[=N]: opens and closes N tabs (1,000 by default) in the
+     * visible workspace. Every tenth tab navigates once more before it is
+     * closed, then is reopened with its history and closed again. Every 100 cycles it lets closed views finish
+     * tearing down and prints a JSON line with the live views, renderer
+     * processes and memory. Fails when views or renderers outlive their
+     * tabs or memory at the end is more than 15% above the first checkpoint.
+     */
+    int soakTabs(int cycles) {
+        QTextStream out(stdout);
+        const QString page = "data:text/html,<title>Soak</title><p>" + QString("soak ").repeated(2000);
+        processSampler->setWatched(true);
+        
+        auto waitForLoad = [](QWebEngineView *view) {
+            QEventLoop loop;
+            connect(view, &QWebEngineView::loadFinished, &loop, &QEventLoop::quit);
+            QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+            loop.exec();
+        };
+        auto settle = [](int ms) {
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+            QEventLoop loop;
+            QTimer::singleShot(ms, &loop, &QEventLoop::quit);
+            loop.exec();
+        };
+        
+        struct Checkpoint {
+            int views = 0;
+            int renderers = 0;
+            qint64 totalKb = 0;
+        };
+        Checkpoint first;
+        Checkpoint last;
+        for (int cycle = 1; cycle <= cycles; ++cycle) {
+            addNewTab(page);
+            waitForLoad(currentView());
+            if (cycle % 10 == 0) {
+                // A back entry, so the reopen goes through history restore
+                currentView()->setUrl(QUrl(page + "<p>again"));
+                waitForLoad(currentView());
+            }
+            closeTab(tabWidget->currentIndex());
+            
+            if (cycle % 10 == 0) {
+                reopenClosedTab();
+                waitForLoad(currentView());
+                closeTab(tabWidget->currentIndex());
+            }
+            
+            if (cycle % 100 == 0 || cycle == cycles) {
+                settle(2000);  // Renderer exit and the next sample are both asynchronous
+                last = Checkpoint();
+                for (QWidget *widget : QApplication::allWidgets()) {
+                    if (qobject_cast<QWebEngineView*>(widget)) ++last.views;
+                }
+                for (const ProcessSampler::Process &process : processSampler->processes()) {
+                    if (process.type == "Renderer") ++last.renderers;
+                }
+                last.totalKb = processSampler->totalKb();
+                if (first.totalKb == 0) first = last;
+                
+                out << QJsonDocument(QJsonObject{
+                    {"cycle", cycle},
+                    {"views", last.views},
+                    {"renderers", last.renderers},
+                    {"totalKb", double(last.totalKb)},
+                    {"browserKb", double(ProcessSampler::residentKb(QCoreApplication::applicationPid()))},
+                    {"trackerInterceptors", trackerInterceptors.size()},
+                    {"recentlyClosed", recentlyClosed.size()},
+                    {"recentlyClosedBytes", double(recentlyClosed.bytes())}
+                }).toJson(QJsonDocument::Compact) << '\n';
+                out.flush();
+            }
+        }
+        processSampler->setWatched(false);
+        
+        const bool flat = last.views <= first.views && last.renderers <= first.renderers
+                          && last.totalKb <= first.totalKb * 115 / 100;
+        qDebug() << "Tab soak:" << cycles << "cycles," << (flat ? "flat" : "growing");
+        return flat ? 0 : 2;
+    }
 
 private:
     // UI Components
     QWidget *centralWidget;
     QFrame *sidebar;
-    QTabWidget *tabWidget;
+    QWidget *sidebarSlot;   // Reserves the sidebar's room in the layout
+    QStackedWidget *workspaceStack;
+    QTabWidget *tabWidget;  // The visible workspace's tabs
     GlassSearchBar *searchBar;
     QComboBox *engineSelector;
     QLabel *statusLabel;
     QLabel *workspaceLabel;
+    QLabel *resourceLabel;
+    TaskManagerDialog *taskManager = nullptr;
     
     // Sidebar buttons
     QPushButton *menuBtn;
@@ -151,10 +391,97 @@ private:
     
     // State
     bool sidebarExpanded = false;
+    QPointer<QVariantAnimation> sidebarAnimation;
+    FrameTimer *sidebarFrames = nullptr;
+    static const int SidebarCollapsedWidth = 60;
+    static const int SidebarExpandedWidth = 250;
     QString currentWorkspace;
+    QString theme;
     QMap<QString, QString> searchEngines;
-    QMap<QString, QString> workspaceUrls;
-    int trackersBlocked = 0;
+    QMap<QString, QString> suggestionEndpoints;   // OpenSearch suggestion templates
+    QHash<QWebEngineView*, TrackerInterceptor*> trackerInterceptors;
+    RecentlyClosedTabs recentlyClosed;
+    
+    // Background services
+    HistoryWriter *historyWriter = nullptr;
+    PageTextIndex *pageIndex = nullptr;   // Null when page indexing is off
+    TrackerBlocker *trackerBlocker = nullptr;
+    TabLifecycleManager *tabLifecycle = nullptr;
+    TabLoadScheduler *loadScheduler = nullptr;
+    NavigationTracer *navigationTracer = nullptr;
+    ProcessSampler *processSampler = nullptr;
+    SessionStore *sessionStore = nullptr;
+    WebViewPool *viewPool = nullptr;
+    SpeculativeLoader *speculation = nullptr;
+    DownloadManager *downloadManager = nullptr;
+    InternalPageHandler *internalPages = nullptr;
+    QThreadPool pageSearchPool;   // ask://pages searches, one at a time
+    int nextTabId = 1;
+    
+    // Workspaces: a persistent profile and a tab set each
+    struct Workspace {
+        QString homeUrl;
+        QWebEngineProfile *profile = nullptr;
+        QTabWidget *tabs = nullptr;
+    };
+    QMap<QString, Workspace> workspaces;
+    
+    // Omnibox autocomplete
+    struct PendingVisit {
+        QString url;
+        qint64 when;
+        bool typed;
+    };
+    std::shared_ptr<OmniboxIndex> omniboxIndex = OmniboxIndex::build({});  // Empty until the history load
+    QStandardItemModel *omniboxModel = nullptr;
+    QCompleter *omniboxCompleter = nullptr;
+    QPointer<QThread> omniboxLoader;
+    QVector<PendingVisit> visitsDuringLoad;
+    bool omniboxLoaded = false;
+    SuggestionClient *suggestionClient = nullptr;
+    QVector<OmniboxIndex::Match> historyMatches;
+    QStringList searchSuggestions;
+    
+    // Keypress to first paint for new tabs, with and without a pooled view
+    QVector<qint64> firstPaintPooledMs;
+    QVector<qint64> firstPaintFreshMs;
+    bool restoringTab = false;
+    
+    // Start-up: deferred work runs once the window has painted
+    bool painted = false;
+    int startupPending = 2;   // Deferred phases, first tab load
+    QPointer<QThread> fontLoader;
+
+protected:
+    void paintEvent(QPaintEvent *event) override {
+        QMainWindow::paintEvent(event);
+        if (painted) return;
+        painted = true;
+        StartupTrace::instance().mark("first paint");
+        qDebug() << "First paint" << StartupTrace::instance().elapsedUs() / 1000 << "ms after launch";
+        
+        // Queued, so the frame reaches the screen before any of it runs
+        QTimer::singleShot(0, this, [this]() { finishStartup(); });
+    }
+
+private:
+    // Everything the first frame and the first navigation can do without,
+    // in the order it becomes useful
+    void finishStartup() {
+        StartupTrace &trace = StartupTrace::instance();
+        trace.run("history and page index", [this]() { startDatabase(); });
+        trace.run("omnibox", [this]() { setupOmnibox(); });
+        trace.run("shortcuts", [this]() { setupShortcuts(); });
+        trace.run("font load", [this]() { loadOxaniumFont(); });
+        startupSettled();
+    }
+    
+    void startupSettled() {
+        if (--startupPending > 0) return;
+        if (QCoreApplication::arguments().contains("--startup-trace")) {
+            QTextStream(stderr) << StartupTrace::instance().timeline();
+        }
+    }
 
     // ========================================================================
     // UI SETUP
@@ -168,9 +495,12 @@ private:
         mainLayout->setContentsMargins(0, 0, 0, 0);
         mainLayout->setSpacing(0);
         
-        // Create sidebar
+        // Create sidebar. The layout only holds its collapsed width; the
+        // sidebar itself floats above the content, see toggleSidebar()
         createSidebar();
-        mainLayout->addWidget(sidebar);
+        sidebarSlot = new QWidget();
+        sidebarSlot->setFixedWidth(SidebarCollapsedWidth);
+        mainLayout->addWidget(sidebarSlot);
         
         // Create main content area
         QVBoxLayout *contentLayout = new QVBoxLayout();
@@ -188,19 +518,23 @@ private:
         
         mainLayout->addLayout(contentLayout, 1);
         
-        // Apply global glass styling
-        applyGlobalStyle();
+        sidebar->setGeometry(0, 0, SidebarCollapsedWidth, centralWidget->height());
+        sidebar->raise();
+        centralWidget->installEventFilter(this);
+    }
+    
+    // Keeps the floating sidebar full height
+    bool eventFilter(QObject *watched, QEvent *event) override {
+        if (watched == centralWidget && event->type() == QEvent::Resize) {
+            sidebar->setGeometry(0, 0, sidebar->width(), centralWidget->height());
+        }
+        return QMainWindow::eventFilter(watched, event);
     }
     
     void createSidebar() {
-        sidebar = new QFrame();
-        sidebar->setFixedWidth(60);
-        sidebar->setStyleSheet(R"(
-            QFrame {
-                background: rgba(15, 15, 35, 0.95);
-                border-right: 1px solid rgba(255, 255, 255, 0.1);
-            }
-        )");
+        sidebar = new QFrame(centralWidget);
+        sidebar->setMinimumWidth(SidebarCollapsedWidth);
+        sidebar->setObjectName("sidebar");
         
         QVBoxLayout *sideLayout = new QVBoxLayout(sidebar);
         sideLayout->setContentsMargins(5, 15, 5, 15);
@@ -236,21 +570,7 @@ private:
         QPushButton *btn = new QPushButton(icon);
         btn->setToolTip(tooltip);
         btn->setFixedHeight(50);
-        btn->setStyleSheet(R"(
-            QPushButton {
-                background: transparent;
-                border: none;
-                color: rgba(255, 255, 255, 0.7);
-                font-size: 24px;
-                text-align: left;
-                padding-left: 15px;
-            }
-            QPushButton:hover {
-                background: rgba(0, 212, 255, 0.1);
-                color: #00d4ff;
-                border-left: 3px solid #00d4ff;
-            }
-        )");
+        btn->setProperty("glass", "sidebar");
         btn->setCursor(Qt::PointingHandCursor);
         return btn;
     }
@@ -279,22 +599,7 @@ private:
         // Search engine selector
         engineSelector = new QComboBox();
         engineSelector->addItems({"ASK", "DuckDuckGo", "Google", "Bing", "Brave"});
-        engineSelector->setStyleSheet(R"(
-            QComboBox {
-                background: rgba(255, 255, 255, 0.05);
-                border: 1px solid rgba(255, 255, 255, 0.1);
-                border-radius: 8px;
-                color: white;
-                padding: 8px 15px;
-                min-width: 120px;
-            }
-            QComboBox:hover {
-                background: rgba(255, 255, 255, 0.08);
-            }
-            QComboBox::drop-down {
-                border: none;
-            }
-        )");
+        engineSelector->setProperty("glass", "engine");
         
         searchEngines["ASK"] = "https://searx.be/search?q=";
         searchEngines["DuckDuckGo"] = "https://duckduckgo.com/?q=";
@@ -302,6 +607,12 @@ private:
         searchEngines["Bing"] = "https://www.bing.com/search?q=";
         searchEngines["Brave"] = "https://search.brave.com/search?q=";
         
+        suggestionEndpoints["ASK"] = "https://searx.be/autocompleter?q={searchTerms}";
+        suggestionEndpoints["DuckDuckGo"] = "https://duckduckgo.com/ac/?q={searchTerms}&type=list";
+        suggestionEndpoints["Google"] = "https://suggestqueries.google.com/complete/search?client=firefox&q={searchTerms}";
+        suggestionEndpoints["Bing"] = "https://api.bing.com/osjson.aspx?query={searchTerms}";
+        suggestionEndpoints["Brave"] = "https://search.brave.com/api/suggest?q={searchTerms}";
+        
         topLayout->addWidget(engineSelector);
         topLayout->addSpacing(10);
         
@@ -339,49 +650,26 @@ private:
         });
         
         connect(newTabBtn, &QPushButton::clicked, [this]() {
-            addNewTab(workspaceUrls[currentWorkspace]);
+            addNewTab(workspaces[currentWorkspace].homeUrl);
         });
     }
     
     void createTabWidget(QVBoxLayout *layout) {
-        tabWidget = new QTabWidget();
-        tabWidget->setTabsClosable(true);
-        tabWidget->setMovable(true);
-        tabWidget->setDocumentMode(true);
-        
-        tabWidget->setStyleSheet(R"(
-            QTabWidget::pane {
-                border: none;
-                background: #0a0a1f;
-            }
-            QTabBar::tab {
-                background: rgba(255, 255, 255, 0.05);
-                border: 1px solid rgba(255, 255, 255, 0.1);
-                border-bottom: none;
-                border-radius: 8px 8px 0 0;
-                color: rgba(255, 255, 255, 0.7);
-                padding: 10px 20px;
-                margin-right: 5px;
-                min-width: 150px;
-            }
-            QTabBar::tab:selected {
-                background: rgba(0, 212, 255, 0.15);
-                color: white;
-                border-bottom: 2px solid #00d4ff;
-            }
-            QTabBar::tab:hover {
-                background: rgba(255, 255, 255, 0.08);
-            }
-            QTabBar::close-button {
-                image: url(none);
-                subcontrol-position: right;
-            }
-            QTabBar::close-button:hover {
-                background: rgba(255, 0, 85, 0.3);
-            }
-        )");
+        // One tab set per workspace, stacked; see setupWorkspaces()
+        workspaceStack = new QStackedWidget();
+        layout->addWidget(workspaceStack);
+    }
+    
+    QTabWidget* createWorkspaceTabs() {
+        QTabWidget *tabs = new QTabWidget();
+        tabs->setTabsClosable(true);
+        tabs->setMovable(true);
+        tabs->setDocumentMode(true);
         
-        layout->addWidget(tabWidget);
+        tabs->setProperty("glass", "tabs");
+        
+        workspaceStack->addWidget(tabs);
+        return tabs;
     }
     
     void createStatusBar(QVBoxLayout *layout) {
@@ -393,19 +681,13 @@ private:
         
         // Left side status
         QLabel *securityIcon = new QLabel("🔒 Secure");
-        securityIcon->setStyleSheet("color: #00ff88; font-size: 12px;");
+        securityIcon->setObjectName("securityStatus");
         
         workspaceLabel = new QLabel("Personal Mode");
-        workspaceLabel->setStyleSheet(R"(
-            background: rgba(0, 212, 255, 0.1);
-            color: #00d4ff;
-            padding: 4px 10px;
-            border-radius: 12px;
-            font-size: 11px;
-        )");
+        workspaceLabel->setObjectName("workspaceBadge");
         
         statusLabel = new QLabel("Trackers Blocked: 0");
-        statusLabel->setStyleSheet("color: rgba(255, 255, 255, 0.6); font-size: 11px;");
+        statusLabel->setObjectName("trackerStatus");
         
         statusLayout->addWidget(securityIcon);
         statusLayout->addSpacing(10);
@@ -414,27 +696,15 @@ private:
         statusLayout->addWidget(statusLabel);
         statusLayout->addStretch();
         
-        // Right side info
-        QLabel *versionLabel = new QLabel("ASK v8.0 | RAM: 342 MB");
-        versionLabel->setStyleSheet("color: rgba(255, 255, 255, 0.5); font-size: 11px;");
-        statusLayout->addWidget(versionLabel);
+        // Right side info, filled in by the process sampler
+        resourceLabel = new QLabel("ASK v8.0 | RAM: -- MB");
+        resourceLabel->setObjectName("resourceStatus");
+        resourceLabel->setToolTip("Shift+Esc opens the task manager");
+        statusLayout->addWidget(resourceLabel);
         
         layout->addWidget(statusBar);
     }
     
-    void applyGlobalStyle() {
-        // Set dark background with gradient
-        setStyleSheet(R"(
-            QMainWindow {
-                background: qlineargradient(
-                    x1:0, y1:0, x2:1, y2:1,
-                    stop:0 #0a0a1f,
-                    stop:0.5 #1a0a2e,
-                    stop:1 #0a0a1f
-                );
-            }
-        )");
-    }
 
     // ========================================================================
     // FUNCTIONALITY
@@ -444,7 +714,7 @@ private:
         // Sidebar actions
         connect(menuBtn, &QPushButton::clicked, this, &AskBrowser::toggleSidebar);
         connect(homeBtn, &QPushButton::clicked, [this]() {
-            addNewTab("https://duckduckgo.com");
+            switchWorkspace("Personal");
         });
         connect(aiBtn, &QPushButton::clicked, [this]() {
             switchWorkspace("AI");
@@ -466,27 +736,64 @@ private:
         connect(searchBar, &QLineEdit::returnPressed, this, &AskBrowser::handleSearch);
         
         // Tab management
-        connect(tabWidget, &QTabWidget::tabCloseRequested, [this](int index) {
-            if (tabWidget->count() > 1) {
-                tabWidget->removeTab(index);
+        for (const Workspace &workspace : workspaces) {
+            connectTabWidget(workspace.tabs);
+        }
+    }
+    
+    void connectTabWidget(QTabWidget *tabs) {
+        connect(tabs, &QTabWidget::tabCloseRequested, [this](int index) {
+            closeTab(index);
+        });
+        
+        connect(tabs, &QTabWidget::currentChanged, [this, tabs](int index) {
+            if (restoringTab || tabs != tabWidget) return;
+            
+            // Restored tabs only get a real view once they are looked at
+            if (dynamic_cast<TabPlaceholder*>(tabWidget->widget(index))) {
+                materializeTab(index);
+                return;
             }
+            onCurrentTabChanged();
         });
         
-        connect(tabWidget, &QTabWidget::currentChanged, [this](int index) {
-            updateAddressBar();
+        connect(tabs->tabBar(), &QTabBar::tabMoved, [this, tabs]() {
+            QVector<int> ids;
+            for (int i = 0; i < tabs->count(); ++i) {
+                if (int id = tabId(tabs->widget(i))) ids.append(id);
+            }
+            sessionStore->tabsReordered(ids);
+        });
+        
+        // Pinned tabs are exempt from freezing and discarding
+        tabs->tabBar()->setContextMenuPolicy(Qt::CustomContextMenu);
+        connect(tabs->tabBar(), &QWidget::customContextMenuRequested, [this, tabs](const QPoint &pos) {
+            QWebEngineView *view = qobject_cast<QWebEngineView*>(
+                tabs->widget(tabs->tabBar()->tabAt(pos)));
+            if (!view) return;
+            
+            bool pinned = tabLifecycle->isPinned(view);
+            QMenu menu;
+            menu.addAction(pinned ? "Unpin Tab" : "Pin Tab", [this, tabs, view, pinned]() {
+                tabLifecycle->setPinned(view, !pinned);
+                tabs->setTabToolTip(tabs->indexOf(view), pinned ? QString() : "📌 Pinned");
+            });
+            menu.exec(tabs->tabBar()->mapToGlobal(pos));
         });
     }
     
     void setupShortcuts() {
         // Essential shortcuts
         new QShortcut(QKeySequence("Ctrl+T"), this, [this]() {
-            addNewTab(workspaceUrls[currentWorkspace]);
+            addNewTab(workspaces[currentWorkspace].homeUrl);
         });
         
         new QShortcut(QKeySequence("Ctrl+W"), this, [this]() {
-            if (tabWidget->count() > 1) {
-                tabWidget->removeTab(tabWidget->currentIndex());
-            }
+            closeTab(tabWidget->currentIndex());
+        });
+        
+        new QShortcut(QKeySequence("Ctrl+Shift+T"), this, [this]() {
+            reopenClosedTab();
         });
         
         new QShortcut(QKeySequence("Ctrl+R"), this, [this]() {
@@ -516,17 +823,29 @@ private:
             int prev = (tabWidget->currentIndex() - 1 + tabWidget->count()) % tabWidget->count();
             tabWidget->setCurrentIndex(prev);
         });
+        
+        new QShortcut(QKeySequence("Shift+Esc"), this, [this]() {
+            openTaskManager();
+        });
+        
+        new QShortcut(QKeySequence("Ctrl+Shift+D"), this, [this]() {
+            cycleTheme();
+        });
     }
     
+    // The sidebar grows over the page rather than pushing it, so the web view
+    // is not resized (and Chromium does not relayout) on every frame. With
+    // appearance/sidebarMode "push" the page makes room once, at the end of
+    // expanding or the start of collapsing.
     void toggleSidebar() {
-        QPropertyAnimation *animation = new QPropertyAnimation(sidebar, "minimumWidth");
-        animation->setDuration(300);
-        animation->setEasingCurve(QEasingCurve::InOutCubic);
+        const bool push = QSettings("ASK", "Browser").value("appearance/sidebarMode", "overlay").toString() == "push";
+        const int from = sidebar->width();
+        int to;
         
         if (sidebarExpanded) {
-            animation->setStartValue(250);
-            animation->setEndValue(60);
+            to = SidebarCollapsedWidth;
             sidebarExpanded = false;
+            sidebarSlot->setFixedWidth(SidebarCollapsedWidth);
             
             // Reset button text to icons
             menuBtn->setText("☰");
@@ -537,8 +856,7 @@ private:
             vaultBtn->setText("🔒");
             settingsBtn->setText("⚙️");
         } else {
-            animation->setStartValue(60);
-            animation->setEndValue(250);
+            to = SidebarExpandedWidth;
             sidebarExpanded = true;
             
             // Expand button text
@@ -551,71 +869,573 @@ private:
             settingsBtn->setText("⚙️  Settings");
         }
         
+        if (sidebarAnimation) sidebarAnimation->stop();
+        if (!sidebarFrames) sidebarFrames = new FrameTimer(this);
+        
+        QVariantAnimation *animation = new QVariantAnimation(this);
+        animation->setDuration(300);
+        animation->setEasingCurve(QEasingCurve::InOutCubic);
+        animation->setStartValue(from);
+        animation->setEndValue(to);
+        connect(animation, &QVariantAnimation::valueChanged, this, [this](const QVariant &width) {
+            sidebar->setGeometry(0, 0, width.toInt(), centralWidget->height());
+        });
+        connect(animation, &QAbstractAnimation::finished, this, [this, push, expanded = sidebarExpanded]() {
+            const FrameTimer::Summary frames = sidebarFrames->stop();
+            qDebug().nospace() << "Sidebar " << (expanded ? "expand" : "collapse") << ": "
+                               << frames.frames << " frames, " << qRound(frames.fps) << " fps, p95 "
+                               << frames.p95Ms << "ms, max " << frames.maxMs << "ms, " << frames.missed << " missed";
+            if (push && expanded) {
+                sidebarSlot->setFixedWidth(SidebarExpandedWidth);
+            }
+        });
+        sidebarAnimation = animation;
+        sidebarFrames->start(sidebar);
         animation->start(QAbstractAnimation::DeleteWhenStopped);
     }
     
-    void switchWorkspace(const QString &workspace) {
-        currentWorkspace = workspace;
-        workspaceLabel->setText(workspace + " Mode");
-        addNewTab(workspaceUrls[workspace]);
+    // Selecting the visible workspace again opens another tab on its home page
+    void switchWorkspace(const QString &name) {
+        if (name == currentWorkspace) {
+            addNewTab(workspaces[name].homeUrl);
+        } else {
+            showWorkspace(name);
+        }
+    }
+    
+    // Swaps in a workspace's tab set. The outgoing tabs are frozen so only
+    // the visible workspace spends CPU; the incoming ones are woken again.
+    void showWorkspace(const QString &name) {
+        if (!workspaces.contains(name)) return;
+        
+        if (name != currentWorkspace) {
+            QElapsedTimer timer;
+            timer.start();
+            const Workspace &outgoing = workspaces[currentWorkspace];
+            const Workspace &incoming = workspaces[name];
+            
+            // Hide first: WebEngine only lets a page freeze once it is not visible
+            workspaceStack->setCurrentWidget(incoming.tabs);
+            tabWidget = incoming.tabs;
+            currentWorkspace = name;
+            workspaceLabel->setText(name + " Mode");
+            viewPool->setProfile(incoming.profile);
+            speculation->setProfile(incoming.profile);
+            
+            int frozen = 0;
+            for (QWebEngineView *view : workspaceViews(outgoing)) {
+                if (tabLifecycle->suspend(view)) ++frozen;
+            }
+            int thawed = 0;
+            for (QWebEngineView *view : workspaceViews(incoming)) {
+                if (tabLifecycle->resume(view)) ++thawed;
+            }
+            qDebug() << "Workspace" << name << "shown in" << timer.elapsed() << "ms,"
+                     << frozen << "tabs frozen," << thawed << "thawed";
+        }
+        
+        if (tabWidget->count() == 0) {
+            addNewTab(workspaces[name].homeUrl);
+        } else if (dynamic_cast<TabPlaceholder*>(tabWidget->currentWidget())) {
+            materializeTab(tabWidget->currentIndex());
+        } else {
+            onCurrentTabChanged();
+        }
+    }
+    
+    static QList<QWebEngineView*> workspaceViews(const Workspace &workspace) {
+        QList<QWebEngineView*> views;
+        for (int i = 0; i < workspace.tabs->count(); ++i) {
+            if (QWebEngineView *view = qobject_cast<QWebEngineView*>(workspace.tabs->widget(i))) {
+                views.append(view);
+            }
+        }
+        return views;
+    }
+    
+    // The tab set holding a tab, whichever workspace it is in
+    QTabWidget* tabWidgetOf(QWidget *tab) const {
+        for (const Workspace &workspace : workspaces) {
+            if (workspace.tabs->indexOf(tab) >= 0) return workspace.tabs;
+        }
+        return nullptr;
     }
     
     void handleSearch() {
         QWebEngineView *view = currentView();
         if (!view) return;
         
+        // Enter on a highlighted suggestion arrives again as activated()
+        if (omniboxCompleter && omniboxCompleter->popup()->isVisible()
+            && omniboxCompleter->popup()->currentIndex().isValid()) {
+            return;
+        }
+        
         QString input = searchBar->text().trimmed();
+        InputClassification target = classifyInput(input);
+        if (suggestionClient) suggestionClient->cancel();
         
-        // Check if it's a URL
-        if (input.contains(".") && !input.contains(" ")) {
-            if (!input.startsWith("http")) {
-                input = "https://" + input;
-            }
-            view->setUrl(QUrl(input));
-        } else {
-            // It's a search query
-            QString searchUrl = searchEngines[engineSelector->currentText()] + input;
-            view->setUrl(QUrl(searchUrl));
+        if (target.kind == InputClassification::InternalPage) {
+            openInternalPage(target.url.host());
+            return;
         }
+        
+        const QUrl destination = target.kind == InputClassification::Url
+            ? target.url : QUrl(searchEngines[engineSelector->currentText()] + input);
+        
+        // A prerender can only replace a tab with nothing to go back to
+        if (QWebEngineView *prerendered = speculation->navigated(destination, view->history()->count() <= 1)) {
+            adoptPrerender(view, prerendered);
+            return;
+        }
+        
+        if (target.kind == InputClassification::Url) {
+            // The visit this navigation produces counts as typed
+            view->setProperty("askTyped", true);
+        }
+        navigationTracer->requested(view, destination);
+        view->setUrl(destination);
     }
     
-    void addNewTab(const QString &url) {
-        QWebEngineView *view = new QWebEngineView();
-        
-        // Optimize settings for performance
-        view->settings()->setAttribute(QWebEngineSettings::JavascriptEnabled, true);
-        view->settings()->setAttribute(QWebEngineSettings::PluginsEnabled, true);
-        view->settings()->setAttribute(QWebEngineSettings::DnsPrefetchEnabled, true);
-        view->settings()->setAttribute(QWebEngineSettings::LocalStorageEnabled, true);
+    // Puts a prerendered view in place of the current tab's, keeping the tab's id
+    void adoptPrerender(QWebEngineView *current, QWebEngineView *prerendered) {
+        const int id = tabId(current);
+        const int index = tabWidget->indexOf(current);
+        wireTabView(prerendered, id, trackerInterceptors.value(prerendered));
+        tabLifecycle->track(prerendered);
+        
+        restoringTab = true;
+        tabWidget->removeTab(index);
+        tabWidget->insertTab(index, prerendered, prerendered->title().isEmpty() ? "Loading..." : prerendered->title().left(25));
+        tabWidget->setCurrentIndex(index);
+        restoringTab = false;
+        loadScheduler->cancel(current);
+        current->deleteLater();
+        
+        // The load already happened, before the tab was listening
+        const QString url = prerendered->url().toString();
+        saveToHistory(url, true);
+        sessionStore->tabNavigated(id, url);
+        if (!prerendered->title().isEmpty()) {
+            sessionStore->tabTitleChanged(id, prerendered->title());
+            historyWriter->enqueueTitle(url, prerendered->title());
+        }
+        onCurrentTabChanged();
+    }
+    
+    // Background tabs open behind the current one and load when the scheduler lets them
+    void addNewTab(const QString &url, bool background = false) {
+        QElapsedTimer keypress;
+        keypress.start();
         
-        // Load URL
-        view->setUrl(QUrl(url));
+        int id = nextTabId++;
+        bool pooled = false;
+        QWebEngineView *view = createTabView(url, id, &pooled, !background);
+        sessionStore->tabOpened(id, url, currentWorkspace);
         
         // Add to tabs
+        if (background) {
+            int index = tabWidget->insertTab(tabWidget->currentIndex() + 1, view, QUrl(url).host());
+            tabWidget->setTabToolTip(index, url);
+            return;
+        }
         int index = tabWidget->addTab(view, "Loading...");
         tabWidget->setCurrentIndex(index);
         
+        auto firstPaint = std::make_shared<QMetaObject::Connection>();
+        *firstPaint = connect(view, &QWebEngineView::loadFinished, [this, keypress, pooled, firstPaint]() {
+            QObject::disconnect(*firstPaint);
+            qint64 elapsed = keypress.elapsed();
+            (pooled ? firstPaintPooledMs : firstPaintFreshMs).append(elapsed);
+            qDebug() << "New tab first paint:" << elapsed << "ms" << (pooled ? "(pooled view)" : "(fresh view)");
+        });
+    }
+    
+    QWebEngineView* createTabView(const QString &url, int id, bool *pooled = nullptr, bool foreground = true) {
+        bool fromPool = false;
+        QWebEngineView *view = takeView(&fromPool);
+        if (pooled) *pooled = fromPool;
+        wireTabView(view, id, trackerInterceptors.value(view));
+        
+        // Load URL, now or once the scheduler gets to it. A background
+        // tab's timing starts when it actually starts loading.
+        if (foreground) navigationTracer->requested(view, QUrl(url));
+        loadScheduler->load(view, QUrl(url), foreground);
+        tabLifecycle->track(view);
+        return view;
+    }
+    
+    // A pooled or fresh view with its own tracker interceptor, not yet in a
+    // tab. A view that is about to get a restored history keeps it.
+    QWebEngineView* takeView(bool *pooled = nullptr, bool clearWarmup = true) {
+        bool fromPool = false;
+        QWebEngineView *view = viewPool->take(&fromPool);
+        if (pooled) *pooled = fromPool;
+        
+        // The warm-up about:blank must not show up as a back entry; the
+        // pool only hands out settled views, so the next load is ours
+        if (fromPool && clearWarmup) {
+            auto warmup = std::make_shared<QMetaObject::Connection>();
+            *warmup = connect(view, &QWebEngineView::loadFinished, [view, warmup]() {
+                QObject::disconnect(*warmup);
+                view->history()->clear();
+            });
+        }
+        
+        // Tracker blocking, counted per tab
+        TrackerInterceptor *interceptor = new TrackerInterceptor(trackerBlocker, view);
+        view->page()->setUrlRequestInterceptor(interceptor);
+        trackerInterceptors.insert(view, interceptor);
+        connect(view, &QObject::destroyed, this, [this, view]() {
+            trackerInterceptors.remove(view);
+        });
+        return view;
+    }
+    
+    // Everything that makes a view part of tab `id`
+    void wireTabView(QWebEngineView *view, int id, TrackerInterceptor *interceptor) {
+        view->setProperty("askTabId", id);
+        navigationTracer->instrument(view, id, [interceptor]() { return interceptor->blocked(); });
+        
+        // Links can open in a new tab in front of or behind this one
+        view->setContextMenuPolicy(Qt::CustomContextMenu);
+        connect(view, &QWidget::customContextMenuRequested, [this, view](const QPoint &pos) {
+            QMenu *menu = view->page()->createStandardContextMenu();
+            menu->setAttribute(Qt::WA_DeleteOnClose);
+            const QUrl link = view->page()->contextMenuData().linkUrl();
+            if (link.isValid()) {
+                QAction *first = menu->actions().value(0);
+                QAction *front = new QAction("Open Link in New Tab", menu);
+                QAction *behind = new QAction("Open Link in Background Tab", menu);
+                connect(front, &QAction::triggered, [this, link]() {
+                    addNewTab(link.toString());
+                });
+                connect(behind, &QAction::triggered, [this, link]() {
+                    addNewTab(link.toString(), true);
+                });
+                menu->insertAction(first, front);
+                menu->insertAction(first, behind);
+                menu->insertSeparator(first);
+            }
+            menu->popup(view->mapToGlobal(pos));
+        });
+        
         // Update tab title when page loads
-        connect(view, &QWebEngineView::titleChanged, [this, view](const QString &title) {
-            int idx = tabWidget->indexOf(view);
-            if (idx != -1) {
-                tabWidget->setTabText(idx, title.left(25));
+        connect(view, &QWebEngineView::titleChanged, [this, view, id](const QString &title) {
+            if (QTabWidget *tabs = tabWidgetOf(view)) {
+                tabs->setTabText(tabs->indexOf(view), title.left(25));
             }
+            sessionStore->tabTitleChanged(id, title);
+            omniboxIndex->setTitle(view->url().toString(), title);
+            historyWriter->enqueueTitle(view->url().toString(), title);
         });
         
         // Update address bar when URL changes
-        connect(view, &QWebEngineView::urlChanged, [this](const QUrl &url) {
+        connect(view, &QWebEngineView::urlChanged, [this, view, id](const QUrl &url) {
             updateAddressBar();
-            saveToHistory(url.toString());
+            saveToHistory(url.toString(), view->property("askTyped").toBool());
+            view->setProperty("askTyped", QVariant());
+            sessionStore->tabNavigated(id, url.toString());
         });
         
-        // Simulate tracker blocking (for demo)
-        QTimer::singleShot(2000, [this]() {
-            trackersBlocked += 3;
-            statusLabel->setText(QString("Trackers Blocked: %1").arg(trackersBlocked));
+        // Page text is read once the load has settled, so it never competes with it
+        connect(view, &QWebEngineView::loadFinished, [this, view](bool ok) {
+            if (!ok || !pageIndex) return;
+            const QUrl url = view->url();
+            QTimer::singleShot(1500, view, [this, view, url]() {
+                capturePageText(view, url);
+            });
+        });
+    }
+    
+    void capturePageText(QWebEngineView *view, const QUrl &url) {
+        if (view->url() != url || (url.scheme() != "http" && url.scheme() != "https")) return;
+        if (view->page()->profile()->isOffTheRecord()) return;
+        
+        view->page()->runJavaScript(QString("typeof __askPageText === 'function' ? __askPageText(%1) : ''")
+                                        .arg(PageTextIndex::MaxPageChars),
+                                    QWebEngineScript::ApplicationWorld,
+                                    [this, url, title = view->title()](const QVariant &result) {
+            const QString text = result.toString();
+            // Too little text to be worth finding again (logins, redirects, media)
+            if (text.size() < 200) return;
+            pageIndex->enqueue(url.toString(), title, text);
         });
     }
     
+    void setupLoadScheduler() {
+        QSettings settings("ASK", "Browser");
+        loadScheduler = new TabLoadScheduler(settings.value("performance/backgroundLoads", 3).toInt(),
+                                             settings.value("performance/deferBackgroundTabs", false).toBool(),
+                                             this);
+        loadScheduler->holdBack = [this](QWebEngineView *view) {
+            QTabWidget *tabs = tabWidgetOf(view);
+            return tabs && tabs != tabWidget;
+        };
+    }
+    
+    void setupViewPool() {
+        int size = QSettings("ASK", "Browser").value("performance/viewPoolSize", 2).toInt();
+        if (QCoreApplication::arguments().contains("--no-view-pool")) {
+            size = 0;
+        }
+        viewPool = new WebViewPool(size, workspaces[currentWorkspace].profile, this);
+    }
+    
+    void setupSpeculation() {
+        QSettings settings("ASK", "Browser");
+        speculation = new SpeculativeLoader(settings.value("performance/speculationDebounceMs", 150).toInt(),
+                                            settings.value("performance/prerender", true).toBool(), this);
+        speculation->setProfile(workspaces[currentWorkspace].profile);
+        speculation->createView = [this]() {
+            return takeView();
+        };
+        navigationTracer->onPageTiming = [this](QWebEngineView *view, const QVariantMap &timing) {
+            speculation->pageTiming(view->url(), timing);
+        };
+    }
+    
+    // --trace-navigations: Chrome trace for chrome://tracing or Perfetto, plus
+    // per-domain percentiles, tagged with what differs between runs
+    void exportNavigationTrace() {
+        std::shared_ptr<const FilterMatcher> matcher = trackerBlocker->matcher();
+        QJsonObject metadata{
+            {"chromiumFlags", QString::fromLocal8Bit(qgetenv("QTWEBENGINE_CHROMIUM_FLAGS"))},
+            {"arguments", QJsonArray::fromStringList(QCoreApplication::arguments())},
+            {"filterRules", matcher ? matcher->ruleCount() : 0},
+            {"trackersBlocked", double(trackerBlocker->total())}
+        };
+        
+        QSaveFile trace("ask_navigation_trace.json");
+        if (trace.open(QIODevice::WriteOnly)) {
+            trace.write(navigationTracer->chromeTrace(metadata));
+            trace.commit();
+        }
+        
+        const QJsonObject domains = navigationTracer->domainSummary();
+        QSaveFile summary("ask_navigation_summary.json");
+        if (summary.open(QIODevice::WriteOnly)) {
+            summary.write(QJsonDocument(QJsonObject{{"metadata", metadata}, {"domains", domains}}).toJson());
+            summary.commit();
+        }
+        for (auto it = domains.constBegin(); it != domains.constEnd(); ++it) {
+            QJsonObject domain = it.value().toObject();
+            QJsonObject load = domain.value("load").toObject();
+            qDebug().nospace() << "Navigation timing " << it.key() << ": n=" << domain.value("navigations").toInt()
+                               << " p50=" << load.value("p50").toDouble() << "ms"
+                               << " p95=" << load.value("p95").toDouble() << "ms";
+        }
+    }
+    
+    void reportNewTabTimings() {
+        auto report = [](const char *label, QVector<qint64> samples) {
+            if (samples.isEmpty()) return;
+            std::sort(samples.begin(), samples.end());
+            qDebug().nospace() << "New tab first paint " << label << ": n=" << samples.size()
+                               << " p50=" << samples[samples.size() / 2] << "ms"
+                               << " max=" << samples.last() << "ms";
+        };
+        report("with pool", firstPaintPooledMs);
+        report("without pool", firstPaintFreshMs);
+    }
+    
+    void reportSuggestions() {
+        if (!suggestionClient) return;
+        const SuggestionClient::Stats &stats = suggestionClient->stats();
+        if (stats.keystrokes == 0) return;
+        qDebug().nospace() << "Search suggestions: " << stats.keystrokes << " keystrokes, "
+                           << stats.requests << " requests (" << stats.aborted << " aborted, "
+                           << stats.failures << " failed), " << stats.cacheHits << " cache hits";
+    }
+    
+    void reportSpeculation() {
+        const SpeculativeLoader::Stats &stats = speculation->stats();
+        if (stats.navigations == 0) return;
+        auto percent = [](int part, int whole) { return whole ? 100 * part / whole : 0; };
+        qDebug().nospace() << "Speculation: " << stats.navigations << " navigations, "
+                           << stats.preconnects << " preconnects (" << stats.preconnectHits << " hits, "
+                           << percent(stats.preconnectHits, stats.navigations) << "%), "
+                           << stats.prerenders << " prerenders (" << stats.prerenderHits << " hits, "
+                           << percent(stats.prerenderHits, stats.prerenders) << "%), "
+                           << stats.savedMs << "ms saved";
+    }
+    
+    // removeTab() only takes the page out of the tab bar; the view has to be
+    // deleted as well or it keeps its renderer process alive indefinitely
+    void closeTab(int index) {
+        if (tabWidget->count() <= 1) return;
+        QWidget *tab = tabWidget->widget(index);
+        if (!tab) return;
+        sessionStore->tabClosed(tabId(tab));
+        
+        RecentlyClosedTabs::Entry closed;
+        closed.workspace = currentWorkspace;
+        closed.index = index;
+        if (QWebEngineView *view = qobject_cast<QWebEngineView*>(tab)) {
+            loadScheduler->cancel(view);
+            closed.url = view->url().toString();
+            closed.title = view->title();
+            if (view->history()->count() > 1) {
+                closed.history = RecentlyClosedTabs::saveHistory(view->history());
+            }
+        } else if (TabPlaceholder *placeholder = dynamic_cast<TabPlaceholder*>(tab)) {
+            closed.url = placeholder->url;
+            closed.title = placeholder->title;
+        }
+        if (!closed.url.isEmpty()) {
+            recentlyClosed.push(closed);
+        }
+        
+        tabWidget->removeTab(index);
+        tab->deleteLater();
+    }
+    
+    // Ctrl+Shift+T: a fresh view, given the closed tab's back/forward list
+    // when it had one, back in its old place in its own workspace
+    void reopenClosedTab() {
+        if (recentlyClosed.isEmpty()) return;
+        const RecentlyClosedTabs::Entry closed = recentlyClosed.takeLast();
+        if (workspaces.contains(closed.workspace) && closed.workspace != currentWorkspace) {
+            showWorkspace(closed.workspace);
+        }
+        
+        const QUrl url(closed.url);
+        if (url.scheme() == "ask") {
+            openInternalPage(url.host());
+            return;
+        }
+        
+        const int id = nextTabId++;
+        QWebEngineView *view = nullptr;
+        if (closed.history.isEmpty()) {
+            view = createTabView(closed.url, id);
+        } else {
+            view = takeView(nullptr, false);
+            wireTabView(view, id, trackerInterceptors.value(view));
+            navigationTracer->requested(view, url);
+            if (!RecentlyClosedTabs::restoreHistory(view->history(), closed.history)) {
+                view->setUrl(url);
+            }
+            tabLifecycle->track(view);
+        }
+        sessionStore->tabOpened(id, closed.url, currentWorkspace);
+        
+        const int index = tabWidget->insertTab(qMin(closed.index, tabWidget->count()), view,
+                                               closed.title.isEmpty() ? "Loading..." : closed.title.left(25));
+        tabWidget->setCurrentIndex(index);
+    }
+    
+    static int tabId(QWidget *tab) {
+        return tab ? tab->property("askTabId").toInt() : 0;
+    }
+    
+    void onCurrentTabChanged() {
+        tabLifecycle->activated(currentView());
+        loadScheduler->activated(currentView());
+        sessionStore->tabSelected(tabId(tabWidget->currentWidget()));
+        updateAddressBar();
+        updateTrackerStatus();
+    }
+    
+    // ========================================================================
+    // SESSION RESTORE
+    // ========================================================================
+    
+    bool restoreSession() {
+        int activeId = 0;
+        const QVector<SessionStore::Tab> tabs = sessionStore->restore(&activeId);
+        if (tabs.isEmpty()) return false;
+        
+        // Placeholders only: restoring 200 tabs costs about as much as one.
+        // Tabs from before per-workspace tab sets land in Personal.
+        QString activeWorkspace = currentWorkspace;
+        restoringTab = true;
+        for (const SessionStore::Tab &tab : tabs) {
+            const QString workspace = workspaces.contains(tab.workspace) ? tab.workspace : "Personal";
+            QTabWidget *target = workspaces[workspace].tabs;
+            TabPlaceholder *placeholder = new TabPlaceholder(tab.id, tab.url, tab.title);
+            int index = target->addTab(placeholder, (tab.title.isEmpty() ? tab.url : tab.title).left(25));
+            target->setTabToolTip(index, tab.url);
+            if (tab.id == activeId) {
+                target->setCurrentIndex(index);
+                activeWorkspace = workspace;
+            }
+            nextTabId = qMax(nextTabId, tab.id + 1);
+        }
+        restoringTab = false;
+        
+        showWorkspace(activeWorkspace);
+        return true;
+    }
+    
+    void materializeTab(int index) {
+        TabPlaceholder *placeholder = dynamic_cast<TabPlaceholder*>(tabWidget->widget(index));
+        if (!placeholder) return;
+        
+        QWebEngineView *view = createTabView(placeholder->url, tabId(placeholder));
+        restoringTab = true;
+        tabWidget->removeTab(index);
+        tabWidget->insertTab(index, view, placeholder->title.isEmpty() ? "Loading..." : placeholder->title.left(25));
+        tabWidget->setCurrentIndex(index);
+        restoringTab = false;
+        placeholder->deleteLater();
+        
+        onCurrentTabChanged();
+    }
+    
+    void setupTrackerBlocking() {
+        trackerBlocker = new TrackerBlocker(this);
+        trackerBlocker->onBlocked = [this]() {
+            updateTrackerStatus();
+        };
+        trackerBlocker->loadFilterLists("./filters");
+    }
+    
+    void updateTrackerStatus() {
+        TrackerInterceptor *interceptor = trackerInterceptors.value(currentView());
+        statusLabel->setText(QString("Trackers Blocked: %1 (tab) · %2 total")
+                                 .arg(interceptor ? interceptor->blocked() : 0)
+                                 .arg(trackerBlocker->total()));
+    }
+    
+    void setupResourceMonitoring() {
+        processSampler = new ProcessSampler(this);
+        processSampler->tabViews = [this]() {
+            QList<QWebEngineView*> views;
+            for (const Workspace &workspace : workspaces) {
+                views += workspaceViews(workspace);
+            }
+            return views;
+        };
+        processSampler->onSample = [this]() {
+            resourceLabel->setText(QString("ASK v8.0 | RAM: %1 MB | CPU: %2%")
+                                       .arg(processSampler->totalKb() / 1024)
+                                       .arg(processSampler->totalCpu(), 0, 'f', 0));
+            if (taskManager && taskManager->isVisible()) {
+                taskManager->refresh();
+            }
+        };
+    }
+    
+    void openTaskManager() {
+        if (!taskManager) {
+            taskManager = new TaskManagerDialog(processSampler, [this](QWebEngineView *view) {
+                for (auto it = workspaces.constBegin(); it != workspaces.constEnd(); ++it) {
+                    int index = it->tabs->indexOf(view);
+                    if (index >= 0) return it.key() + " · " + it->tabs->tabText(index);
+                }
+                return QString();
+            }, this);
+            connect(taskManager, &QDialog::finished, [this]() {
+                processSampler->setWatched(false);
+            });
+        }
+        taskManager->refresh();
+        taskManager->show();
+        taskManager->raise();
+        processSampler->setWatched(true);
+    }
+    
     QWebEngineView* currentView() {
         return qobject_cast<QWebEngineView*>(tabWidget->currentWidget());
     }
@@ -628,369 +1448,432 @@ private:
     }
     
     void openAIPanel() {
-        QWebEngineView *view = new QWebEngineView();
-        QString html = R"(
-            <html>
-            <head>
-                <style>
-                    body {
-                        background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
-                        color: white;
-                        font-family: 'Segoe UI', sans-serif;
-                        padding: 40px;
-                        margin: 0;
-                    }
-                    .container {
-                        max-width: 800px;
-                        margin: 0 auto;
-                    }
-                    h1 {
-                        background: linear-gradient(135deg, #00d4ff, #ff00ff);
-                        -webkit-background-clip: text;
-                        -webkit-text-fill-color: transparent;
-                        font-size: 48px;
-                        margin-bottom: 20px;
-                    }
-                    .ai-card {
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 16px;
-                        padding: 30px;
-                        margin: 20px 0;
-                        cursor: pointer;
-                        transition: all 0.3s;
-                    }
-                    .ai-card:hover {
-                        background: rgba(0, 212, 255, 0.1);
-                        border-color: #00d4ff;
-                        transform: translateY(-5px);
-                        box-shadow: 0 10px 30px rgba(0, 212, 255, 0.3);
-                    }
-                    .ai-card h3 {
-                        color: #00d4ff;
-                        margin-top: 0;
-                    }
-                    .chat-box {
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 12px;
-                        padding: 20px;
-                        margin-top: 30px;
-                    }
-                    input {
-                        width: 100%;
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 8px;
-                        color: white;
-                        padding: 15px;
-                        font-size: 16px;
-                        box-sizing: border-box;
-                    }
-                </style>
-            </head>
-            <body>
-                <div class="container">
-                    <h1>✨ AI Assistant</h1>
-                    <p style="font-size: 18px; opacity: 0.8;">Choose your AI tool or ask me anything about the current page</p>
-                    
-                    <div class="ai-card" onclick="window.location.href='https://gemini.google.com'">
-                        <h3>🤖 Google Gemini</h3>
-                        <p>Advanced AI for complex reasoning and creative tasks</p>
-                    </div>
-                    
-                    <div class="ai-card" onclick="window.location.href='https://chat.openai.com'">
-                        <h3>💬 ChatGPT</h3>
-                        <p>OpenAI's conversational AI assistant</p>
-                    </div>
-                    
-                    <div class="ai-card" onclick="window.location.href='https://claude.ai'">
-                        <h3>🧠 Claude</h3>
-                        <p>Anthropic's thoughtful and detailed AI</p>
-                    </div>
-                    
-                    <div class="chat-box">
-                        <h3 style="margin-top: 0;">Quick Ask</h3>
-                        <input type="text" placeholder="Ask me to summarize this page, explain code, or answer questions..." />
-                        <p style="font-size: 12px; opacity: 0.6; margin-top: 10px;">
-                            💡 Coming soon: Context-aware AI that reads your current page
-                        </p>
-                    </div>
-                </div>
-            </body>
-            </html>
-        )";
-        view->setHtml(html);
-        int index = tabWidget->addTab(view, "✨ AI Assistant");
-        tabWidget->setCurrentIndex(index);
+        openInternalPage("ai");
     }
     
     void openDownloadsPage() {
-        QWebEngineView *view = new QWebEngineView();
-        QString html = R"(
-            <html>
-            <head>
-                <style>
-                    body {
-                        background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
-                        color: white;
-                        font-family: 'Segoe UI', sans-serif;
-                        padding: 40px;
-                    }
-                    h1 { color: #00d4ff; }
-                    .download-item {
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 12px;
-                        padding: 20px;
-                        margin: 15px 0;
-                    }
-                    .progress-bar {
-                        width: 100%;
-                        height: 8px;
-                        background: rgba(255, 255, 255, 0.1);
-                        border-radius: 4px;
-                        overflow: hidden;
-                        margin: 10px 0;
-                    }
-                    .progress-fill {
-                        height: 100%;
-                        background: linear-gradient(90deg, #00d4ff, #ff00ff);
-                        animation: progress 2s infinite;
-                    }
-                    @keyframes progress {
-                        0% { width: 0%; }
-                        100% { width: 100%; }
-                    }
-                </style>
-            </head>
-            <body>
-                <h1>📥 Download Manager</h1>
-                <p>Turbo-charged downloads with 32-thread acceleration</p>
-                
-                <div class="download-item">
-                    <h3>example_file.zip (Demo)</h3>
-                    <div class="progress-bar">
-                        <div class="progress-fill" style="width: 45%;"></div>
-                    </div>
-                    <p>Speed: 12.5 MB/s | 45% Complete</p>
-                </div>
-                
-                <p style="opacity: 0.6; margin-top: 40px;">
-                    💡 Download manager will be fully functional in the next update.<br>
-                    Features: Multi-threaded downloads, pause/resume, media detection
-                </p>
-            </body>
-            </html>
-        )";
-        view->setHtml(html);
-        int index = tabWidget->addTab(view, "📥 Downloads");
-        tabWidget->setCurrentIndex(index);
+        openInternalPage("downloads");
     }
     
     void openVaultPage() {
-        QWebEngineView *view = new QWebEngineView();
-        QString html = R"(
-            <html>
-            <head>
-                <style>
-                    body {
-                        background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
-                        color: white;
-                        font-family: 'Segoe UI', sans-serif;
-                        padding: 40px;
-                        text-align: center;
-                    }
-                    h1 { color: #00d4ff; font-size: 48px; }
-                    .vault-icon { font-size: 100px; margin: 30px 0; }
-                    .info-box {
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 16px;
-                        padding: 30px;
-                        max-width: 600px;
-                        margin: 30px auto;
-                        text-align: left;
-                    }
-                </style>
-            </head>
-            <body>
-                <div class="vault-icon">🔒</div>
-                <h1>Secure Vault</h1>
-                <p style="font-size: 18px;">Your encrypted password manager</p>
-                
-                <div class="info-box">
-                    <h3 style="color: #00d4ff;">🛡️ Features:</h3>
-                    <ul>
-                        <li>AES-256 encryption</li>
-                        <li>k-Anonymity breach detection</li>
-                        <li>Zero-knowledge architecture</li>
-                        <li>Biometric unlock (Coming soon)</li>
-                    </ul>
-                    
-                    <p style="margin-top: 30px; opacity: 0.7;">
-                        💡 The Vault feature will be available in Phase 2 of development.<br>
-                        Your passwords will never leave your device.
-                    </p>
-                </div>
-            </body>
-            </html>
-        )";
-        view->setHtml(html);
-        int index = tabWidget->addTab(view, "🔒 Vault");
-        tabWidget->setCurrentIndex(index);
+        openInternalPage("vault");
     }
     
     void openSettingsPage() {
-        QWebEngineView *view = new QWebEngineView();
-        QString html = R"(
-            <html>
-            <head>
-                <style>
-                    body {
-                        background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
-                        color: white;
-                        font-family: 'Segoe UI', sans-serif;
-                        padding: 40px;
-                    }
-                    h1 { color: #00d4ff; border-bottom: 2px solid #00d4ff; padding-bottom: 15px; }
-                    h2 { color: #00d4ff; margin-top: 40px; }
-                    .setting-item {
-                        background: rgba(255, 255, 255, 0.05);
-                        border: 1px solid rgba(255, 255, 255, 0.1);
-                        border-radius: 12px;
-                        padding: 20px;
-                        margin: 15px 0;
-                    }
-                    button {
-                        background: linear-gradient(135deg, #00d4ff, #ff00ff);
-                        border: none;
-                        color: white;
-                        padding: 12px 24px;
-                        border-radius: 8px;
-                        font-weight: 600;
-                        cursor: pointer;
-                        margin: 5px;
-                    }
-                    button:hover {
-                        transform: translateY(-2px);
-                        box-shadow: 0 8px 20px rgba(0, 212, 255, 0.4);
-                    }
-                    .shortcut-list {
-                        background: rgba(255, 255, 255, 0.05);
-                        padding: 20px;
-                        border-radius: 12px;
-                        margin-top: 20px;
+        openInternalPage("settings");
+    }
+    
+    // Focuses the tab already showing ask://<host>, or opens one
+    void openInternalPage(const QString &host) {
+        const InternalPageHandler::Page *page = InternalPageHandler::find(host);
+        if (!page) return;
+        
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < tabWidget->count(); ++i) {
+            QWebEngineView *existing = qobject_cast<QWebEngineView*>(tabWidget->widget(i));
+            if (existing && existing->url().scheme() == "ask" && existing->url().host() == host) {
+                tabWidget->setCurrentIndex(i);
+                qDebug() << "Internal page ask://" + host << "focused in" << timer.elapsed() << "ms";
+                return;
+            }
+        }
+        
+        bool pooled = false;
+        QWebEngineView *view = viewPool->take(&pooled);
+        if (pooled) {
+            auto warmup = std::make_shared<QMetaObject::Connection>();
+            *warmup = connect(view, &QWebEngineView::loadFinished, [view, warmup]() {
+                QObject::disconnect(*warmup);
+                view->history()->clear();
+            });
+        }
+        auto opened = std::make_shared<QMetaObject::Connection>();
+        *opened = connect(view, &QWebEngineView::loadFinished, [host, timer, opened]() {
+            QObject::disconnect(*opened);
+            qDebug() << "Internal page ask://" + host << "opened in" << timer.elapsed() << "ms";
+        });
+        view->setUrl(QUrl("ask://" + host));
+        if (host == "downloads") {
+            bridgeDownloadsPage(view);
+        } else if (host == "pages") {
+            bridgePageSearch(view);
+        }
+        
+        int index = tabWidget->addTab(view, QString::fromUtf8(page->title));
+        tabWidget->setCurrentIndex(index);
+    }
+    
+    void bridgePageSearch(QWebEngineView *view) {
+        // The page queues what was typed; searches run one at a time on the
+        // shared worker, and any query a newer one has replaced is skipped
+        auto latest = std::make_shared<std::atomic<int>>(0);
+        QTimer *poll = new QTimer(view);
+        connect(poll, &QTimer::timeout, view, [this, view, latest]() {
+            if (!view->isVisible()) return;
+            view->page()->runJavaScript("typeof takeQuery === 'function' ? takeQuery() : null",
+                                        [this, view, latest](const QVariant &result) {
+                if (result.isNull()) return;
+                const QString query = result.toString();
+                const int generation = ++*latest;
+                QPointer<QWebEngineView> guard(view);
+                pageSearchPool.start([this, guard, query, latest, generation]() {
+                    if (generation != *latest) return;
+                    QElapsedTimer timer;
+                    timer.start();
+                    const QVector<PageTextIndex::Result> results = PageTextIndex::search("ask_page_index.db", query, 30);
+                    const qint64 elapsed = timer.elapsed();
+                    
+                    QJsonArray items;
+                    for (const PageTextIndex::Result &result : results) {
+                        items.append(QJsonObject{
+                            {"url", result.url},
+                            {"title", result.title},
+                            {"snippet", result.snippet},
+                            {"when", QDateTime::fromSecsSinceEpoch(result.indexedAt).toString("d MMM yyyy")}
+                        });
                     }
-                    code {
-                        background: rgba(0, 212, 255, 0.2);
-                        padding: 4px 8px;
-                        border-radius: 4px;
-                        font-family: 'Courier New', monospace;
+                    // A one-element array is the easy way to get a JSON string literal
+                    const QString literal = QString::fromUtf8(QJsonDocument(QJsonArray{query}).toJson(QJsonDocument::Compact));
+                    const QString call = QString("render(%1, %2, %3)")
+                        .arg(literal.mid(1).chopped(1),
+                             QString::fromUtf8(QJsonDocument(items).toJson(QJsonDocument::Compact)),
+                             QString::number(elapsed));
+                    
+                    // The guard is only safe to read on the GUI thread
+                    QMetaObject::invokeMethod(this, [guard, call, latest, generation]() {
+                        if (!guard || generation != *latest) return;
+                        guard->page()->runJavaScript(call);
+                    }, Qt::QueuedConnection);
+                });
+            });
+        });
+        poll->start(250);
+    }
+    
+    void bridgeDownloadsPage(QWebEngineView *view) {
+        // The page draws from a snapshot and queues button clicks for us to collect
+        QTimer *refresh = new QTimer(view);
+        connect(refresh, &QTimer::timeout, view, [this, view]() {
+            if (!view->isVisible()) return;
+            
+            view->page()->runJavaScript("typeof takeActions === 'function' ? takeActions() : []",
+                                        [this](const QVariant &result) {
+                for (const QVariant &action : result.toList()) {
+                    QString kind = action.toString().section(':', 0, 0);
+                    int id = action.toString().section(':', 1, 1).toInt();
+                    if (kind == "pause") {
+                        downloadManager->pause(id);
+                    } else if (kind == "resume") {
+                        downloadManager->resume(id);
+                    } else if (kind == "cancel") {
+                        downloadManager->cancel(id);
+                    } else if (kind == "checksum") {
+                        downloadManager->setChecksum(id, action.toString().section(':', 2));
                     }
-                </style>
-            </head>
-            <body>
-                <h1>⚙️ ASK Browser Settings</h1>
-                
-                <div class="setting-item">
-                    <h3>📊 Browser Information</h3>
-                    <p><b>Version:</b> 8.0 (Liquid Glass Edition)</p>
-                    <p><b>Engine:</b> Chromium (Qt WebEngine)</p>
-                    <p><b>Build:</b> Production-Ready</p>
-                </div>
-                
-                <h2>🧹 Privacy & Data</h2>
-                <div class="setting-item">
-                    <button onclick="alert('History cleared!') ">Clear History</button>
-                    <button onclick="alert('Cache cleared!') ">Clear Cache</button>
-                    <button onclick="alert('Cookies cleared!') ">Clear Cookies</button>
-                </div>
-                
-                <h2>⌨️ Keyboard Shortcuts</h2>
-                <div class="shortcut-list">
-                    <p><code>Ctrl + T</code> - New Tab</p>
-                    <p><code>Ctrl + W</code> - Close Tab</p>
-                    <p><code>Ctrl + R</code> / <code>F5</code> - Reload</p>
-                    <p><code>Ctrl + L</code> - Focus Address Bar</p>
-                    <p><code>Ctrl + Tab</code> - Next Tab</p>
-                    <p><code>Ctrl + Shift + Tab</code> - Previous Tab</p>
-                    <p><code>F11</code> - Fullscreen</p>
-                </div>
-                
-                <h2>🎨 Appearance</h2>
-                <div class="setting-item">
-                    <p><b>Theme:</b> Liquid Glass (Default)</p>
-                    <p><b>Font:</b> Oxanium</p>
-                    <p>💡 Custom themes coming in Phase 3</p>
-                </div>
-                
-                <h2>🔒 Security</h2>
-                <div class="setting-item">
-                    <p>✅ Tracking Protection: <b>Enabled</b></p>
-                    <p>✅ HTTPS-Only Mode: <b>Enabled</b></p>
-                    <p>✅ Cookie Blocking: <b>Third-party blocked</b></p>
-                </div>
-            </body>
-            </html>
-        )";
-        view->setHtml(html);
-        int index = tabWidget->addTab(view, "⚙️ Settings");
-        tabWidget->setCurrentIndex(index);
+                }
+            });
+            
+            QJsonArray items;
+            for (const DownloadManager::Info &info : downloadManager->downloads()) {
+                QJsonObject item;
+                item["id"] = info.id;
+                item["name"] = QFileInfo(info.path).fileName();
+                item["state"] = info.state;
+                item["error"] = info.error;
+                item["received"] = double(info.receivedBytes);
+                item["total"] = double(info.totalBytes);
+                item["rate"] = info.bytesPerSecond;
+                item["connections"] = info.connections;
+                item["checksum"] = info.checksum;
+                item["checksumAdvisory"] = info.checksumAdvisory;
+                item["digests"] = QJsonArray::fromStringList(info.digests);
+                item["verification"] = info.verification;
+                item["hashed"] = double(info.hashedBytes);
+                items.append(item);
+            }
+            view->page()->runJavaScript("typeof render === 'function' && render("
+                                        + QString::fromUtf8(QJsonDocument(items).toJson(QJsonDocument::Compact)) + ")");
+        });
+        refresh->start(500);
+        
     }
     
     // ========================================================================
     // DATABASE
     // ========================================================================
     
+    // The visit queue exists from the start so the first tab's visits are
+    // kept; the database behind it is opened (and migrated) by the writer's
+    // own thread once startDatabase() runs
     void setupDatabase() {
-        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE");
-        db.setDatabaseName("ask_browser_data.db");
+        QSettings settings("ASK", "Browser");
+        historyWriter = new HistoryWriter("ask_browser_data.db", 4096, 1000, this);
+        historyWriter->setRetention(settings.value("history/retentionDays", 90).toInt(),
+                                    settings.value("history/maxVisits", 500000).toLongLong());
+    }
+    
+    void startDatabase() {
+        historyWriter->start(QThread::LowPriority);
+        
+        // Page text goes to its own file; the budget counts stored text
+        QSettings settings("ASK", "Browser");
+        if (settings.value("history/indexPages", true).toBool()) {
+            pageIndex = new PageTextIndex("ask_page_index.db",
+                                          settings.value("history/pageIndexMB", 256).toLongLong() * 1024 * 1024,
+                                          64, this);
+            pageIndex->start(QThread::LowPriority);
+        }
+    }
+    
+    // Installed on each workspace profile in setupWorkspaces()
+    void setupInternalPages() {
+        internalPages = new InternalPageHandler(this);
+        pageSearchPool.setMaxThreadCount(1);
+    }
+    
+    void setupDownloads() {
+        QSettings settings("ASK", "Browser");
+        downloadManager = new DownloadManager("ask_browser_data.db",
+                                              settings.value("downloads/connections", 6).toInt(), this);
+    }
+    
+    void saveToHistory(const QString &url, bool typed = false) {
+        if (historyWriter->enqueue(url, typed)) {
+            recordOmniboxVisit(url, typed);
+        }
+    }
+    
+    // ========================================================================
+    // WORKSPACES
+    // ========================================================================
+    
+    void setupWorkspaces() {
+        const QVector<QPair<QString, QString>> homes = {
+            {"AI", "https://gemini.google.com"},
+            {"Work", "https://linkedin.com"},
+            {"Personal", "https://duckduckgo.com"}
+        };
+        QSettings settings("ASK", "Browser");
+        for (const auto &home : homes) {
+            const QString &name = home.first;
+            Workspace workspace;
+            workspace.homeUrl = home.second;
+            
+            // A storage name makes the profile persistent; cookies, local
+            // storage and the HTTP cache each live under its own directory
+            const QString root = QDir().absoluteFilePath("ask_workspaces/" + name.toLower());
+            const int cacheMB = settings.value("workspaces/" + name + "/cacheMB", 256).toInt();
+            QWebEngineProfile *profile = new QWebEngineProfile("ask-" + name.toLower(), this);
+            profile->setPersistentStoragePath(root + "/storage");
+            profile->setCachePath(root + "/cache");
+            profile->setHttpCacheType(QWebEngineProfile::DiskHttpCache);
+            profile->setHttpCacheMaximumSize(qBound(1, cacheMB, 2047) * 1024 * 1024);
+            profile->setPersistentCookiesPolicy(QWebEngineProfile::AllowPersistentCookies);
+            profile->installUrlSchemeHandler("ask", internalPages);
+            profile->scripts()->insert(NavigationTracer::timingScript());
+            profile->scripts()->insert(PageTextIndex::extractorScript());
+            downloadManager->attach(profile);
+            workspace.profile = profile;
+            
+            workspace.tabs = createWorkspaceTabs();
+            workspaces.insert(name, workspace);
+        }
         
-        if (db.open()) {
-            QSqlQuery query;
+        currentWorkspace = "Personal";
+        tabWidget = workspaces[currentWorkspace].tabs;
+        workspaceStack->setCurrentWidget(tabWidget);
+    }
+    
+    // ========================================================================
+    // OMNIBOX
+    // ========================================================================
+    
+    void setupOmnibox() {
+        omniboxModel = new QStandardItemModel(this);
+        
+        omniboxCompleter = new QCompleter(omniboxModel, this);
+        omniboxCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+        omniboxCompleter->setCompletionRole(Qt::UserRole);
+        omniboxCompleter->setMaxVisibleItems(8);
+        omniboxCompleter->popup()->setProperty("glass", "popup");
+        searchBar->setCompleter(omniboxCompleter);
+        
+        setupSearchSuggestions();
+        connect(searchBar, &QLineEdit::textEdited, [this](const QString &text) {
+            const InputClassification input = classifyInput(text);
+            historyMatches = omniboxIndex->query(text, 8);
             
-            // History table
-            query.exec(R"(
-                CREATE TABLE IF NOT EXISTS history (
-                    id INTEGER PRIMARY KEY AUTOINCREMENT,
-                    url TEXT NOT NULL,
-                    title TEXT,
-                    visit_time TIMESTAMP DEFAULT CURRENT_TIMESTAMP
-                )
-            )");
+            // Keep the engine's older answers that still fit until the new ones arrive
+            const QString typed = text.trimmed();
+            QStringList stillMatching;
+            for (const QString &suggestion : searchSuggestions) {
+                if (!typed.isEmpty() && suggestion.startsWith(typed, Qt::CaseInsensitive)) stillMatching.append(suggestion);
+            }
+            searchSuggestions = stillMatching;
+            updateSuggestions();
             
-            // Bookmarks table
-            query.exec(R"(
-                CREATE TABLE IF NOT EXISTS bookmarks (
-                    id INTEGER PRIMARY KEY AUTOINCREMENT,
-                    url TEXT NOT NULL,
-                    title TEXT,
-                    folder TEXT DEFAULT 'General',
-                    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
-                )
-            )");
+            if (input.kind == InputClassification::InternalPage) {
+                suggestionClient->cancel();
+            } else {
+                suggestionClient->request(text);
+            }
             
-            qDebug() << "Database initialized successfully";
-        } else {
-            qDebug() << "Database error:" << db.lastError().text();
+            // Start on the likely destination while the user is still typing
+            const QString searchUrl = searchEngines[engineSelector->currentText()] + typed;
+            speculation->typed(SpeculativeLoader::predict(text, input, historyMatches, searchUrl));
+        });
+        connect(omniboxCompleter, QOverload<const QModelIndex &>::of(&QCompleter::activated), [this]() {
+            handleSearch();
+        });
+        
+        loadOmniboxIndex();
+    }
+    
+    // Builds the index from SQLite on a worker, then swaps it in
+    void loadOmniboxIndex() {
+        omniboxLoader = QThread::create([this]() {
+            std::vector<OmniboxIndex::Entry> entries;
+            {
+                QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "ask_omnibox_loader");
+                db.setDatabaseName("ask_browser_data.db");
+                if (db.open()) {
+                    QSqlQuery(db).exec("PRAGMA busy_timeout=2000");
+                    migrateBrowserSchema(db);   // A first run may get here before the writer
+                    QHash<QString, size_t> byUrl;
+                    QSqlQuery query(db);
+                    query.setForwardOnly(true);
+                    query.exec("SELECT url, title, visit_count, typed_count, last_visit FROM urls");
+                    while (query.next()) {
+                        OmniboxIndex::Entry entry;
+                        entry.url = query.value(0).toString();
+                        entry.title = query.value(1).toString();
+                        entry.visitCount = query.value(2).toInt();
+                        entry.typedCount = query.value(3).toInt();
+                        entry.lastVisit = query.value(4).toLongLong();
+                        byUrl.insert(entry.url, entries.size());
+                        entries.push_back(entry);
+                    }
+                    
+                    query.exec("SELECT url, title FROM bookmarks");
+                    while (query.next()) {
+                        QString url = query.value(0).toString();
+                        auto it = byUrl.constFind(url);
+                        if (it == byUrl.constEnd()) {
+                            OmniboxIndex::Entry entry;
+                            entry.url = url;
+                            entry.title = query.value(1).toString();
+                            entries.push_back(entry);
+                            it = byUrl.insert(url, entries.size() - 1);
+                        }
+                        entries[it.value()].bookmarked = true;
+                    }
+                    db.close();
+                }
+            }
+            QSqlDatabase::removeDatabase("ask_omnibox_loader");
+            
+            QElapsedTimer timer;
+            timer.start();
+            std::shared_ptr<OmniboxIndex> index = OmniboxIndex::build(std::move(entries));
+            qDebug() << "Omnibox index built:" << index->size() << "entries,"
+                     << index->memoryFootprint() / 1024 << "KB," << timer.elapsed() << "ms";
+            
+            QMetaObject::invokeMethod(this, [this, index]() {
+                for (const PendingVisit &visit : visitsDuringLoad) {
+                    index->recordVisit(visit.url, visit.when, visit.typed);
+                }
+                visitsDuringLoad.clear();
+                omniboxIndex = index;
+                omniboxLoaded = true;
+            }, Qt::QueuedConnection);
+        });
+        connect(omniboxLoader, &QThread::finished, omniboxLoader, &QObject::deleteLater);
+        omniboxLoader->start(QThread::LowPriority);
+    }
+    
+    void recordOmniboxVisit(const QString &url, bool typed) {
+        if (!url.startsWith("http")) return;
+        qint64 now = QDateTime::currentSecsSinceEpoch();
+        omniboxIndex->recordVisit(url, now, typed);
+        if (!omniboxLoaded) {
+            visitsDuringLoad.append({url, now, typed});
         }
     }
     
-    void saveToHistory(const QString &url) {
-        QSqlQuery query;
-        query.prepare("INSERT INTO history (url) VALUES (:url)");
-        query.bindValue(":url", url);
-        query.exec();
+    void setupSearchSuggestions() {
+        QSettings settings("ASK", "Browser");
+        suggestionClient = new SuggestionClient(settings.value("search/suggestionDebounceMs", 120).toInt(),
+                                                settings.value("search/suggestionCacheSize", 256).toInt(), this);
+        suggestionClient->onSuggestions = [this](const QString &prefix, const QStringList &suggestions) {
+            if (prefix != searchBar->text().trimmed()) return;
+            searchSuggestions = suggestions;
+            updateSuggestions();
+        };
+        
+        // Typing only leaves the machine when the user allows it
+        auto useSelectedEngine = [this]() {
+            bool enabled = QSettings("ASK", "Browser").value("search/suggestions", true).toBool();
+            suggestionClient->setEndpoint(enabled ? suggestionEndpoints.value(engineSelector->currentText()) : QString());
+            searchSuggestions.clear();
+        };
+        useSelectedEngine();
+        connect(engineSelector, &QComboBox::currentTextChanged, this, useSelectedEngine);
+    }
+    
+    // History first; the engine's suggestions fill the rest, minus repeats
+    void updateSuggestions() {
+        omniboxModel->clear();
+        const int historyRows = qMin(historyMatches.size(), searchSuggestions.isEmpty() ? 8 : 5);
+        QSet<QString> shown;
+        for (int i = 0; i < historyRows; ++i) {
+            const OmniboxIndex::Match &match = historyMatches[i];
+            QStandardItem *item = new QStandardItem(
+                match.title.isEmpty() ? match.url : match.title + "  —  " + match.url);
+            item->setData(match.url, Qt::UserRole);
+            omniboxModel->appendRow(item);
+            shown.insert(match.title.toLower());
+        }
+        for (const QString &suggestion : searchSuggestions) {
+            if (omniboxModel->rowCount() >= 8) break;
+            if (shown.contains(suggestion.toLower())) continue;
+            shown.insert(suggestion.toLower());
+            QStandardItem *item = new QStandardItem("🔍  " + suggestion);
+            item->setData(suggestion, Qt::UserRole);
+            omniboxModel->appendRow(item);
+        }
+        if (omniboxModel->rowCount() > 0) {
+            omniboxCompleter->complete();
+        } else {
+            omniboxCompleter->popup()->hide();
+        }
     }
     
     // ========================================================================
     // FONT LOADING
     // ========================================================================
     
+    // The file is read on a worker; registering it and switching the
+    // application font happen back on the GUI thread
     void loadOxaniumFont() {
+        fontLoader = QThread::create([this]() {
+            StartupTrace &trace = StartupTrace::instance();
+            const qint64 begin = trace.elapsedUs();
+            QFile file("./Oxanium-Regular.ttf");
+            const QByteArray data = file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+            trace.record("font file read", begin, trace.elapsedUs());
+            
+            QMetaObject::invokeMethod(this, [this, data]() {
+                StartupTrace::instance().run("font apply", [this, data]() { applyFont(data); });
+            }, Qt::QueuedConnection);
+        });
+        connect(fontLoader, &QThread::finished, fontLoader, &QObject::deleteLater);
+        fontLoader->start(QThread::LowPriority);
+    }
+    
+    void applyFont(const QByteArray &data) {
         // Try to load Oxanium font
-        int fontId = QFontDatabase::addApplicationFont("./Oxanium-Regular.ttf");
+        int fontId = data.isEmpty() ? -1 : QFontDatabase::addApplicationFontFromData(data);
         QString fontFamily = "Segoe UI"; // Fallback
         
         if (fontId != -1) {
@@ -1006,40 +1889,814 @@ private:
         // Apply font globally to Qt widgets only (not web content)
         QFont appFont(fontFamily, 10);
         QApplication::setFont(appFont);
+    }
+    
+    // ========================================================================
+    // THEME
+    // ========================================================================
+    
+    // Ahead of setupUI(): with no widgets yet, installing the sheet is cheap
+    void applyTheme() {
+        theme = Theme::apply(QSettings("ASK", "Browser").value("appearance/theme").toString());
+    }
+    
+    // One sheet swap, so one repolish of every widget
+    void cycleTheme() {
+        QElapsedTimer timer;
+        timer.start();
+        theme = Theme::apply(Theme::next(theme));
+        QSettings("ASK", "Browser").setValue("appearance/theme", theme);
+        qDebug() << "Theme" << theme << "applied in" << timer.elapsed() << "ms";
+    }
+};
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+static QString benchmarkUrl(int i) {
+    // Every eighth visit repeats the previous URL, like a redirect or SPA route churn
+    int n = (i % 8 == 7) ? i - 1 : i;
+    return QString("https://site%1.example.com/page/%2?ref=%3").arg(n % 500).arg(n).arg(n % 17);
+}
+
+static int argumentValue(const QStringList &args, const QString &name, int fallback) {
+    for (const QString &arg : args) {
+        if (arg.startsWith(name + "=")) {
+            bool ok = false;
+            int value = arg.mid(name.size() + 1).toInt(&ok);
+            if (ok && value > 0) return value;
+        }
+    }
+    return fallback;
+}
+
+static QString argumentString(const QStringList &args, const QString &name, const QString &fallback) {
+    for (const QString &arg : args) {
+        if (arg.startsWith(name + "=")) return arg.mid(name.size() + 1);
+    }
+    return fallback;
+}
+
+static int runHistoryBenchmark(int visits) {
+    QTextStream out(stdout);
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        out << "history benchmark: cannot create temporary directory\n";
+        return 1;
+    }
+    
+    // Baseline: one prepared INSERT per visit, on the calling (GUI) thread
+    qint64 legacyTotalNs = 0;
+    qint64 legacyWorstNs = 0;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "bench_legacy");
+        db.setDatabaseName(dir.filePath("legacy.db"));
+        db.open();
+        QSqlQuery(db).exec(R"(
+            CREATE TABLE history (
+                id INTEGER PRIMARY KEY AUTOINCREMENT,
+                url TEXT NOT NULL,
+                title TEXT,
+                visit_time TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+            )
+        )");
         
-        // Tooltip styling
-        qApp->setStyleSheet(qApp->styleSheet() + R"(
-            QToolTip {
-                background: rgba(15, 15, 35, 0.95);
-                color: white;
-                border: 1px solid #00d4ff;
-                border-radius: 6px;
-                padding: 8px;
-                font-size: 12px;
+        QElapsedTimer total;
+        total.start();
+        for (int i = 0; i < visits; ++i) {
+            QElapsedTimer call;
+            call.start();
+            QSqlQuery query(db);
+            query.prepare("INSERT INTO history (url) VALUES (:url)");
+            query.bindValue(":url", benchmarkUrl(i));
+            query.exec();
+            legacyWorstNs = qMax(legacyWorstNs, call.nsecsElapsed());
+        }
+        legacyTotalNs = total.nsecsElapsed();
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("bench_legacy");
+    
+    // Batched writer thread; the queue is sized so nothing is dropped
+    const QString writerPath = dir.filePath("writer.db");
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "bench_setup");
+        db.setDatabaseName(writerPath);
+        db.open();
+        migrateBrowserSchema(db);
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("bench_setup");
+    
+    HistoryWriter writer(writerPath, visits, 1000);
+    writer.start();
+    
+    qint64 writerWorstNs = 0;
+    QElapsedTimer total;
+    total.start();
+    for (int i = 0; i < visits; ++i) {
+        QElapsedTimer call;
+        call.start();
+        writer.enqueue(benchmarkUrl(i));
+        writerWorstNs = qMax(writerWorstNs, call.nsecsElapsed());
+    }
+    writer.shutdown();
+    qint64 writerTotalNs = total.nsecsElapsed();
+    
+    auto rate = [visits](qint64 ns) { return visits / (ns / 1e9); };
+    out << "history benchmark: " << visits << " visits\n";
+    out << QString("  per-visit insert : %1 visits/s, worst GUI-thread block %2 ms\n")
+               .arg(rate(legacyTotalNs), 0, 'f', 0)
+               .arg(legacyWorstNs / 1e6, 0, 'f', 3);
+    out << QString("  batched writer   : %1 visits/s, worst GUI-thread block %2 ms (%3 written, %4 duplicates skipped)\n")
+               .arg(rate(writerTotalNs), 0, 'f', 0)
+               .arg(writerWorstNs / 1e6, 0, 'f', 3)
+               .arg(writer.written())
+               .arg(visits - writer.written() - writer.dropped());
+    return 0;
+}
+
+static int runFilterBenchmark(int ruleCount) {
+    QTextStream out(stdout);
+    const int lookups = 1000000;
+    
+    // EasyList-like mix: host rules, path rules, anchored rules and exceptions
+    QByteArray list;
+    for (int i = 0; i < ruleCount; ++i) {
+        switch (i % 10) {
+        case 6: case 7:
+            list += QString("/adunit%1/*\n").arg(i).toLatin1();
+            break;
+        case 8:
+            list += QString("||cdn%1.example.org/ads/*/pixel^$image\n").arg(i).toLatin1();
+            break;
+        case 9:
+            list += QString("@@||ok%1.adnet%2.net^\n").arg(i).arg(i % 97).toLatin1();
+            break;
+        default:
+            list += QString("||trk%1.adnet%2.net^%3\n").arg(i).arg(i % 97)
+                        .arg(i % 3 == 0 ? "$third-party" : "").toLatin1();
+            break;
+        }
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    std::shared_ptr<const FilterMatcher> matcher = FilterMatcher::compile({list});
+    qint64 compileMs = timer.elapsed();
+    
+    // A third of the requests hit a tracker host, a fifth carry an ad path
+    const int distinct = 65536;
+    std::vector<FilterMatcher::Request> requests(distinct);
+    for (int i = 0; i < distinct; ++i) {
+        FilterMatcher::Request &request = requests[i];
+        int rule = (i * 7919) % ruleCount;
+        int base = rule - rule % 10;
+        request.host = (i % 3 == 0 ? QString("static.trk%1.adnet%2.net").arg(base).arg(base % 97)
+                                   : QString("www.site%1.com").arg(i % 1000)).toLatin1();
+        request.url = QString("https://%1/path/%2%3/img.js?x=%4")
+                          .arg(QString::fromLatin1(request.host))
+                          .arg(i % 5 == 0 ? "adunit" : "content")
+                          .arg(base + 6).arg(i).toLatin1();
+        request.documentUrl = QString("https://www.site%1.com/").arg(i % 1000).toLatin1();
+        request.documentHost = request.documentUrl.mid(8, request.documentUrl.size() - 9);
+        request.thirdParty = FilterMatcher::registrableDomain(request.host)
+                          != FilterMatcher::registrableDomain(request.documentHost);
+        request.type = (i % 4 == 0) ? FilterMatcher::Image : FilterMatcher::Script;
+    }
+    
+    qint64 blocked = 0;
+    timer.restart();
+    for (int i = 0; i < lookups; ++i) {
+        blocked += matcher->shouldBlock(requests[i % distinct]);
+    }
+    qint64 lookupNs = timer.nsecsElapsed();
+    
+    out << "filter benchmark: " << matcher->ruleCount() << " rules (" << matcher->skippedCount() << " skipped)\n";
+    out << QString("  compile : %1 ms, %2 MB resident in matcher\n")
+               .arg(compileMs)
+               .arg(matcher->memoryFootprint() / (1024.0 * 1024.0), 0, 'f', 1);
+    out << QString("  lookup  : %1 ns/request over %2 requests, %3% blocked\n")
+               .arg(double(lookupNs) / lookups, 0, 'f', 1)
+               .arg(lookups)
+               .arg(100.0 * blocked / lookups, 0, 'f', 1);
+    return 0;
+}
+
+static int runOmniboxBenchmark(int visits) {
+    QTextStream out(stdout);
+    static const char *const words[] = {
+        "news", "weather", "docs", "github", "issues", "pull", "release", "wiki", "video",
+        "music", "shop", "cart", "mail", "inbox", "maps", "travel", "recipe", "kernel",
+        "qt", "webengine", "sqlite", "rust", "python", "forum", "search", "review", "login"
+    };
+    const int wordCount = int(sizeof(words) / sizeof(words[0]));
+    
+    // Roughly four visits per URL, skewed towards a small set of hosts
+    const int urls = qMax(1, visits / 4);
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+    std::vector<OmniboxIndex::Entry> entries(urls);
+    for (int i = 0; i < urls; ++i) {
+        OmniboxIndex::Entry &entry = entries[i];
+        int host = (i % 10 < 7) ? i % 50 : i % 5000;
+        entry.url = QString("https://%1%2.example.com/%3/%4")
+                        .arg(words[host % wordCount]).arg(host)
+                        .arg(words[(i / 3) % wordCount]).arg(i);
+        entry.title = QString("%1 %2 page %3")
+                          .arg(words[(i * 7) % wordCount], words[(i * 13) % wordCount]).arg(i);
+        entry.visitCount = 1 + (i % 7 == 0 ? 20 : i % 4);
+        entry.typedCount = (i % 11 == 0) ? 1 : 0;
+        entry.lastVisit = now - qint64(i % 120) * 86400;
+        entry.bookmarked = (i % 500 == 0);
+    }
+    
+    QElapsedTimer timer;
+    timer.start();
+    std::shared_ptr<OmniboxIndex> index = OmniboxIndex::build(std::move(entries));
+    qint64 buildMs = timer.elapsed();
+    
+    // Replay typing each prefix of a set of queries, one query() per keystroke
+    const QStringList typed = {
+        "github.com/issues", "news weather", "qt webengine docs", "mail inbox", "shop cart review",
+        "https://www.recipe", "kernel release", "music video", "travel maps", "sqlite forum login"
+    };
+    index->query("warm up", 8);
+    
+    std::vector<qint64> latencies;
+    int results = 0;
+    for (int round = 0; round < 20; ++round) {
+        for (const QString &query : typed) {
+            for (int length = 1; length <= query.size(); ++length) {
+                timer.restart();
+                results += index->query(query.left(length), 8).size();
+                latencies.push_back(timer.nsecsElapsed());
             }
-        )");
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        return latencies[size_t(p * (latencies.size() - 1))] / 1000.0;
+    };
+    
+    out << "omnibox benchmark: " << visits << " visits over " << index->size() << " URLs\n";
+    out << QString("  build     : %1 ms, %2 MB resident in index\n")
+               .arg(buildMs)
+               .arg(index->memoryFootprint() / (1024.0 * 1024.0), 0, 'f', 1);
+    out << QString("  keystroke : p50 %1 us, p99 %2 us, max %3 us over %4 keystrokes (%5 results)\n")
+               .arg(percentile(0.50), 0, 'f', 1)
+               .arg(percentile(0.99), 0, 'f', 1)
+               .arg(latencies.back() / 1000.0, 0, 'f', 1)
+               .arg(latencies.size())
+               .arg(results);
+    return 0;
+}
+
+static char benchmarkPayloadByte(qint64 offset) {
+    return char((offset * 131 + (offset >> 12)) & 0xFF);
+}
+
+/**
+ * Minimal HTTP/1.1 server for the download benchmark: serves a generated
+ * payload with Range support and holds every connection to a fixed byte
+ * rate, standing in for a mirror that throttles per stream.
+ */
+class ThrottledPayloadServer : public QObject {
+public:
+    ThrottledPayloadServer(qint64 size, qint64 bytesPerSecond, QObject *parent = nullptr)
+        : QObject(parent), size(size), bytesPerSecond(bytesPerSecond), server(new QTcpServer(this)) {
+        connect(server, &QTcpServer::newConnection, this, [this]() {
+            while (QTcpSocket *socket = server->nextPendingConnection()) {
+                serve(socket);
+            }
+        });
+    }
+    
+    bool listen() { return server->listen(QHostAddress::LocalHost); }
+    quint16 port() const { return server->serverPort(); }
+
+private:
+    struct Stream {
+        QByteArray request;
+        qint64 next = 0;
+        qint64 last = -1;
+        qint64 sent = 0;
+        QElapsedTimer clock;
+    };
+    
+    void serve(QTcpSocket *socket) {
+        auto stream = std::make_shared<Stream>();
+        QTimer *pump = new QTimer(socket);
+        pump->setInterval(5);
+        
+        connect(socket, &QTcpSocket::readyRead, socket, [this, socket, stream, pump]() {
+            if (pump->isActive()) return;
+            stream->request += socket->readAll();
+            if (!stream->request.contains("\r\n\r\n")) return;
+            
+            qint64 first = 0;
+            qint64 last = size - 1;
+            bool partial = false;
+            for (const QByteArray &line : stream->request.split('\n')) {
+                QByteArray header = line.trimmed().toLower();
+                if (header.startsWith("range: bytes=")) {
+                    QByteArray spec = header.mid(13);
+                    int dash = spec.indexOf('-');
+                    first = spec.left(dash).toLongLong();
+                    if (dash + 1 < spec.size()) last = qMin(last, spec.mid(dash + 1).toLongLong());
+                    partial = true;
+                }
+            }
+            
+            QByteArray head = partial ? "HTTP/1.1 206 Partial Content\r\n" : "HTTP/1.1 200 OK\r\n";
+            head += "Content-Length: " + QByteArray::number(last - first + 1) + "\r\n";
+            if (partial) {
+                head += "Content-Range: bytes " + QByteArray::number(first) + "-" + QByteArray::number(last)
+                      + "/" + QByteArray::number(size) + "\r\n";
+            }
+            head += "Accept-Ranges: bytes\r\nETag: \"ask-bench\"\r\nConnection: close\r\n\r\n";
+            socket->write(head);
+            
+            stream->next = first;
+            stream->last = last;
+            stream->clock.start();
+            pump->start();
+        });
+        
+        // Token bucket: never more than bytesPerSecond on this connection
+        connect(pump, &QTimer::timeout, socket, [this, socket, stream, pump]() {
+            qint64 allowed = bytesPerSecond * stream->clock.elapsed() / 1000 - stream->sent;
+            qint64 length = qMin(allowed, stream->last + 1 - stream->next);
+            if (length <= 0 || socket->bytesToWrite() > bytesPerSecond / 10) return;
+            
+            QByteArray chunk(int(length), Qt::Uninitialized);
+            for (qint64 i = 0; i < length; ++i) {
+                chunk[int(i)] = benchmarkPayloadByte(stream->next + i);
+            }
+            socket->write(chunk);
+            stream->next += length;
+            stream->sent += length;
+            if (stream->next > stream->last) {
+                pump->stop();
+                socket->disconnectFromHost();
+            }
+        });
+        connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
     }
+    
+    qint64 size;
+    qint64 bytesPerSecond;
+    QTcpServer *server;
 };
 
+static DownloadManager::Info waitForDownload(const DownloadManager &manager,
+                                             const std::function<bool(const DownloadManager::Info &)> &until) {
+    DownloadManager::Info result;
+    QEventLoop loop;
+    QTimer poll;
+    QElapsedTimer deadline;
+    deadline.start();
+    QObject::connect(&poll, &QTimer::timeout, [&]() {
+        QVector<DownloadManager::Info> list = manager.downloads();
+        if (!list.isEmpty() && (until(list.first()) || deadline.elapsed() > 300000)) {
+            result = list.first();
+            loop.quit();
+        }
+    });
+    poll.start(20);
+    loop.exec();
+    return result;
+}
+
+static bool verifyPayload(const QString &path, qint64 size) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly) || file.size() != size) return false;
+    qint64 offset = 0;
+    while (!file.atEnd()) {
+        QByteArray chunk = file.read(1 << 20);
+        for (int i = 0; i < chunk.size(); ++i) {
+            if (chunk[i] != benchmarkPayloadByte(offset + i)) return false;
+        }
+        offset += chunk.size();
+    }
+    return offset == size;
+}
+
+static int runDownloadBenchmark(int megabytes) {
+    QTextStream out(stdout);
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        out << "download benchmark: cannot create temporary directory\n";
+        return 1;
+    }
+    
+    const qint64 size = qint64(megabytes) * 1024 * 1024;
+    const qint64 perConnection = 2 * 1024 * 1024;
+    
+    QThread serverThread;
+    QObject *serverContext = new QObject();
+    serverContext->moveToThread(&serverThread);
+    serverThread.start();
+    quint16 port = 0;
+    QMetaObject::invokeMethod(serverContext, [&]() {
+        ThrottledPayloadServer *server = new ThrottledPayloadServer(size, perConnection, serverContext);
+        if (server->listen()) port = server->port();
+    }, Qt::BlockingQueuedConnection);
+    const QUrl url(QString("http://127.0.0.1:%1/payload.bin").arg(port));
+    
+    // What a page would advertise next to the link
+    QCryptographicHash expected(QCryptographicHash::Sha256);
+    for (qint64 offset = 0; offset < size; offset += 1 << 20) {
+        QByteArray chunk(int(qMin<qint64>(1 << 20, size - offset)), Qt::Uninitialized);
+        for (int i = 0; i < chunk.size(); ++i) {
+            chunk[i] = benchmarkPayloadByte(offset + i);
+        }
+        expected.addData(chunk);
+    }
+    const QString checksum = "sha256:" + QString::fromLatin1(expected.result().toHex());
+    
+    out << "download benchmark: " << megabytes << " MB from a local server capped at "
+        << perConnection / (1024 * 1024) << " MB/s per connection\n";
+    
+    auto finished = [](const DownloadManager::Info &info) {
+        return info.state == "Completed" || info.state == "Failed";
+    };
+    int status = port ? 0 : 1;
+    for (int connections : {1, 6}) {
+        if (!port) break;
+        const QString path = dir.filePath(QString("payload-%1.bin").arg(connections));
+        DownloadManager::Info info;
+        QElapsedTimer timer;
+        {
+            DownloadManager manager(dir.filePath(QString("downloads-%1.db").arg(connections)), connections);
+            timer.start();
+            manager.start(url, path, checksum);
+            info = waitForDownload(manager, finished);
+        }
+        bool verified = verifyPayload(path, size);
+        status |= (verified && info.verification == "verified") ? 0 : 1;
+        out << QString("  %1 connection%2 : %3 MB/s (%4 s), %5; sha-256 %6 %7 ms after the last byte, %8 bytes read back\n")
+                   .arg(connections).arg(connections == 1 ? " " : "s")
+                   .arg(size / (1024.0 * 1024.0) / (timer.nsecsElapsed() / 1e9), 0, 'f', 2)
+                   .arg(timer.nsecsElapsed() / 1e9, 0, 'f', 2)
+                   .arg(verified ? "bytes verified" : "CORRUPT (" + info.state + ")")
+                   .arg(info.verification.isEmpty() ? "not checked" : info.verification)
+                   .arg(info.verifyTailMs)
+                   .arg(info.readBackBytes);
+    }
+    
+    // Pause part-way, drop the manager, and resume from what SQLite kept
+    if (port) {
+        const QString database = dir.filePath("downloads-resume.db");
+        const QString path = dir.filePath("payload-resume.bin");
+        qint64 pausedAt = 0;
+        {
+            DownloadManager manager(database, 6);
+            manager.start(url, path, checksum);
+            DownloadManager::Info info = waitForDownload(manager, [size](const DownloadManager::Info &current) {
+                return current.receivedBytes >= size * 2 / 5;
+            });
+            manager.pause(info.id);
+            info = waitForDownload(manager, [](const DownloadManager::Info &current) {
+                return current.state == "Paused";
+            });
+            pausedAt = info.receivedBytes;
+        }
+        DownloadManager::Info resumed;
+        {
+            DownloadManager manager(database, 6);
+            DownloadManager::Info info = waitForDownload(manager, [](const DownloadManager::Info &current) {
+                return current.state == "Paused";
+            });
+            manager.resume(info.id);
+            resumed = waitForDownload(manager, finished);
+        }
+        bool verified = verifyPayload(path, size);
+        status |= (verified && resumed.verification == "verified") ? 0 : 1;
+        out << QString("  pause/resume  : paused at %1%, resumed from SQLite, %2; sha-256 %3, %4 MB read back\n")
+                   .arg(100 * pausedAt / size)
+                   .arg(verified ? "bytes verified" : "CORRUPT")
+                   .arg(resumed.verification.isEmpty() ? "not checked" : resumed.verification)
+                   .arg(resumed.readBackBytes / (1024.0 * 1024.0), 0, 'f', 1);
+    }
+    
+    QMetaObject::invokeMethod(serverContext, [serverContext]() { delete serverContext; },
+                              Qt::BlockingQueuedConnection);
+    serverThread.quit();
+    serverThread.wait();
+    return status;
+}
+
+// Peak resident set of a process from /proc, or -1 where that is unavailable
+static qint64 peakResidentKb(qint64 pid) {
+#ifdef Q_OS_LINUX
+    QFile status(QString("/proc/%1/status").arg(pid));
+    if (pid > 0 && status.open(QIODevice::ReadOnly)) {
+        for (const QByteArray &line : status.readAll().split('\n')) {
+            if (line.startsWith("VmHWM:")) {
+                return line.mid(6).simplified().split(' ').value(0).toLongLong();
+            }
+        }
+    }
+#else
+    Q_UNUSED(pid);
+#endif
+    return -1;
+}
+
+/**
+ * Headless throughput benchmark (--batch-load=<file>, one URL per line):
+ * loads every URL in an offscreen view on a fresh off-the-record profile,
+ * a few at a time, and reports per-URL load time, bytes transferred,
+ * requests blocked and the renderer's peak memory as CSV or JSON. Bytes
+ * come from Resource Timing, so cross-origin responses without
+ * Timing-Allow-Origin count as 0; serve the corpus from one local origin.
+ * Chromium flags are taken from QTWEBENGINE_CHROMIUM_FLAGS as usual.
+ */
+static int runBatchLoad(const QStringList &args) {
+    QTextStream err(stderr);
+    const QString listPath = argumentString(args, "--batch-load", QString());
+    const int concurrency = argumentValue(args, "--batch-concurrency", 4);
+    const int timeoutMs = argumentValue(args, "--batch-timeout", 30) * 1000;
+    const bool json = argumentString(args, "--batch-format", "csv") == "json";
+    const QString outputPath = argumentString(args, "--batch-output", QString());
+    const bool blocking = !args.contains("--no-tracker-blocking");
+    
+    QStringList urls;
+    QFile list(listPath);
+    if (list.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        for (const QByteArray &line : list.readAll().split('\n')) {
+            const QString url = QString::fromUtf8(line).trimmed();
+            if (!url.isEmpty() && !url.startsWith('#')) urls << url;
+        }
+    }
+    if (urls.isEmpty()) {
+        err << "batch load: no URLs in \"" << listPath << "\"\n";
+        return 1;
+    }
+    
+    // Every URL sees the same compiled filter lists
+    TrackerBlocker blocker;
+    if (blocking) {
+        blocker.loadFilterLists("./filters");
+        QEventLoop loop;
+        QTimer poll;
+        QObject::connect(&poll, &QTimer::timeout, [&]() {
+            if (blocker.matcher()) loop.quit();
+        });
+        poll.start(20);
+        loop.exec();
+    }
+    
+    // Off the record: a cold cache and no cookies on every run
+    QWebEngineProfile profile;
+    QWebEngineScript bufferScript;
+    bufferScript.setName("ask-batch-resource-buffer");
+    bufferScript.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    bufferScript.setWorldId(QWebEngineScript::MainWorld);
+    bufferScript.setSourceCode("performance.setResourceTimingBufferSize(100000);");
+    profile.scripts()->insert(bufferScript);
+    
+    struct Result {
+        QString url;
+        QString status = "pending";
+        qint64 loadMs = -1;
+        qint64 bytes = -1;
+        int blocked = 0;
+        qint64 rendererPeakKb = -1;
+    };
+    std::vector<Result> results(size_t(urls.size()));
+    QList<QWebEngineView*> inFlight;
+    
+    ProcessSampler sampler;
+    qint64 peakTotalKb = 0;
+    sampler.tabViews = [&inFlight]() { return inFlight; };
+    sampler.onSample = [&]() { peakTotalKb = qMax(peakTotalKb, sampler.totalKb()); };
+    sampler.setWatched(true);
+    
+    static const char *bytesScript = R"(
+        (function () {
+            var navigation = performance.getEntriesByType('navigation')[0];
+            var total = navigation ? navigation.transferSize : 0;
+            performance.getEntriesByType('resource').forEach(function (entry) { total += entry.transferSize; });
+            return total;
+        })()
+    )";
+    
+    QEventLoop loop;
+    QElapsedTimer wall;
+    wall.start();
+    int next = 0;
+    int remaining = urls.size();
+    std::function<void()> launch;
+    launch = [&]() {
+        while (inFlight.size() < concurrency && next < urls.size()) {
+            const size_t index = size_t(next++);
+            results[index].url = urls[int(index)];
+            
+            QWebEngineView *view = new QWebEngineView();
+            view->setPage(new QWebEnginePage(&profile, view));
+            WebViewPool::configure(view);
+            view->resize(1280, 800);
+            view->show();
+            TrackerInterceptor *interceptor = new TrackerInterceptor(&blocker, view);
+            if (blocking) view->page()->setUrlRequestInterceptor(interceptor);
+            inFlight.append(view);
+            
+            auto clock = std::make_shared<QElapsedTimer>();
+            auto settled = std::make_shared<bool>(false);
+            auto retire = [&, view, index, interceptor, settled](const QString &status) {
+                if (*settled) return;
+                *settled = true;
+                Result &result = results[index];
+                result.status = status;
+                result.blocked = interceptor->blocked();
+                inFlight.removeOne(view);
+                view->deleteLater();
+                if (--remaining == 0) {
+                    loop.quit();
+                } else {
+                    QTimer::singleShot(0, launch);
+                }
+            };
+            
+            QObject::connect(view, &QWebEngineView::loadFinished, view,
+                             [&, view, index, clock, retire](bool ok) {
+                Result &result = results[index];
+                if (result.loadMs >= 0) return;
+                result.loadMs = clock->elapsed();
+                result.rendererPeakKb = peakResidentKb(view->page()->renderProcessPid());
+                if (!ok) {
+                    retire("failed");
+                    return;
+                }
+                view->page()->runJavaScript(bytesScript, [&, index, retire](const QVariant &bytes) {
+                    results[index].bytes = bytes.toLongLong();
+                    retire("ok");
+                });
+            });
+            QTimer::singleShot(timeoutMs, view, [view, retire]() {
+                view->stop();
+                retire("timeout");
+            });
+            
+            clock->start();
+            view->setUrl(QUrl::fromUserInput(urls[int(index)]));
+        }
+    };
+    launch();
+    loop.exec();
+    const qint64 wallMs = wall.elapsed();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);  // Pages before their profile
+    
+    // Summary, always on stderr so stdout stays machine-readable
+    QVector<qint64> loads;
+    int ok = 0;
+    for (const Result &result : results) {
+        if (result.status != "ok") continue;
+        ++ok;
+        loads.append(result.loadMs);
+    }
+    std::sort(loads.begin(), loads.end());
+    auto rank = [&loads](int percent) -> qint64 {
+        return loads.isEmpty() ? -1 : loads.at(qMax(0, (loads.size() * percent + 99) / 100 - 1));
+    };
+    std::shared_ptr<const FilterMatcher> matcher = blocker.matcher();
+    const QString flags = QString::fromLocal8Bit(qgetenv("QTWEBENGINE_CHROMIUM_FLAGS"));
+    err << QString("batch load: %1/%2 ok in %3 ms (%4 pages/s), load p50 %5 ms p95 %6 ms, peak %7 MB\n")
+               .arg(ok).arg(urls.size()).arg(wallMs)
+               .arg(wallMs > 0 ? urls.size() * 1000.0 / wallMs : 0, 0, 'f', 2)
+               .arg(rank(50)).arg(rank(95)).arg(peakTotalKb / 1024);
+    
+    QFile output(outputPath);
+    const bool opened = outputPath.isEmpty() ? output.open(stdout, QIODevice::WriteOnly)
+                                             : output.open(QIODevice::WriteOnly);
+    if (!opened) {
+        err << "batch load: cannot write " << outputPath << "\n";
+        return 1;
+    }
+    QTextStream out(&output);
+    if (json) {
+        QJsonArray rows;
+        for (const Result &result : results) {
+            rows.append(QJsonObject{{"url", result.url}, {"status", result.status},
+                                    {"loadMs", double(result.loadMs)}, {"bytes", double(result.bytes)},
+                                    {"blocked", result.blocked}, {"rendererPeakKb", double(result.rendererPeakKb)}});
+        }
+        QJsonObject metadata{{"chromiumFlags", flags}, {"concurrency", concurrency},
+                             {"trackerBlocking", blocking}, {"filterRules", matcher ? matcher->ruleCount() : 0}};
+        QJsonObject summary{{"pages", urls.size()}, {"ok", ok}, {"wallMs", double(wallMs)},
+                            {"loadP50Ms", double(rank(50))}, {"loadP95Ms", double(rank(95))},
+                            {"peakTotalKb", double(peakTotalKb)}};
+        out << QJsonDocument(QJsonObject{{"metadata", metadata}, {"summary", summary}, {"results", rows}}).toJson();
+    } else {
+        out << "url,status,load_ms,bytes,blocked,renderer_peak_kb\n";
+        for (const Result &result : results) {
+            QString url = result.url;
+            if (url.contains(',') || url.contains('"')) url = '"' + url.replace('"', "\"\"") + '"';
+            out << url << ',' << result.status << ',' << result.loadMs << ',' << result.bytes << ','
+                << result.blocked << ',' << result.rendererPeakKb << '\n';
+        }
+    }
+    return ok == urls.size() ? 0 : 2;
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
 
 int main(int argc, char *argv[]) {
-    // Performance flags for Chromium
-    qputenv("QTWEBENGINE_CHROMIUM_FLAGS", 
-            "--enable-gpu-rasterization "
-            "--enable-zero-copy "
-            "--ignore-gpu-blocklist "
-            "--enable-features=VaapiVideoDecoder");
+    StartupTrace &trace = StartupTrace::instance();  // Starts the start-up clock
+    bool batch = false;
+    for (int i = 1; i < argc; ++i) {
+        batch = batch || QByteArray(argv[i]).startsWith("--batch-load=");
+    }
+    
+    // Performance flags for Chromium, unless the environment brings its own
+    // (batch runs compare flag sets this way). Offscreen has no GPU.
+    if (!qEnvironmentVariableIsSet("QTWEBENGINE_CHROMIUM_FLAGS")) {
+        qputenv("QTWEBENGINE_CHROMIUM_FLAGS", batch ? "--disable-gpu" :
+                "--enable-gpu-rasterization "
+                "--enable-zero-copy "
+                "--ignore-gpu-blocklist "
+                "--enable-features=VaapiVideoDecoder");
+    }
+    if (batch && !qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    
+    // Internal pages; must be registered before the first profile exists
+    QWebEngineUrlScheme askScheme("ask");
+    askScheme.setSyntax(QWebEngineUrlScheme::Syntax::Host);
+    askScheme.setFlags(QWebEngineUrlScheme::SecureScheme | QWebEngineUrlScheme::LocalScheme
+                       | QWebEngineUrlScheme::LocalAccessAllowed);
+    QWebEngineUrlScheme::registerScheme(askScheme);
     
     QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
     QApplication::setAttribute(Qt::AA_UseHighDpiPixmaps);
+    QApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
     
+    const qint64 appBegin = trace.elapsedUs();
     QApplication app(argc, argv);
+    trace.record("QApplication", appBegin, trace.elapsedUs());
+    
+    const QStringList args = app.arguments();
+    if (args.contains("--bench-history") || argumentValue(args, "--bench-history", 0) > 0) {
+        return runHistoryBenchmark(argumentValue(args, "--bench-history", 5000));
+    }
+    if (args.contains("--bench-filter") || argumentValue(args, "--bench-filter", 0) > 0) {
+        return runFilterBenchmark(argumentValue(args, "--bench-filter", 100000));
+    }
+    if (args.contains("--bench-omnibox") || argumentValue(args, "--bench-omnibox", 0) > 0) {
+        return runOmniboxBenchmark(argumentValue(args, "--bench-omnibox", 500000));
+    }
+    if (args.contains("--bench-download") || argumentValue(args, "--bench-download", 0) > 0) {
+        return runDownloadBenchmark(argumentValue(args, "--bench-download", 16));
+    }
+    if (batch) {
+        return runBatchLoad(args);
+    }
+    if (args.contains("--soak-tabs") || argumentValue(args, "--soak-tabs", 0) > 0) {
+        AskBrowser browser;
+        browser.show();
+        return browser.soakTabs(argumentValue(args, "--soak-tabs", 1000));
+    }
+    
+    // Link handlers launch us with URLs; relative paths mean files here
+    QStringList urls;
+    for (const QString &arg : args.mid(1)) {
+        if (!arg.startsWith('-')) {
+            urls << QUrl::fromUserInput(arg, QDir::currentPath(), QUrl::AssumeLocalFile).toString();
+        }
+    }
+    
+    // One browser per data directory: a second launch hands its URLs to the
+    // running one and leaves before Chromium or the databases start
+    InstanceChannel instance;
+    if (!args.contains("--new-instance")) {
+        QElapsedTimer forwarding;
+        forwarding.start();
+        if (InstanceChannel::forward(urls)) {
+            qDebug() << "Forwarded" << urls.size() << "URLs to the running browser in" << forwarding.elapsed() << "ms";
+            return 0;
+        }
+        InstanceChannel::ListenResult listening = InstanceChannel::Unavailable;
+        trace.run("instance channel", [&instance, &listening]() { listening = instance.listen(); });
+        
+        // Launched alongside another, or while it was still starting: it only
+        // answers once its event loop runs, so give it longer this time
+        if (listening == InstanceChannel::AlreadyRunning && InstanceChannel::forward(urls, 10000)) {
+            qDebug() << "Forwarded" << urls.size() << "URLs to the browser that started first in" << forwarding.elapsed() << "ms";
+            return 0;
+        }
+    }
     
     AskBrowser browser;
-    browser.show();
+    trace.run("show window", [&browser]() { browser.show(); });
+    browser.openUrls(urls);
+    instance.onOpen = [&browser](const QStringList &forwarded) {
+        browser.openUrls(forwarded.isEmpty() ? QStringList{QString()} : forwarded);
+    };
     
     return app.exec();
 }
@@ -0,0 +1,561 @@
+/**
+ * ASK BROWSER - Core microbenchmarks
+ *
+ * Times the hot paths of the browser core in isolation, on the offscreen
+ * platform so it runs on machines without a display:
+ *
+ *   classify      omnibox input -> internal page / URL / search (handleSearch)
+ *   history       visit enqueue on the batched writer (saveToHistory)
+ *   tab-create    view + page + settings + interceptor, then first blank load (addNewTab)
+ *   style-setup   glass chrome widgets constructed and polished under the theme's
+ *                 application stylesheet, plus switching themes with them alive
+ *   suggest       typing against a local OpenSearch stand-in (--suggest-latency=ms):
+ *                 answer latency cold, from cache and with the server gone
+ *   page-index    full-text search over --index-pages=N synthetic pages (default
+ *                 20000) after indexing them through the background writer
+ *
+ * Each benchmark prints one JSON object per line on stdout: iterations,
+ * ops/sec, latency percentiles in nanoseconds and heap allocations per op.
+ * Allocations are counted process-wide, so tab-create also sees whatever
+ * WebEngine's own threads allocate meanwhile.
+ *
+ * Build like ask.cpp, with the same Qt modules (widgets, webenginewidgets,
+ * sql, network), and run e.g.
+ *
+ *   ./ask_bench --bench=classify,history --iterations=20000
+ */
+
+#include <QApplication>
+#include <QEventLoop>
+#include <QTemporaryDir>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTextStream>
+#include <QUrlQuery>
+
+#include "ask_core.h"
+#include "ask_widgets.h"
+
+#include <cstdlib>
+#include <new>
+
+// ============================================================================
+// ALLOCATION COUNTING
+// ============================================================================
+
+static std::atomic<qint64> allocationCount{0};
+
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+// ============================================================================
+// HARNESS
+// ============================================================================
+
+/**
+ * Per-op latencies and the allocation delta for one benchmark run.
+ */
+class BenchRun {
+public:
+    explicit BenchRun(int iterations) {
+        samples.reserve(iterations);
+        allocationsAtStart = allocationCount.load();
+        total.start();
+    }
+
+    // Time one operation; the sample vector is reserved, so this does not allocate
+    template<typename F>
+    void measure(F &&op) {
+        QElapsedTimer timer;
+        timer.start();
+        op();
+        samples.push_back(timer.nsecsElapsed());
+    }
+
+    QJsonObject result(const QString &name) {
+        qint64 elapsedNs = total.nsecsElapsed();
+        qint64 allocations = allocationCount.load() - allocationsAtStart;
+
+        QJsonObject json{{"bench", name}, {"iterations", int(samples.size())}};
+        if (samples.empty()) return json;
+        json["opsPerSec"] = samples.size() / (elapsedNs / 1e9);
+        json["allocsPerOp"] = double(allocations) / samples.size();
+        addPercentiles(json, "", samples);
+        return json;
+    }
+
+    static void addPercentiles(QJsonObject &json, const QString &prefix, std::vector<qint64> values) {
+        if (values.empty()) return;
+        std::sort(values.begin(), values.end());
+        auto at = [&values](double q) {
+            return double(values[qMin<size_t>(values.size() - 1, size_t(q * values.size()))]);
+        };
+        auto key = [&prefix](const QString &name) {
+            return prefix.isEmpty() ? name : prefix + name.left(1).toUpper() + name.mid(1);
+        };
+        json[key("p50Ns")] = at(0.50);
+        json[key("p95Ns")] = at(0.95);
+        json[key("p99Ns")] = at(0.99);
+        json[key("maxNs")] = double(values.back());
+    }
+
+private:
+    std::vector<qint64> samples;
+    qint64 allocationsAtStart = 0;
+    QElapsedTimer total;
+};
+
+static void printResult(const QJsonObject &json) {
+    QTextStream(stdout) << QJsonDocument(json).toJson(QJsonDocument::Compact) << "\n";
+}
+
+static QString benchUrl(int i) {
+    return QString("https://site%1.example.com/page/%2?ref=%3").arg(i % 500).arg(i).arg(i % 17);
+}
+
+// ============================================================================
+// BENCHMARKS
+// ============================================================================
+
+static int benchClassify(int iterations) {
+    // What people type: hosts, full URLs, searches, internal pages
+    const QStringList inputs = {
+        "example.com", "https://news.ycombinator.com/item?id=1", "weather tomorrow",
+        "ask://settings", "localhost:8080", "how to center a div", "en.wikipedia.org/wiki/Qt",
+        "192.168.1.1", "c++ move semantics", "github.com",
+    };
+
+    int urls = 0;
+    BenchRun run(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        const QString &input = inputs[i % inputs.size()];
+        run.measure([&]() {
+            if (classifyInput(input).kind == InputClassification::Url) ++urls;
+        });
+    }
+    QJsonObject json = run.result("classify");
+    json["urls"] = urls;
+    printResult(json);
+    return 0;
+}
+
+static int benchHistory(int iterations) {
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        qWarning() << "history: cannot create temporary directory";
+        return 1;
+    }
+    const QString path = dir.filePath("history.db");
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "bench_history_setup");
+        db.setDatabaseName(path);
+        db.open();
+        migrateBrowserSchema(db);
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("bench_history_setup");
+
+    // Queue sized so nothing is dropped; the URLs are built up front so only enqueue is timed
+    QStringList urls;
+    urls.reserve(iterations);
+    for (int i = 0; i < iterations; ++i) urls.append(benchUrl(i));
+
+    HistoryWriter writer(path, iterations, 1000);
+    writer.start();
+
+    BenchRun run(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        run.measure([&]() { writer.enqueue(urls[i]); });
+    }
+    QJsonObject json = run.result("history");
+
+    QElapsedTimer drain;
+    drain.start();
+    writer.shutdown();
+    json["drainMs"] = drain.nsecsElapsed() / 1e6;
+    json["written"] = double(writer.written());
+    json["dropped"] = double(writer.dropped());
+    printResult(json);
+    return 0;
+}
+
+static int benchTabCreate(int iterations) {
+    QWebEngineProfile profile;   // Off the record, like batch runs
+    TrackerBlocker blocker;
+    TrackerInterceptor interceptor(&blocker);
+    profile.setUrlRequestInterceptor(&interceptor);
+
+    std::vector<qint64> firstLoad;
+    firstLoad.reserve(iterations);
+
+    BenchRun run(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        QWebEngineView *view = nullptr;
+        // The synchronous part addNewTab pays for an unpooled tab
+        run.measure([&]() {
+            view = new QWebEngineView();
+            view->setPage(new QWebEnginePage(&profile, view));
+            WebViewPool::configure(view);
+        });
+
+        QElapsedTimer load;
+        load.start();
+        QEventLoop loop;
+        QObject::connect(view, &QWebEngineView::loadFinished, &loop, &QEventLoop::quit);
+        QTimer::singleShot(30000, &loop, &QEventLoop::quit);
+        view->setUrl(QUrl("about:blank"));
+        loop.exec();
+        firstLoad.push_back(load.nsecsElapsed());
+
+        delete view;
+    }
+    QJsonObject json = run.result("tab-create");
+    BenchRun::addPercentiles(json, "firstLoad", firstLoad);
+    printResult(json);
+
+    // Pages go before their profile
+    profile.setUrlRequestInterceptor(nullptr);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    return 0;
+}
+
+static int benchStyleSetup(int iterations) {
+    // The browser installs its theme before it builds any chrome
+    QString theme = Theme::apply(QString());
+
+    BenchRun run(iterations);
+    std::vector<qint64> construct;
+    std::vector<qint64> polish;
+    construct.reserve(size_t(iterations));
+    polish.reserve(size_t(iterations));
+    for (int i = 0; i < iterations; ++i) {
+        run.measure([&]() {
+            // A toolbar's worth of chrome: frame, search bar, a few buttons
+            QElapsedTimer phase;
+            phase.start();
+            GlassFrame frame;
+            GlassSearchBar *search = new GlassSearchBar(&frame);
+            GlassButton *back = new GlassButton("←", &frame);
+            GlassButton *forward = new GlassButton("→", &frame);
+            GlassButton *reload = new GlassButton("⟳", &frame);
+            construct.push_back(phase.nsecsElapsed());
+
+            phase.restart();
+            frame.ensurePolished();
+            search->ensurePolished();
+            back->ensurePolished();
+            forward->ensurePolished();
+            reload->ensurePolished();
+            polish.push_back(phase.nsecsElapsed());
+        });
+    }
+    QJsonObject json = run.result("style-setup");
+    BenchRun::addPercentiles(json, "construct", construct);
+    BenchRun::addPercentiles(json, "polish", polish);
+
+    // Runtime switching with a window's worth of chrome alive; the first
+    // round builds each theme's sheet, the rest reuse it
+    QWidget window;
+    GlassFrame *bar = new GlassFrame(&window);
+    new GlassSearchBar(bar);
+    for (int i = 0; i < 40; ++i) {
+        new GlassButton(QString::number(i), bar);
+    }
+    window.ensurePolished();
+    for (size_t i = 0; i < Theme::palettes().size(); ++i) {
+        theme = Theme::apply(Theme::next(theme));
+    }
+    std::vector<qint64> switches;
+    for (int i = 0; i < 20; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+        theme = Theme::apply(Theme::next(theme));
+        switches.push_back(timer.nsecsElapsed());
+    }
+    BenchRun::addPercentiles(json, "themeSwitch", switches);
+    json["themeSwitchWidgets"] = int(window.findChildren<QWidget*>().size());
+    printResult(json);
+    return 0;
+}
+
+/**
+ * Local stand-in for a search engine's suggestion endpoint: answers
+ * GET ...?q=<prefix> with OpenSearch JSON after a fixed delay.
+ */
+class OpenSearchStandIn : public QObject {
+public:
+    OpenSearchStandIn(int latencyMs, QObject *parent = nullptr)
+        : QObject(parent), latencyMs(latencyMs), server(new QTcpServer(this)) {
+        connect(server, &QTcpServer::newConnection, this, [this]() {
+            while (QTcpSocket *socket = server->nextPendingConnection()) {
+                serve(socket);
+            }
+        });
+    }
+
+    bool listen() { return server->listen(QHostAddress::LocalHost); }
+    void close() { server->close(); }
+    quint16 port() const { return server->serverPort(); }
+    int served() const { return answered; }
+
+private:
+    void serve(QTcpSocket *socket) {
+        auto request = std::make_shared<QByteArray>();
+        connect(socket, &QTcpSocket::readyRead, socket, [this, socket, request]() {
+            *request += socket->readAll();
+            if (!request->contains("\r\n\r\n")) return;
+            const QByteArray target = request->split(' ').value(1);
+            const QString prefix = QUrlQuery(QUrl(QString::fromLatin1(target)).query())
+                                       .queryItemValue("q", QUrl::FullyDecoded);
+            QJsonArray suggestions;
+            for (const char *suffix : {" one", " two", " three", " four"}) {
+                suggestions.append(prefix + suffix);
+            }
+            const QByteArray body = QJsonDocument(QJsonArray{prefix, suggestions}).toJson(QJsonDocument::Compact);
+
+            QPointer<QTcpSocket> guard(socket);
+            QTimer::singleShot(latencyMs, this, [this, guard, body]() {
+                if (!guard) return;
+                ++answered;
+                guard->write("HTTP/1.1 200 OK\r\nContent-Type: application/x-suggestions+json\r\n"
+                             "Content-Length: " + QByteArray::number(body.size()) + "\r\n"
+                             "Connection: close\r\n\r\n" + body);
+                guard->disconnectFromHost();
+            });
+        });
+        connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    }
+
+    int latencyMs;
+    QTcpServer *server;
+    int answered = 0;
+};
+
+static void waitMs(int ms) {
+    QEventLoop loop;
+    QTimer::singleShot(ms, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+static int benchSuggest(int iterations, int latencyMs) {
+    OpenSearchStandIn server(latencyMs);
+    if (!server.listen()) {
+        qWarning() << "suggest: cannot listen on localhost";
+        return 1;
+    }
+    const int debounceMs = 120;
+    SuggestionClient client(debounceMs, 256);
+    client.setEndpoint(QString("http://127.0.0.1:%1/complete?q={searchTerms}").arg(server.port()));
+
+    QString answeredPrefix;
+    QStringList answer;
+    QEventLoop waiting;
+    client.onSuggestions = [&](const QString &prefix, const QStringList &suggestions) {
+        answeredPrefix = prefix;
+        answer = suggestions;
+        waiting.quit();
+    };
+
+    // Nanoseconds until `text` is answered, or -1 after five seconds
+    auto waitForAnswer = [&](const QString &text) -> qint64 {
+        QElapsedTimer waited;
+        waited.start();
+        if (answeredPrefix != text) {
+            QTimer timeout;
+            timeout.setSingleShot(true);
+            QObject::connect(&timeout, &QTimer::timeout, &waiting, &QEventLoop::quit);
+            timeout.start(5000);
+            while (answeredPrefix != text && timeout.isActive()) waiting.exec();
+        }
+        return answeredPrefix == text ? waited.nsecsElapsed() : -1;
+    };
+
+    const QStringList queries = {
+        "weather berlin", "qt webengine", "c++ ranges", "sqlite wal", "rust borrow checker",
+        "chromium flags", "public suffix list", "opensearch", "http2 push", "linux perf",
+    };
+
+    // Keystrokes come faster than the debounce; returns last keystroke -> answer
+    auto type = [&](const QString &text) -> qint64 {
+        answeredPrefix.clear();
+        for (int length = 1; length <= text.size(); ++length) {
+            if (length > 1) waitMs(debounceMs / 3);
+            client.request(text.left(length));
+        }
+        return waitForAnswer(text);
+    };
+
+    std::vector<qint64> cold, cached;
+    BenchRun run(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        const QString query = queries[i % queries.size()] + (i >= queries.size() ? QString(" %1").arg(i) : QString());
+        run.measure([&]() {
+            qint64 ns = type(query);
+            if (ns >= 0) cold.push_back(ns);
+        });
+    }
+    QJsonObject json = run.result("suggest");
+    const SuggestionClient::Stats typing = client.stats();
+
+    // Same prefixes again: every answer should come from the cache
+    for (int i = 0; i < iterations; ++i) {
+        const QString query = queries[i % queries.size()] + (i >= queries.size() ? QString(" %1").arg(i) : QString());
+        qint64 ns = type(query);
+        if (ns >= 0) cached.push_back(ns);
+    }
+
+    // Server gone: one more letter, answered from the shorter cached prefix
+    server.close();
+    int offlineAnswered = 0;
+    for (int i = 0; i < qMin(iterations, int(queries.size())); ++i) {
+        const QString query = queries[i] + " o";
+        answeredPrefix.clear();
+        client.request(query);
+        if (waitForAnswer(query) >= 0 && !answer.isEmpty()) ++offlineAnswered;
+    }
+
+    json["latencyMs"] = latencyMs;
+    json["keystrokes"] = typing.keystrokes;
+    json["requests"] = typing.requests;
+    json["aborted"] = typing.aborted;
+    json["served"] = server.served();
+    json["cachedHits"] = client.stats().cacheHits - typing.cacheHits;
+    json["offlineAnswered"] = offlineAnswered;
+    BenchRun::addPercentiles(json, "answer", cold);
+    BenchRun::addPercentiles(json, "cachedAnswer", cached);
+    printResult(json);
+    return 0;
+}
+
+// Skewed synthetic vocabulary of 4096 words: a few very common, a long tail of rare ones
+static QString syntheticWord(quint32 &seed) {
+    static const char *const syllables[] = {
+        "ka", "lo", "mi", "ne", "ru", "sa", "ti", "vo", "xe", "zu", "bra", "cle", "dri", "fro", "gla", "pre",
+    };
+    seed = seed * 1103515245u + 12345u;
+    const quint32 draw = (seed >> 8) % 4096;
+    const quint32 rank = 1 + draw * draw / 4096;
+    QString word;
+    for (quint32 n = rank; n > 0; n /= 16) word += syllables[n % 16];
+    return word;
+}
+
+static int benchPageIndex(int iterations, int pageCount) {
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        qWarning() << "page-index: cannot create temporary directory";
+        return 1;
+    }
+    const QString path = dir.filePath("pages.db");
+
+    // Indexing goes through the same queue and writer thread as browsing
+    quint32 seed = 7;
+    QElapsedTimer indexing;
+    indexing.start();
+    {
+        PageTextIndex index(path, qint64(4) * 1024 * 1024 * 1024, 1024);
+        index.start();
+        for (int i = 0; i < pageCount; ++i) {
+            QStringList words;
+            for (int w = 0; w < 300; ++w) words.append(syntheticWord(seed));
+            const QString url = QString("https://site%1.example.com/article/%2").arg(i % 500).arg(i);
+            const QString title = words.mid(0, 6).join(' ');
+            while (!index.enqueue(url, title, words.join(' '))) QThread::msleep(1);
+        }
+        index.shutdown();
+        if (!index.available()) {
+            qWarning() << "page-index: SQLite has no FTS5";
+            return 1;
+        }
+    }
+    const qint64 indexingMs = indexing.elapsed();
+
+    // Two-word queries, the last word half typed, as the search page sends them
+    QStringList queries;
+    quint32 querySeed = 99;
+    for (int i = 0; i < iterations; ++i) {
+        QString last = syntheticWord(querySeed);
+        queries.append(syntheticWord(querySeed) + ' ' + last.left(qMax(3, last.size() - 2)));
+    }
+
+    qint64 hits = 0;
+    BenchRun run(iterations);
+    for (const QString &query : queries) {
+        run.measure([&]() { hits += PageTextIndex::search(path, query, 20).size(); });
+    }
+    QJsonObject json = run.result("page-index");
+    json["pages"] = pageCount;
+    json["indexingMs"] = double(indexingMs);
+    json["pagesPerSec"] = pageCount / qMax(0.001, indexingMs / 1000.0);
+    json["databaseBytes"] = double(QFileInfo(path).size());
+    json["resultsPerQuery"] = double(hits) / qMax(1, iterations);
+    printResult(json);
+    return 0;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char *argv[]) {
+    // No display and no GPU needed; explicit environment still wins
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    if (!qEnvironmentVariableIsSet("QTWEBENGINE_CHROMIUM_FLAGS")) {
+        qputenv("QTWEBENGINE_CHROMIUM_FLAGS", "--disable-gpu");
+    }
+    QApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
+    QApplication app(argc, argv);
+
+    QStringList selected = {"classify", "history", "tab-create", "style-setup", "suggest", "page-index"};
+    int iterations = 0;
+    int suggestLatencyMs = 80;
+    int indexPages = 20000;
+    for (const QString &arg : app.arguments()) {
+        if (arg.startsWith("--bench=")) {
+            selected = arg.mid(8).split(',', Qt::SkipEmptyParts);
+        } else if (arg.startsWith("--iterations=")) {
+            iterations = arg.mid(13).toInt();
+        } else if (arg.startsWith("--suggest-latency=")) {
+            suggestLatencyMs = qMax(0, arg.mid(18).toInt());
+        } else if (arg.startsWith("--index-pages=")) {
+            indexPages = qMax(1, arg.mid(14).toInt());
+        }
+    }
+
+    // Defaults keep each benchmark to a few seconds
+    auto count = [iterations](int fallback) { return iterations > 0 ? iterations : fallback; };
+    int status = 0;
+    for (const QString &name : selected) {
+        if (name == "classify") {
+            status |= benchClassify(count(200000));
+        } else if (name == "history") {
+            status |= benchHistory(count(50000));
+        } else if (name == "tab-create") {
+            status |= benchTabCreate(count(50));
+        } else if (name == "style-setup") {
+            status |= benchStyleSetup(count(2000));
+        } else if (name == "suggest") {
+            status |= benchSuggest(count(10), suggestLatencyMs);
+        } else if (name == "page-index") {
+            status |= benchPageIndex(count(200), indexPages);
+        } else {
+            qWarning() << "unknown benchmark" << name;
+            status = 1;
+        }
+    }
+    return status;
+}
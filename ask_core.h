@@ -0,0 +1,5766 @@
+/**
+ * ASK BROWSER - Core
+ *
+ * The parts of the browser that do not draw anything: history storage, tracker
+ * blocking, tab lifecycle and load scheduling, navigation timing, the omnibox
+ * index, the view pool, sessions, downloads and the ask:// pages. Shared by
+ * ask.cpp and the ask_bench microbenchmarks, so everything here is header-only.
+ */
+
+#ifndef ASK_CORE_H
+#define ASK_CORE_H
+
+#include <QCoreApplication>
+#include <QGuiApplication>
+#include <QWebEngineView>
+#include <QWebEngineHistory>
+#include <QWebEngineSettings>
+#include <QWebEngineProfile>
+#include <QWebEnginePage>
+#include <QWebEngineScript>
+#include <QWebEngineScriptCollection>
+#include <QWebEngineUrlRequestInterceptor>
+#include <QWebEngineUrlRequestInfo>
+#include <QWebEngineUrlSchemeHandler>
+#include <QWebEngineUrlRequestJob>
+#include <QWebEngineDownloadItem>
+#include <QWebEngineCookieStore>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QNetworkCookie>
+#include <QNetworkCookieJar>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QHostAddress>
+#include <QBuffer>
+#include <QDataStream>
+#include <QCryptographicHash>
+#include <QRegularExpression>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDateTime>
+#include <QMap>
+#include <QTimer>
+#include <QDebug>
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QPointer>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QSettings>
+#include <QSaveFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+#include "ask_public_suffix.h"
+
+// ============================================================================
+// DATABASE SCHEMA
+// ============================================================================
+
+static const int BrowserSchemaVersion = 5;
+
+/**
+ * Brings ask_browser_data.db up to BrowserSchemaVersion, one step per
+ * PRAGMA user_version. Version 0 is the original layout: a `history` row
+ * per visit with a text timestamp and no indices. Version 1 aggregates
+ * each URL once in `urls` and keeps a slim `visits` log keyed by url_id,
+ * with times stored as seconds since the epoch. Version 2 adds resumable
+ * downloads and their byte-range segments; version 3 their checksums;
+ * version 4 the web profile (workspace) each download was started from;
+ * version 5 whether a download's checksum was only scraped from the page.
+ * Serialized, so each worker that opens the database can call it first.
+ */
+inline bool migrateBrowserSchema(QSqlDatabase &db) {
+    static QMutex migrating;
+    QMutexLocker locker(&migrating);
+    QSqlQuery query(db);
+    query.exec("PRAGMA user_version");
+    const int version = query.next() ? query.value(0).toInt() : 0;
+    if (version >= BrowserSchemaVersion) {
+        return true;
+    }
+    
+    if (version < 1) {
+        const QStringList tables = db.tables();
+        const bool legacy = tables.contains("history");
+        if (tables.isEmpty()) {
+            // Only takes effect before the first table is created
+            query.exec("PRAGMA auto_vacuum=INCREMENTAL");
+        }
+        
+        const QStringList steps = {
+            R"(CREATE TABLE IF NOT EXISTS urls (
+                id INTEGER PRIMARY KEY,
+                url TEXT NOT NULL UNIQUE,
+                title TEXT,
+                visit_count INTEGER NOT NULL DEFAULT 0,
+                typed_count INTEGER NOT NULL DEFAULT 0,
+                last_visit INTEGER NOT NULL DEFAULT 0
+            ))",
+            "CREATE INDEX IF NOT EXISTS idx_urls_last_visit ON urls(last_visit)",
+            "CREATE INDEX IF NOT EXISTS idx_urls_visit_count ON urls(visit_count)",
+            R"(CREATE TABLE IF NOT EXISTS visits (
+                id INTEGER PRIMARY KEY,
+                url_id INTEGER NOT NULL REFERENCES urls(id),
+                visit_time INTEGER NOT NULL,
+                typed INTEGER NOT NULL DEFAULT 0
+            ))",
+            "CREATE INDEX IF NOT EXISTS idx_visits_time ON visits(visit_time)",
+            "CREATE INDEX IF NOT EXISTS idx_visits_url ON visits(url_id, visit_time)",
+            R"(CREATE TABLE IF NOT EXISTS bookmarks (
+                id INTEGER PRIMARY KEY AUTOINCREMENT,
+                url TEXT NOT NULL,
+                title TEXT,
+                folder TEXT DEFAULT 'General',
+                created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+            ))",
+            "CREATE INDEX IF NOT EXISTS idx_bookmarks_url ON bookmarks(url)"
+        };
+        const QStringList copyLegacy = {
+            R"(INSERT INTO urls (url, title, visit_count, last_visit)
+               SELECT url, MAX(title), COUNT(*),
+                      COALESCE(CAST(strftime('%s', MAX(visit_time)) AS INTEGER), 0)
+               FROM history GROUP BY url)",
+            R"(INSERT INTO visits (url_id, visit_time)
+               SELECT urls.id, COALESCE(CAST(strftime('%s', history.visit_time) AS INTEGER), 0)
+               FROM history JOIN urls ON urls.url = history.url
+               ORDER BY history.id)",
+            "DROP TABLE history"
+        };
+        
+        QElapsedTimer timer;
+        timer.start();
+        db.transaction();
+        bool ok = true;
+        for (const QString &step : legacy ? steps + copyLegacy : steps) {
+            ok = ok && query.exec(step);
+        }
+        ok = ok && query.exec("PRAGMA user_version = 1");
+        if (!ok || !db.commit()) {
+            qDebug() << "History migration failed:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+        
+        if (legacy) {
+            // One-off rewrite so retention can hand pages back incrementally
+            query.exec("PRAGMA auto_vacuum=INCREMENTAL");
+            query.exec("VACUUM");
+            qDebug() << "History migrated to schema 1 in" << timer.elapsed() << "ms";
+        }
+    }
+    
+    if (version < 2) {
+        db.transaction();
+        bool ok = query.exec(R"(
+            CREATE TABLE IF NOT EXISTS downloads (
+                id INTEGER PRIMARY KEY,
+                url TEXT NOT NULL,
+                path TEXT NOT NULL,
+                state TEXT NOT NULL,
+                total_bytes INTEGER NOT NULL DEFAULT -1,
+                validator TEXT,
+                created_at INTEGER NOT NULL
+            )
+        )");
+        ok = ok && query.exec(R"(
+            CREATE TABLE IF NOT EXISTS download_segments (
+                download_id INTEGER NOT NULL REFERENCES downloads(id),
+                first_byte INTEGER NOT NULL,
+                last_byte INTEGER NOT NULL,
+                done_bytes INTEGER NOT NULL,
+                PRIMARY KEY (download_id, first_byte)
+            )
+        )");
+        ok = ok && query.exec("PRAGMA user_version = 2");
+        if (!ok || !db.commit()) {
+            qDebug() << "Download schema migration failed:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+    }
+    
+    if (version < 3) {
+        // Expected checksum as "algorithm:hex", computed digests space-separated
+        db.transaction();
+        bool ok = query.exec("ALTER TABLE downloads ADD COLUMN checksum TEXT")
+               && query.exec("ALTER TABLE downloads ADD COLUMN digests TEXT")
+               && query.exec("PRAGMA user_version = 3");
+        if (!ok || !db.commit()) {
+            qDebug() << "Download checksum migration failed:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+    }
+    
+    if (version < 4) {
+        // Profile storage name, so a resumed download gets that workspace's cookies
+        db.transaction();
+        bool ok = query.exec("ALTER TABLE downloads ADD COLUMN profile TEXT")
+               && query.exec("PRAGMA user_version = 4");
+        if (!ok || !db.commit()) {
+            qDebug() << "Download profile migration failed:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+    }
+    
+    if (version < 5) {
+        // 1 when the page offered the checksum, so a mismatch only warns
+        db.transaction();
+        bool ok = query.exec("ALTER TABLE downloads ADD COLUMN checksum_advisory INTEGER NOT NULL DEFAULT 0")
+               && query.exec("PRAGMA user_version = 5");
+        if (!ok || !db.commit()) {
+            qDebug() << "Download checksum source migration failed:" << query.lastError().text();
+            db.rollback();
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// HISTORY WRITER
+// ============================================================================
+
+/**
+ * Persists visits on a dedicated thread with its own SQLite connection.
+ * The GUI thread only appends to a bounded in-memory queue; everything
+ * queued during one flush interval is written in a single WAL transaction,
+ * so urlChanged never waits on an fsync. When the queue is idle the same
+ * thread ages out old visits a few hundred rows at a time.
+ */
+class HistoryWriter : public QThread {
+public:
+    HistoryWriter(const QString &databasePath, int capacity = 4096,
+                  int flushIntervalMs = 1000, QObject *parent = nullptr)
+        : QThread(parent), databasePath(databasePath),
+          capacity(capacity), flushIntervalMs(flushIntervalMs) {}
+    
+    ~HistoryWriter() override {
+        shutdown();
+    }
+    
+    // Keep at most `days` of visits and `maxVisits` rows; call before start().
+    // URLs that lose their last visit go too, unless bookmarked.
+    void setRetention(int days, qint64 maxVisits) {
+        retentionDays = days;
+        retentionMaxVisits = maxVisits;
+    }
+    
+    // GUI thread entry point: never touches SQLite, only a short mutex.
+    bool enqueue(const QString &url, bool typed = false) {
+        QMutexLocker locker(&mutex);
+        if (stopping || url == lastQueuedUrl) {
+            return false;
+        }
+        if (pending.size() >= capacity) {
+            // Losing a visit is better than stalling the UI on a slow disk
+            ++droppedVisits;
+            wake.wakeOne();
+            return false;
+        }
+        lastQueuedUrl = url;
+        pending.append({url, QString(), QDateTime::currentSecsSinceEpoch(), typed, false});
+        // The first visit starts the flush interval; a half-full queue cuts it short
+        if (pending.size() == 1 || pending.size() >= capacity / 2) {
+            wake.wakeOne();
+        }
+        return true;
+    }
+    
+    // Titles ride the same queue so they land after the visit that made the row.
+    void enqueueTitle(const QString &url, const QString &title) {
+        QMutexLocker locker(&mutex);
+        if (stopping || pending.size() >= capacity) {
+            return;
+        }
+        pending.append({url, title, 0, false, true});
+        if (pending.size() == 1) {
+            wake.wakeOne();
+        }
+    }
+    
+    // Writes whatever is still queued, then joins the thread.
+    void shutdown() {
+        {
+            QMutexLocker locker(&mutex);
+            stopping = true;
+            wake.wakeOne();
+        }
+        wait();
+    }
+    
+    qint64 written() const { return writtenVisits.load(); }
+    qint64 dropped() const { return droppedVisits.load(); }
+    qint64 expired() const { return expiredVisits.load(); }
+
+protected:
+    void run() override {
+        const QString connectionName = "ask_history_writer";
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+            db.setDatabaseName(databasePath);
+            
+            if (db.open()) {
+                QSqlQuery pragma(db);
+                pragma.exec("PRAGMA journal_mode=WAL");
+                pragma.exec("PRAGMA synchronous=NORMAL");
+                pragma.exec("PRAGMA busy_timeout=2000");
+                migrateBrowserSchema(db);
+                writeLoop(db);
+                db.close();
+            } else {
+                qDebug() << "History writer error:" << db.lastError().text();
+                QMutexLocker locker(&mutex);
+                stopping = true;
+                pending.clear();
+            }
+        }
+        QSqlDatabase::removeDatabase(connectionName);
+    }
+
+private:
+    static const int RetentionChunk = 500;
+    static const int RetentionChunkSpacingMs = 50;
+    static const int RetentionFirstPassMs = 60 * 1000;
+    static const int RetentionIntervalMs = 6 * 60 * 60 * 1000;
+    
+    struct Visit {
+        QString url;
+        QString title;
+        qint64 visitTime;
+        bool typed;
+        bool titleOnly;
+    };
+    
+    void writeLoop(QSqlDatabase &db) {
+        QSqlQuery upsert(db);
+        upsert.prepare(R"(
+            INSERT INTO urls (url, visit_count, typed_count, last_visit) VALUES (?, 1, ?, ?)
+            ON CONFLICT(url) DO UPDATE SET
+                visit_count = visit_count + 1,
+                typed_count = typed_count + excluded.typed_count,
+                last_visit = MAX(last_visit, excluded.last_visit)
+        )");
+        QSqlQuery insert(db);
+        insert.prepare("INSERT INTO visits (url_id, visit_time, typed) SELECT id, ?, ? FROM urls WHERE url = ?");
+        QSqlQuery title(db);
+        title.prepare("UPDATE urls SET title = ? WHERE url = ?");
+        
+        QElapsedTimer sinceRetention;
+        sinceRetention.start();
+        qint64 nextRetentionMs = RetentionFirstPassMs;
+        
+        QVector<Visit> batch;
+        for (;;) {
+            bool retentionDue = false;
+            {
+                QMutexLocker locker(&mutex);
+                // enqueue() wakes us for new visits; the timeout only paces retention
+                while (!stopping && pending.isEmpty()) {
+                    if (retentionDays <= 0 && retentionMaxVisits <= 0) {
+                        wake.wait(&mutex);
+                        continue;
+                    }
+                    qint64 untilRetention = nextRetentionMs - sinceRetention.elapsed();
+                    if (untilRetention <= 0) {
+                        retentionDue = true;
+                        break;
+                    }
+                    wake.wait(&mutex, static_cast<unsigned long>(untilRetention));
+                }
+                if (!retentionDue) {
+                    // Let the rest of this interval's visits join the transaction
+                    if (!stopping && pending.size() < capacity / 2) {
+                        wake.wait(&mutex, flushIntervalMs);
+                    }
+                    if (pending.isEmpty() && stopping) {
+                        break;
+                    }
+                    batch.swap(pending);
+                }
+            }
+            
+            if (retentionDue) {
+                // Pending writes always win; the pass resumes once the queue drains
+                bool finished = retainChunk(db);
+                sinceRetention.restart();
+                nextRetentionMs = finished ? RetentionIntervalMs : RetentionChunkSpacingMs;
+                continue;
+            }
+            writeBatch(db, upsert, insert, title, batch);
+            batch.clear();
+        }
+    }
+    
+    void writeBatch(QSqlDatabase &db, QSqlQuery &upsert, QSqlQuery &insert,
+                    QSqlQuery &title, const QVector<Visit> &batch) {
+        int visits = 0;
+        db.transaction();
+        for (const Visit &visit : batch) {
+            if (visit.titleOnly) {
+                title.addBindValue(visit.title);
+                title.addBindValue(visit.url);
+                title.exec();
+                continue;
+            }
+            upsert.addBindValue(visit.url);
+            upsert.addBindValue(visit.typed ? 1 : 0);
+            upsert.addBindValue(visit.visitTime);
+            insert.addBindValue(visit.visitTime);
+            insert.addBindValue(visit.typed ? 1 : 0);
+            insert.addBindValue(visit.url);
+            if (!upsert.exec() || !insert.exec()) {
+                qDebug() << "History write error:" << upsert.lastError().text() << insert.lastError().text();
+            }
+            ++visits;
+        }
+        if (db.commit()) {
+            writtenVisits += visits;
+        } else {
+            qDebug() << "History commit error:" << db.lastError().text();
+            db.rollback();
+        }
+    }
+    
+    // One small transaction of the current retention pass; true when the pass is done.
+    bool retainChunk(QSqlDatabase &db) {
+        QSqlQuery query(db);
+        if (retentionCutoff < 0) {
+            retentionCutoff = retentionDays > 0
+                ? QDateTime::currentSecsSinceEpoch() - qint64(retentionDays) * 86400 : 0;
+            if (retentionMaxVisits > 0) {
+                // Time of the oldest visit that still fits under the row cap
+                query.prepare("SELECT visit_time FROM visits ORDER BY visit_time DESC LIMIT 1 OFFSET ?");
+                query.addBindValue(retentionMaxVisits - 1);
+                if (query.exec() && query.next()) {
+                    retentionCutoff = qMax(retentionCutoff, query.value(0).toLongLong());
+                }
+            }
+            passExpired = 0;
+        }
+        
+        query.prepare(R"(
+            DELETE FROM visits WHERE id IN (
+                SELECT id FROM visits WHERE visit_time < ? ORDER BY visit_time LIMIT ?
+            )
+        )");
+        query.addBindValue(retentionCutoff);
+        query.addBindValue(RetentionChunk);
+        if (!query.exec()) {
+            qDebug() << "History retention error:" << query.lastError().text();
+            retentionCutoff = -1;
+            return true;
+        }
+        int removed = query.numRowsAffected();
+        expiredVisits += removed;
+        passExpired += removed;
+        if (removed == RetentionChunk) {
+            return false;
+        }
+        
+        query.prepare(R"(
+            DELETE FROM urls WHERE id IN (
+                SELECT id FROM urls
+                WHERE last_visit < ? AND url NOT IN (SELECT url FROM bookmarks)
+                LIMIT ?
+            )
+        )");
+        query.addBindValue(retentionCutoff);
+        query.addBindValue(RetentionChunk);
+        if (query.exec() && query.numRowsAffected() == RetentionChunk) {
+            return false;
+        }
+        
+        query.exec("PRAGMA incremental_vacuum(1024)");
+        if (passExpired > 0) {
+            qDebug() << "History retention expired" << passExpired << "visits";
+        }
+        retentionCutoff = -1;
+        return true;
+    }
+    
+    QString databasePath;
+    int capacity;
+    int flushIntervalMs;
+    int retentionDays = 0;
+    qint64 retentionMaxVisits = 0;
+    qint64 retentionCutoff = -1;
+    qint64 passExpired = 0;
+    
+    QMutex mutex;
+    QWaitCondition wake;
+    QVector<Visit> pending;
+    QString lastQueuedUrl;
+    bool stopping = false;
+    
+    std::atomic<qint64> writtenVisits{0};
+    std::atomic<qint64> droppedVisits{0};
+    std::atomic<qint64> expiredVisits{0};
+};
+
+// ============================================================================
+// PAGE TEXT INDEX
+// ============================================================================
+
+/**
+ * Full-text index of what visited pages said, kept in its own SQLite file
+ * so the history database stays small. The GUI thread hands over extracted
+ * text through a bounded queue; this thread writes it in batched FTS5
+ * transactions and, once the stored text passes its byte budget, drops the
+ * pages indexed longest ago. search() ranks with BM25, titles weighted
+ * above body text, on a connection of the calling thread.
+ */
+class PageTextIndex : public QThread {
+public:
+    struct Result {
+        QString url;
+        QString title;
+        QString snippet;   // Matches wrapped in \x02 ... \x03
+        qint64 indexedAt = 0;
+    };
+    
+    static const int MaxPageChars = 65536;
+    
+    PageTextIndex(const QString &databasePath, qint64 maxBytes, int capacity = 64, QObject *parent = nullptr)
+        : QThread(parent), databasePath(databasePath), maxBytes(maxBytes), capacity(capacity) {}
+    
+    ~PageTextIndex() override {
+        shutdown();
+    }
+    
+    // Defines __askPageText(limit) in the application world: the text of the
+    // page's main content, found by walking text nodes (no layout, unlike
+    // innerText) and skipping navigation, scripts and other chrome
+    static QWebEngineScript extractorScript() {
+        QWebEngineScript script;
+        script.setName("ask-page-text");
+        script.setWorldId(QWebEngineScript::ApplicationWorld);
+        script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+        script.setRunsOnSubFrames(false);
+        script.setSourceCode(R"(
+            window.__askPageText = function (limit) {
+                var root = document.querySelector('article, main, [role=main]') || document.body;
+                if (!root) return '';
+                var skip = { SCRIPT: 1, STYLE: 1, NOSCRIPT: 1, TEMPLATE: 1, SVG: 1, NAV: 1,
+                             HEADER: 1, FOOTER: 1, ASIDE: 1, FORM: 1, BUTTON: 1, SELECT: 1 };
+                var walker = document.createTreeWalker(root, NodeFilter.SHOW_TEXT, {
+                    acceptNode: function (node) {
+                        for (var parent = node.parentNode; parent && parent !== root; parent = parent.parentNode) {
+                            if (skip[parent.nodeName.toUpperCase()]) return NodeFilter.FILTER_REJECT;
+                        }
+                        return node.nodeValue.trim() ? NodeFilter.FILTER_ACCEPT : NodeFilter.FILTER_SKIP;
+                    }
+                });
+                var parts = [];
+                var length = 0;
+                while (length < limit && walker.nextNode()) {
+                    var text = walker.currentNode.nodeValue.replace(/\s+/g, ' ').trim();
+                    parts.push(text);
+                    length += text.length + 1;
+                }
+                return parts.join(' ').slice(0, limit);
+            };
+        )");
+        return script;
+    }
+    
+    // GUI thread entry point; a page indexed again replaces its old text
+    bool enqueue(const QString &url, const QString &title, const QString &text) {
+        QMutexLocker locker(&mutex);
+        if (stopping) return false;
+        if (pending.size() >= capacity) {
+            ++droppedPages;
+            return false;
+        }
+        pending.append({url, title, text.left(MaxPageChars), QDateTime::currentSecsSinceEpoch()});
+        wake.wakeOne();
+        return true;
+    }
+    
+    void shutdown() {
+        {
+            QMutexLocker locker(&mutex);
+            stopping = true;
+            wake.wakeOne();
+        }
+        wait();
+    }
+    
+    qint64 indexed() const { return indexedPages.load(); }
+    qint64 dropped() const { return droppedPages.load(); }
+    qint64 evicted() const { return evictedPages.load(); }
+    bool available() const { return !unavailable.load(); }
+    
+    // Safe from any thread; best matches first
+    static QVector<Result> search(const QString &databasePath, const QString &text, int limit) {
+        QVector<Result> results;
+        const QString expression = matchExpression(text);
+        if (expression.isEmpty() || limit <= 0) return results;
+        
+        const QString connectionName = QString("ask_page_search_%1").arg(quintptr(QThread::currentThreadId()));
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+            db.setDatabaseName(databasePath);
+            db.setConnectOptions("QSQLITE_OPEN_READONLY");
+            if (db.open()) {
+                QSqlQuery query(db);
+                query.setForwardOnly(true);
+                query.prepare(R"(
+                    SELECT pages.url, pages.title, snippet(page_text, 1, char(2), char(3), '…', 16),
+                           pages.indexed_at
+                    FROM page_text JOIN pages ON pages.id = page_text.rowid
+                    WHERE page_text MATCH ?
+                    ORDER BY bm25(page_text, 4.0, 1.0)
+                    LIMIT ?
+                )");
+                query.addBindValue(expression);
+                query.addBindValue(limit);
+                if (query.exec()) {
+                    while (query.next()) {
+                        results.append({query.value(0).toString(), query.value(1).toString(),
+                                        query.value(2).toString(), query.value(3).toLongLong()});
+                    }
+                } else {
+                    qDebug() << "Page search error:" << query.lastError().text();
+                }
+                db.close();
+            }
+        }
+        QSqlDatabase::removeDatabase(connectionName);
+        return results;
+    }
+    
+    // Words become quoted FTS5 terms, all required; the last one may be half typed
+    static QString matchExpression(const QString &text) {
+        QStringList terms;
+        QString word;
+        auto flush = [&]() {
+            if (!word.isEmpty()) terms.append('"' + word + '"');
+            word.clear();
+        };
+        for (QChar c : text) {
+            if (c.isLetterOrNumber()) word.append(c);
+            else flush();
+        }
+        flush();
+        if (terms.isEmpty()) return QString();
+        terms.last().append('*');
+        return terms.join(' ');
+    }
+    
+protected:
+    void run() override {
+        const QString connectionName = "ask_page_indexer";
+        {
+            QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+            db.setDatabaseName(databasePath);
+            if (db.open() && ensureSchema(db)) {
+                writeLoop(db);
+            } else {
+                qDebug() << "Page index unavailable:" << db.lastError().text();
+                unavailable = true;
+                QMutexLocker locker(&mutex);
+                stopping = true;
+                pending.clear();
+            }
+            db.close();
+        }
+        QSqlDatabase::removeDatabase(connectionName);
+    }
+
+private:
+    static const int EvictionChunk = 200;
+    static const int BatchDelayMs = 500;
+    
+    struct Page {
+        QString url;
+        QString title;
+        QString text;
+        qint64 indexedAt;
+    };
+    
+    // Needs SQLite built with FTS5, as Qt's bundled copy is
+    static bool ensureSchema(QSqlDatabase &db) {
+        QSqlQuery query(db);
+        query.exec("PRAGMA journal_mode=WAL");
+        query.exec("PRAGMA synchronous=NORMAL");
+        query.exec("PRAGMA busy_timeout=2000");
+        const QStringList statements = {
+            R"(CREATE TABLE IF NOT EXISTS pages (
+                id INTEGER PRIMARY KEY,
+                url TEXT NOT NULL UNIQUE,
+                title TEXT,
+                indexed_at INTEGER NOT NULL,
+                bytes INTEGER NOT NULL
+            ))",
+            "CREATE INDEX IF NOT EXISTS idx_pages_indexed ON pages(indexed_at)",
+            "CREATE VIRTUAL TABLE IF NOT EXISTS page_text USING fts5(title, body, tokenize = 'unicode61 remove_diacritics 2')"
+        };
+        for (const QString &statement : statements) {
+            if (!query.exec(statement)) {
+                qDebug() << "Page index schema error:" << query.lastError().text();
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void writeLoop(QSqlDatabase &db) {
+        QSqlQuery total(db);
+        qint64 storedBytes = total.exec("SELECT COALESCE(SUM(bytes), 0) FROM pages") && total.next()
+            ? total.value(0).toLongLong() : 0;
+        
+        QVector<Page> batch;
+        for (;;) {
+            {
+                QMutexLocker locker(&mutex);
+                while (!stopping && pending.isEmpty()) {
+                    wake.wait(&mutex);
+                }
+                // Tabs often finish together; let their text share a transaction
+                if (!stopping && pending.size() < capacity / 2) {
+                    wake.wait(&mutex, BatchDelayMs);
+                }
+                if (pending.isEmpty() && stopping) {
+                    break;
+                }
+                batch.swap(pending);
+            }
+            storedBytes += writeBatch(db, batch);
+            batch.clear();
+            while (storedBytes > maxBytes) {
+                qint64 freed = evictOldest(db);
+                if (freed <= 0) break;
+                storedBytes -= freed;
+            }
+        }
+    }
+    
+    // Returns the change in stored bytes
+    qint64 writeBatch(QSqlDatabase &db, const QVector<Page> &batch) {
+        QSqlQuery find(db);
+        find.prepare("SELECT id, bytes FROM pages WHERE url = ?");
+        QSqlQuery update(db);
+        update.prepare("UPDATE pages SET title = ?, indexed_at = ?, bytes = ? WHERE id = ?");
+        QSqlQuery insert(db);
+        insert.prepare("INSERT INTO pages (url, title, indexed_at, bytes) VALUES (?, ?, ?, ?)");
+        QSqlQuery removeText(db);
+        removeText.prepare("DELETE FROM page_text WHERE rowid = ?");
+        QSqlQuery addText(db);
+        addText.prepare("INSERT INTO page_text (rowid, title, body) VALUES (?, ?, ?)");
+        
+        qint64 delta = 0;
+        int written = 0;
+        db.transaction();
+        for (const Page &page : batch) {
+            const qint64 bytes = page.text.size() * qint64(sizeof(QChar)) + page.title.size() * qint64(sizeof(QChar));
+            qint64 id = -1;
+            find.addBindValue(page.url);
+            if (find.exec() && find.next()) {
+                id = find.value(0).toLongLong();
+                delta -= find.value(1).toLongLong();
+                find.finish();
+                removeText.addBindValue(id);
+                removeText.exec();
+                update.addBindValue(page.title);
+                update.addBindValue(page.indexedAt);
+                update.addBindValue(bytes);
+                update.addBindValue(id);
+                update.exec();
+            } else {
+                find.finish();
+                insert.addBindValue(page.url);
+                insert.addBindValue(page.title);
+                insert.addBindValue(page.indexedAt);
+                insert.addBindValue(bytes);
+                if (insert.exec()) id = insert.lastInsertId().toLongLong();
+            }
+            if (id < 0) continue;
+            addText.addBindValue(id);
+            addText.addBindValue(page.title);
+            addText.addBindValue(page.text);
+            if (!addText.exec()) {
+                qDebug() << "Page index write error:" << addText.lastError().text();
+                continue;
+            }
+            delta += bytes;
+            ++written;
+        }
+        if (db.commit()) {
+            indexedPages += written;
+            return delta;
+        }
+        qDebug() << "Page index commit error:" << db.lastError().text();
+        db.rollback();
+        return 0;
+    }
+    
+    // One transaction of the oldest pages; returns the bytes it freed
+    qint64 evictOldest(QSqlDatabase &db) {
+        QSqlQuery oldest(db);
+        oldest.prepare("SELECT id, bytes FROM pages ORDER BY indexed_at LIMIT ?");
+        oldest.addBindValue(EvictionChunk);
+        if (!oldest.exec()) return 0;
+        QVector<QPair<qint64, qint64>> victims;
+        while (oldest.next()) victims.append({oldest.value(0).toLongLong(), oldest.value(1).toLongLong()});
+        if (victims.isEmpty()) return 0;
+        
+        QSqlQuery removeText(db);
+        removeText.prepare("DELETE FROM page_text WHERE rowid = ?");
+        QSqlQuery removePage(db);
+        removePage.prepare("DELETE FROM pages WHERE id = ?");
+        qint64 freed = 0;
+        db.transaction();
+        for (const auto &victim : victims) {
+            removeText.addBindValue(victim.first);
+            removePage.addBindValue(victim.first);
+            if (removeText.exec() && removePage.exec()) freed += victim.second;
+        }
+        if (!db.commit()) {
+            db.rollback();
+            return 0;
+        }
+        evictedPages += victims.size();
+        return freed;
+    }
+    
+    QString databasePath;
+    qint64 maxBytes;
+    int capacity;
+    
+    QMutex mutex;
+    QWaitCondition wake;
+    QVector<Page> pending;
+    bool stopping = false;
+    
+    std::atomic<qint64> indexedPages{0};
+    std::atomic<qint64> droppedPages{0};
+    std::atomic<qint64> evictedPages{0};
+    std::atomic<bool> unavailable{false};
+};
+
+// ============================================================================
+// TRACKER BLOCKING
+// ============================================================================
+
+/**
+ * Compiled EasyList-style filter list. Plain "||domain^" rules live in a
+ * hash set keyed by host suffix; every other rule contributes its longest
+ * literal to an Aho-Corasick automaton, so one pass over the URL yields the
+ * few candidate rules that need a full wildcard check. Immutable once
+ * built, which lets the request interceptor use it from any thread.
+ */
+class FilterMatcher {
+public:
+    enum ResourceType : quint16 {
+        Document       = 1 << 0,
+        Subdocument    = 1 << 1,
+        Stylesheet     = 1 << 2,
+        Script         = 1 << 3,
+        Image          = 1 << 4,
+        Font           = 1 << 5,
+        Object         = 1 << 6,
+        Media          = 1 << 7,
+        XmlHttpRequest = 1 << 8,
+        Ping           = 1 << 9,
+        Other          = 1 << 10,
+        // Blocking rules never apply to top-level documents unless asked to
+        AnyResource    = 0x07FE
+    };
+    
+    struct Request {
+        QByteArray url;          // lowercased, fully encoded
+        QByteArray host;
+        QByteArray documentUrl;
+        QByteArray documentHost;
+        bool thirdParty = false;
+        quint16 type = Other;
+    };
+    
+    static std::shared_ptr<FilterMatcher> compile(const QList<QByteArray> &lists) {
+        std::shared_ptr<FilterMatcher> matcher(new FilterMatcher());
+        for (const QByteArray &list : lists) {
+            for (const QByteArray &line : list.split('\n')) {
+                matcher->addRule(line.trimmed());
+            }
+        }
+        matcher->blocking.build();
+        matcher->exceptions.build();
+        return matcher;
+    }
+    
+    bool shouldBlock(const Request &request) const {
+        if (!blocking.matches(request.url, request.host, request.thirdParty, request.type)) {
+            return false;
+        }
+        if (exceptions.matches(request.url, request.host, request.thirdParty, request.type)) {
+            return false;
+        }
+        // "@@||site^$document" switches filtering off for everything the site loads
+        if (!request.documentUrl.isEmpty()
+            && exceptions.matches(request.documentUrl, request.documentHost, false, Document)) {
+            return false;
+        }
+        return true;
+    }
+    
+    int ruleCount() const { return int(blocking.rules.size() + exceptions.rules.size()); }
+    int skippedCount() const { return skippedRules; }
+    
+    size_t memoryFootprint() const {
+        return sizeof(*this) + blocking.memoryFootprint() + exceptions.memoryFootprint();
+    }
+    
+    static quint64 hashHost(const char *data, int size) {
+        quint64 hash = 14695981039346656037ULL;  // FNV-1a
+        for (int i = 0; i < size; ++i) {
+            hash ^= uchar(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+    
+    // Approximates eTLD+1 so first- and third-party requests can be told apart
+    static QByteArray registrableDomain(const QByteArray &host) {
+        int last = host.lastIndexOf('.');
+        if (last <= 0 || (host.at(host.size() - 1) >= '0' && host.at(host.size() - 1) <= '9')) {
+            return host;
+        }
+        int second = host.lastIndexOf('.', last - 1);
+        // Two-letter country code under a short label: "bbc.co.uk", "abc.com.au"
+        if (second > 0 && host.size() - last - 1 == 2 && last - second - 1 <= 3) {
+            second = host.lastIndexOf('.', second - 1);
+        }
+        return second < 0 ? host : host.mid(second + 1);
+    }
+
+private:
+    enum PartyRestriction : quint8 { AnyParty, ThirdPartyOnly, FirstPartyOnly };
+    
+    struct Rule {
+        QByteArray pattern;
+        quint16 types = AnyResource;
+        quint8 party = AnyParty;
+        bool hostAnchor = false;
+        bool startAnchor = false;
+        bool endAnchor = false;
+        int next = -1;  // next rule sharing the same domain or automaton state
+    };
+    
+    struct Node {
+        int fail = 0;
+        int dict = -1;   // nearest state on the failure chain that emits rules
+        int rule = -1;   // first rule whose literal ends in this state
+        int firstEdge = 0;
+        int edgeCount = 0;
+    };
+    
+    struct Edge {
+        uchar symbol;
+        int child;
+    };
+    
+    struct RuleSet {
+        std::vector<Rule> rules;
+        std::unordered_map<quint64, int> domains;
+        std::vector<Node> nodes;
+        std::vector<Edge> edges;
+        int rootNext[256];
+        
+        // Trie under construction: (state << 8 | symbol) -> state
+        std::unordered_map<quint64, int> pendingEdges;
+        
+        RuleSet() {
+            nodes.emplace_back();
+        }
+        
+        void addDomainRule(Rule &&rule) {
+            quint64 key = hashHost(rule.pattern.constData(), rule.pattern.size());
+            auto it = domains.find(key);
+            rule.next = it == domains.end() ? -1 : it->second;
+            rules.push_back(std::move(rule));
+            domains[key] = int(rules.size()) - 1;
+        }
+        
+        void addPatternRule(Rule &&rule, const QByteArray &literal) {
+            int state = 0;
+            for (char c : literal) {
+                quint64 key = (quint64(state) << 8) | uchar(c);
+                auto it = pendingEdges.find(key);
+                if (it == pendingEdges.end()) {
+                    nodes.emplace_back();
+                    state = pendingEdges[key] = int(nodes.size()) - 1;
+                } else {
+                    state = it->second;
+                }
+            }
+            rule.next = nodes[state].rule;
+            rules.push_back(std::move(rule));
+            nodes[state].rule = int(rules.size()) - 1;
+        }
+        
+        int child(int state, uchar symbol) const {
+            if (state == 0) return rootNext[symbol];
+            const Node &node = nodes[state];
+            for (int i = node.firstEdge; i < node.firstEdge + node.edgeCount; ++i) {
+                if (edges[i].symbol == symbol) return edges[i].child;
+            }
+            return -1;
+        }
+        
+        void build() {
+            // Flatten the trie into per-state edge ranges
+            std::vector<std::pair<quint64, int>> flat(pendingEdges.begin(), pendingEdges.end());
+            std::sort(flat.begin(), flat.end());
+            edges.reserve(flat.size());
+            for (const auto &entry : flat) {
+                int parent = int(entry.first >> 8);
+                if (nodes[parent].edgeCount == 0) {
+                    nodes[parent].firstEdge = int(edges.size());
+                }
+                ++nodes[parent].edgeCount;
+                edges.push_back({uchar(entry.first & 0xFF), entry.second});
+            }
+            std::unordered_map<quint64, int>().swap(pendingEdges);
+            
+            std::fill(std::begin(rootNext), std::end(rootNext), -1);
+            for (int i = 0; i < nodes[0].edgeCount; ++i) {
+                rootNext[edges[nodes[0].firstEdge + i].symbol] = edges[nodes[0].firstEdge + i].child;
+            }
+            
+            // Breadth-first failure and dictionary links
+            std::vector<int> queue;
+            queue.reserve(nodes.size());
+            queue.push_back(0);
+            for (size_t head = 0; head < queue.size(); ++head) {
+                int state = queue[head];
+                const Node &node = nodes[state];
+                for (int i = node.firstEdge; i < node.firstEdge + node.edgeCount; ++i) {
+                    int next = edges[i].child;
+                    int fallback = 0;
+                    if (state != 0) {
+                        int f = nodes[state].fail;
+                        while (f != 0 && child(f, edges[i].symbol) < 0) {
+                            f = nodes[f].fail;
+                        }
+                        fallback = qMax(child(f, edges[i].symbol), 0);
+                    }
+                    nodes[next].fail = fallback;
+                    nodes[next].dict = nodes[fallback].rule >= 0 ? fallback : nodes[fallback].dict;
+                    queue.push_back(next);
+                }
+            }
+            nodes.shrink_to_fit();
+            rules.shrink_to_fit();
+        }
+        
+        bool matches(const QByteArray &url, const QByteArray &host, bool thirdParty, quint16 type) const {
+            // Exact host and every parent domain: a.b.example.com, b.example.com, ...
+            if (!domains.empty()) {
+                const char *data = host.constData();
+                for (int start = 0; start < host.size();) {
+                    auto it = domains.find(hashHost(data + start, host.size() - start));
+                    if (it != domains.end()) {
+                        for (int r = it->second; r >= 0; r = rules[r].next) {
+                            if (optionsMatch(rules[r], thirdParty, type)) return true;
+                        }
+                    }
+                    int dot = host.indexOf('.', start);
+                    if (dot < 0) break;
+                    start = dot + 1;
+                }
+            }
+            
+            if (nodes.size() == 1) return false;
+            int state = 0;
+            for (char c : url) {
+                uchar symbol = uchar(c);
+                int next;
+                while ((next = child(state, symbol)) < 0 && state != 0) {
+                    state = nodes[state].fail;
+                }
+                state = qMax(next, 0);
+                for (int out = nodes[state].rule >= 0 ? state : nodes[state].dict; out >= 0; out = nodes[out].dict) {
+                    for (int r = nodes[out].rule; r >= 0; r = rules[r].next) {
+                        if (optionsMatch(rules[r], thirdParty, type) && patternMatches(rules[r], url, host)) {
+                            return true;
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+        
+        size_t memoryFootprint() const {
+            size_t bytes = rules.capacity() * sizeof(Rule)
+                         + nodes.capacity() * sizeof(Node)
+                         + edges.capacity() * sizeof(Edge)
+                         + domains.bucket_count() * sizeof(void *)
+                         + domains.size() * (sizeof(std::pair<const quint64, int>) + 2 * sizeof(void *));
+            for (const Rule &rule : rules) {
+                bytes += size_t(rule.pattern.capacity());
+            }
+            return bytes;
+        }
+    };
+    
+    static bool optionsMatch(const Rule &rule, bool thirdParty, quint16 type) {
+        if (!(rule.types & type)) return false;
+        if (rule.party == ThirdPartyOnly && !thirdParty) return false;
+        if (rule.party == FirstPartyOnly && thirdParty) return false;
+        return true;
+    }
+    
+    static bool isSeparator(char c) {
+        return !((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '.' || c == '%');
+    }
+    
+    // Wildcard match of [p, pe) at s: '*' is any run, '^' a separator or the end
+    static bool matchAt(const char *p, const char *pe, const char *s, const char *se, bool endAnchor) {
+        const char *starP = nullptr;
+        const char *starS = nullptr;
+        for (;;) {
+            if (p == pe) {
+                if (!endAnchor || s == se) return true;
+            } else if (*p == '*') {
+                starP = ++p;
+                starS = s;
+                continue;
+            } else if (s < se && (*p == '^' ? isSeparator(*s) : *p == *s)) {
+                ++p;
+                ++s;
+                continue;
+            } else if (*p == '^' && s == se) {
+                ++p;
+                continue;
+            }
+            if (!starP || starS >= se) return false;
+            p = starP;
+            s = ++starS;
+        }
+    }
+    
+    static bool patternMatches(const Rule &rule, const QByteArray &url, const QByteArray &host) {
+        const char *p = rule.pattern.constData();
+        const char *pe = p + rule.pattern.size();
+        const char *s = url.constData();
+        const char *se = s + url.size();
+        
+        if (rule.startAnchor) {
+            return matchAt(p, pe, s, se, rule.endAnchor);
+        }
+        if (rule.hostAnchor) {
+            // Must start at the host or at one of its label boundaries
+            int hostStart = url.indexOf("://");
+            hostStart = hostStart < 0 ? 0 : hostStart + 3;
+            for (int i = hostStart; i < hostStart + host.size() && i < url.size(); ++i) {
+                if ((i == hostStart || s[i - 1] == '.') && matchAt(p, pe, s + i, se, rule.endAnchor)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        for (const char *start = s; start <= se; ++start) {
+            if (matchAt(p, pe, start, se, rule.endAnchor)) return true;
+        }
+        return false;
+    }
+    
+    static bool parseOptions(const QByteArray &options, Rule &rule) {
+        quint16 include = 0;
+        quint16 exclude = 0;
+        for (const QByteArray &raw : options.split(',')) {
+            bool negated = raw.startsWith('~');
+            QByteArray option = negated ? raw.mid(1) : raw;
+            quint16 type = 0;
+            
+            if (option == "third-party" || option == "3p") {
+                rule.party = negated ? FirstPartyOnly : ThirdPartyOnly;
+                continue;
+            } else if (option == "first-party" || option == "1p") {
+                rule.party = negated ? ThirdPartyOnly : FirstPartyOnly;
+                continue;
+            } else if (option == "match-case" || option == "important") {
+                continue;
+            } else if (option == "script") type = Script;
+            else if (option == "image") type = Image;
+            else if (option == "stylesheet" || option == "css") type = Stylesheet;
+            else if (option == "subdocument" || option == "frame") type = Subdocument;
+            else if (option == "xmlhttprequest" || option == "xhr") type = XmlHttpRequest;
+            else if (option == "font") type = Font;
+            else if (option == "media") type = Media;
+            else if (option == "object") type = Object;
+            else if (option == "ping") type = Ping;
+            else if (option == "other") type = Other;
+            else if (option == "document" || option == "doc") type = Document;
+            else return false;  // domain=, csp=, redirect=, ... are not supported
+            
+            if (negated) exclude |= type;
+            else include |= type;
+        }
+        if (include) rule.types = include;
+        rule.types &= ~exclude;
+        return rule.types != 0;
+    }
+    
+    void addRule(QByteArray line) {
+        if (line.isEmpty() || line.startsWith('!') || line.startsWith('[')) {
+            return;
+        }
+        // Cosmetic and scriptlet rules only matter to content scripts
+        if (line.contains("##") || line.contains("#@#") || line.contains("#?#") || line.contains("#$#")) {
+            ++skippedRules;
+            return;
+        }
+        
+        bool exception = line.startsWith("@@");
+        if (exception) line = line.mid(2);
+        
+        if (line.size() > 1 && line.startsWith('/') && line.endsWith('/')) {
+            ++skippedRules;  // Regular expression rules
+            return;
+        }
+        
+        Rule rule;
+        int dollar = line.lastIndexOf('$');
+        if (dollar >= 0) {
+            if (!parseOptions(line.mid(dollar + 1).toLower(), rule)) {
+                ++skippedRules;
+                return;
+            }
+            line.truncate(dollar);
+        }
+        line = line.toLower();
+        
+        if (line.startsWith("||")) {
+            rule.hostAnchor = true;
+            line = line.mid(2);
+        } else if (line.startsWith('|')) {
+            rule.startAnchor = true;
+            line = line.mid(1);
+        }
+        if (line.endsWith('|')) {
+            rule.endAnchor = true;
+            line.chop(1);
+        }
+        while (line.startsWith('*') && !rule.hostAnchor) {
+            line = line.mid(1);
+            rule.startAnchor = false;
+        }
+        while (line.endsWith('*')) {
+            line.chop(1);
+            rule.endAnchor = false;
+        }
+        
+        RuleSet &set = exception ? exceptions : blocking;
+        
+        // "||tracker.example^" is a pure host rule
+        QByteArray domain = line.endsWith('^') ? line.left(line.size() - 1) : QByteArray();
+        if (rule.hostAnchor && !rule.endAnchor && !domain.isEmpty() && isPlainHost(domain)) {
+            rule.pattern = domain;
+            set.addDomainRule(std::move(rule));
+            return;
+        }
+        
+        QByteArray literal = longestLiteral(line);
+        if (literal.size() < 3) {
+            ++skippedRules;  // Would match nearly every URL and defeat the automaton
+            return;
+        }
+        rule.pattern = line;
+        set.addPatternRule(std::move(rule), literal);
+    }
+    
+    static bool isPlainHost(const QByteArray &text) {
+        for (char c : text) {
+            if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '-')) return false;
+        }
+        return true;
+    }
+    
+    static QByteArray longestLiteral(const QByteArray &pattern) {
+        int bestStart = 0;
+        int bestLength = 0;
+        int start = 0;
+        for (int i = 0; i <= pattern.size(); ++i) {
+            if (i == pattern.size() || pattern.at(i) == '*' || pattern.at(i) == '^') {
+                if (i - start > bestLength) {
+                    bestStart = start;
+                    bestLength = i - start;
+                }
+                start = i + 1;
+            }
+        }
+        return pattern.mid(bestStart, bestLength);
+    }
+    
+    FilterMatcher() = default;
+    
+    RuleSet blocking;
+    RuleSet exceptions;
+    int skippedRules = 0;
+};
+
+// Small default list so blocking works before any EasyList file is installed
+static const char *builtinFilterList = R"(
+||doubleclick.net^
+||googlesyndication.com^
+||google-analytics.com^
+||googletagmanager.com^
+||googleadservices.com^
+||adservice.google.com^
+||amazon-adsystem.com^
+||adnxs.com^
+||adsrvr.org^
+||criteo.com^
+||criteo.net^
+||taboola.com^
+||outbrain.com^
+||scorecardresearch.com^
+||quantserve.com^
+||hotjar.com^
+||moatads.com^
+||pubmatic.com^
+||rubiconproject.com^
+||openx.net^
+||casalemedia.com^
+||bluekai.com^
+||krxd.net^
+||mixpanel.com^$third-party
+||connect.facebook.net^$third-party
+||facebook.com/tr^
+/pagead/js/adsbygoogle.
+)";
+
+/**
+ * Owns the compiled matcher shared by every tab's interceptor and the
+ * browser-wide blocked total. Filter lists are compiled on a worker thread
+ * and swapped in atomically; until then requests simply pass through.
+ */
+class TrackerBlocker : public QObject {
+public:
+    explicit TrackerBlocker(QObject *parent = nullptr) : QObject(parent) {}
+    
+    ~TrackerBlocker() override {
+        if (loader) loader->wait();
+    }
+    
+    // Called on the GUI thread, at most once per event loop pass
+    std::function<void()> onBlocked;
+    
+    void loadFilterLists(const QString &directory) {
+        loader = QThread::create([this, directory]() {
+            QList<QByteArray> lists;
+            lists << QByteArray(builtinFilterList);
+            
+            const QFileInfoList files = QDir(directory).entryInfoList({"*.txt"}, QDir::Files);
+            for (const QFileInfo &info : files) {
+                QFile file(info.filePath());
+                if (file.open(QIODevice::ReadOnly)) {
+                    lists << file.readAll();
+                }
+            }
+            
+            QElapsedTimer timer;
+            timer.start();
+            std::shared_ptr<const FilterMatcher> compiled = FilterMatcher::compile(lists);
+            qDebug() << "Filter lists compiled:" << compiled->ruleCount() << "rules,"
+                     << compiled->skippedCount() << "skipped," << timer.elapsed() << "ms";
+            std::atomic_store(&current, compiled);
+        });
+        connect(loader, &QThread::finished, loader, &QObject::deleteLater);
+        loader->start(QThread::LowPriority);
+    }
+    
+    std::shared_ptr<const FilterMatcher> matcher() const {
+        return std::atomic_load(&current);
+    }
+    
+    // May run on any thread
+    void recordBlocked() {
+        ++totalBlocked;
+        if (!notifyQueued.exchange(true)) {
+            QMetaObject::invokeMethod(this, [this]() {
+                notifyQueued = false;
+                if (onBlocked) onBlocked();
+            }, Qt::QueuedConnection);
+        }
+    }
+    
+    qint64 total() const { return totalBlocked.load(); }
+
+private:
+    QPointer<QThread> loader;
+    std::shared_ptr<const FilterMatcher> current;
+    std::atomic<qint64> totalBlocked{0};
+    std::atomic<bool> notifyQueued{false};
+};
+
+/**
+ * Per-tab request interceptor. Installed on each page rather than only on
+ * the profile, because QWebEngineUrlRequestInfo does not say which page a
+ * request belongs to and the status bar shows per-tab totals.
+ */
+class TrackerInterceptor : public QWebEngineUrlRequestInterceptor {
+public:
+    TrackerInterceptor(TrackerBlocker *blocker, QObject *parent = nullptr)
+        : QWebEngineUrlRequestInterceptor(parent), blocker(blocker) {}
+    
+    void interceptRequest(QWebEngineUrlRequestInfo &info) override {
+        if (info.resourceType() == QWebEngineUrlRequestInfo::ResourceTypeMainFrame) {
+            return;
+        }
+        std::shared_ptr<const FilterMatcher> matcher = blocker->matcher();
+        if (!matcher) {
+            return;
+        }
+        
+        const QUrl url = info.requestUrl();
+        const QString scheme = url.scheme();
+        if (scheme != "http" && scheme != "https" && scheme != "ws" && scheme != "wss") {
+            return;
+        }
+        
+        FilterMatcher::Request request;
+        request.url = url.toEncoded().toLower();
+        request.host = url.host(QUrl::FullyEncoded).toLatin1().toLower();
+        const QUrl document = info.firstPartyUrl();
+        request.documentUrl = document.toEncoded().toLower();
+        request.documentHost = document.host(QUrl::FullyEncoded).toLatin1().toLower();
+        request.thirdParty = FilterMatcher::registrableDomain(request.host)
+                          != FilterMatcher::registrableDomain(request.documentHost);
+        request.type = resourceType(info.resourceType());
+        
+        if (matcher->shouldBlock(request)) {
+            info.block(true);
+            ++blockedRequests;
+            blocker->recordBlocked();
+        }
+    }
+    
+    int blocked() const { return blockedRequests.load(); }
+
+private:
+    static quint16 resourceType(QWebEngineUrlRequestInfo::ResourceType type) {
+        switch (type) {
+        case QWebEngineUrlRequestInfo::ResourceTypeSubFrame:    return FilterMatcher::Subdocument;
+        case QWebEngineUrlRequestInfo::ResourceTypeStylesheet:  return FilterMatcher::Stylesheet;
+        case QWebEngineUrlRequestInfo::ResourceTypeScript:      return FilterMatcher::Script;
+        case QWebEngineUrlRequestInfo::ResourceTypeImage:
+        case QWebEngineUrlRequestInfo::ResourceTypeFavicon:     return FilterMatcher::Image;
+        case QWebEngineUrlRequestInfo::ResourceTypeFontResource: return FilterMatcher::Font;
+        case QWebEngineUrlRequestInfo::ResourceTypeMedia:       return FilterMatcher::Media;
+        case QWebEngineUrlRequestInfo::ResourceTypeObject:
+        case QWebEngineUrlRequestInfo::ResourceTypePluginResource: return FilterMatcher::Object;
+        case QWebEngineUrlRequestInfo::ResourceTypeXhr:         return FilterMatcher::XmlHttpRequest;
+        case QWebEngineUrlRequestInfo::ResourceTypePing:
+        case QWebEngineUrlRequestInfo::ResourceTypeCspReport:   return FilterMatcher::Ping;
+        default:                                                return FilterMatcher::Other;
+        }
+    }
+    
+    TrackerBlocker *blocker;
+    std::atomic<int> blockedRequests{0};
+};
+
+// ============================================================================
+// PROCESS SAMPLER
+// ============================================================================
+
+/**
+ * Samples memory and CPU of the browser process and every QtWebEngineProcess
+ * below it from /proc, on a worker thread. The rate adapts: fast while the
+ * numbers move or the task manager is open, slow when things are steady or
+ * the browser is in the background. Renderer PIDs are mapped back to tabs
+ * through QWebEnginePage::renderProcessPid().
+ */
+class ProcessSampler : public QObject {
+public:
+    struct Process {
+        qint64 pid = 0;
+        qint64 parentPid = 0;
+        QString type;
+        qint64 residentKb = 0;
+        qint64 proportionalKb = 0;
+        double cpuPercent = 0;
+    };
+    
+    struct TabUsage {
+        QPointer<QWebEngineView> view;
+        qint64 pid = 0;
+        qint64 memoryKb = 0;
+        double cpuPercent = 0;
+        int sharedWith = 1;
+    };
+    
+    explicit ProcessSampler(QObject *parent = nullptr) : QObject(parent) {
+        workerThread = new QThread(this);
+        worker = new QObject();
+        worker->moveToThread(workerThread);
+        connect(workerThread, &QThread::finished, worker, &QObject::deleteLater);
+        workerThread->start(QThread::LowestPriority);
+        
+        timer = new QTimer(this);
+        timer->setSingleShot(true);
+        connect(timer, &QTimer::timeout, this, &ProcessSampler::sampleNow);
+        timer->start(1000);
+    }
+    
+    ~ProcessSampler() override {
+        workerThread->quit();
+        workerThread->wait();
+    }
+    
+    // Supplies the views to attribute renderer processes to
+    std::function<QList<QWebEngineView*>()> tabViews;
+    // Called on the GUI thread after every sample
+    std::function<void()> onSample;
+    
+    const QVector<Process> &processes() const { return latest; }
+    const QVector<TabUsage> &tabUsage() const { return tabs; }
+    qint64 totalKb() const { return totalMemoryKb; }
+    double totalCpu() const { return totalCpuPercent; }
+    
+    // Proportional set size where the kernel provides it, else RSS
+    qint64 memoryKb(qint64 pid) const {
+        int index = indexByPid.value(pid, -1);
+        if (index < 0) return residentKb(pid);
+        const Process &process = latest[index];
+        return process.proportionalKb > 0 ? process.proportionalKb : process.residentKb;
+    }
+    
+    // Sample at the fastest rate, e.g. while the task manager is visible
+    void setWatched(bool watched) {
+        this->watched = watched;
+        if (watched && !sampling) {
+            timer->start(0);
+        }
+    }
+    
+    void sampleNow() {
+        if (sampling) return;
+        sampling = true;
+        
+        QHash<qint64, QList<QPointer<QWebEngineView>>> renderers;
+        if (tabViews) {
+            for (QWebEngineView *view : tabViews()) {
+                qint64 pid = view->page()->renderProcessPid();
+                if (pid > 0) renderers[pid].append(view);
+            }
+        }
+        
+        QMetaObject::invokeMethod(worker, [this, renderers]() {
+            QVector<Process> sample = collect();
+            QMetaObject::invokeMethod(this, [this, sample, renderers]() {
+                publish(sample, renderers);
+            }, Qt::QueuedConnection);
+        }, Qt::QueuedConnection);
+    }
+    
+    static qint64 residentKb(qint64 pid) {
+        QFile status(QString("/proc/%1/status").arg(pid));
+        if (!status.open(QIODevice::ReadOnly)) return 0;
+        for (const QByteArray &line : status.readAll().split('\n')) {
+            if (line.startsWith("VmRSS:")) {
+                return line.mid(6).trimmed().split(' ').value(0).toLongLong();
+            }
+        }
+        return 0;
+    }
+
+private:
+    static QByteArray readProcFile(qint64 pid, const char *name) {
+        QFile file(QString("/proc/%1/%2").arg(pid).arg(name));
+        return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+    }
+    
+    // Fields after the "(comm)" entry of /proc/<pid>/stat, starting at "state"
+    static QList<QByteArray> statFields(qint64 pid) {
+        QByteArray stat = readProcFile(pid, "stat");
+        int close = stat.lastIndexOf(')');
+        return close < 0 ? QList<QByteArray>() : stat.mid(close + 2).split(' ');
+    }
+    
+    static QString processType(qint64 pid, qint64 browserPid) {
+        if (pid == browserPid) return "Browser";
+        for (const QByteArray &arg : readProcFile(pid, "cmdline").split('\0')) {
+            if (arg.startsWith("--type=")) {
+                QByteArray type = arg.mid(7);
+                if (type == "renderer") return "Renderer";
+                if (type == "gpu-process") return "GPU";
+                if (type == "utility") return "Utility";
+                if (type == "zygote") return "Zygote";
+                return QString::fromLatin1(type);
+            }
+        }
+        return "Helper";
+    }
+    
+    // Worker thread only
+    QVector<Process> collect() {
+        QVector<Process> result;
+#ifdef Q_OS_LINUX
+        const qint64 browserPid = QCoreApplication::applicationPid();
+        static const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+        static const long pageKb = sysconf(_SC_PAGESIZE) / 1024;
+        
+        // Parent links for every process, then everything below the browser
+        QHash<qint64, QList<qint64>> children;
+        QHash<qint64, QList<QByteArray>> stats;
+        const QStringList entries = QDir("/proc").entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+        for (const QString &entry : entries) {
+            bool ok = false;
+            qint64 pid = entry.toLongLong(&ok);
+            if (!ok) continue;
+            QList<QByteArray> fields = statFields(pid);
+            if (fields.size() < 20) continue;
+            children[fields.at(1).toLongLong()].append(pid);
+            stats.insert(pid, fields);
+        }
+        
+        QList<qint64> tree{browserPid};
+        for (int i = 0; i < tree.size(); ++i) {
+            tree += children.value(tree.at(i));
+        }
+        
+        const qint64 now = cpuClock.isValid() ? cpuClock.nsecsElapsed() : 0;
+        if (!cpuClock.isValid()) cpuClock.start();
+        const double wallSeconds = (now - previousSampleNs) / 1e9;
+        QHash<QPair<qint64, qint64>, qint64> cpuTicks;
+        
+        for (qint64 pid : tree) {
+            const QList<QByteArray> &fields = stats[pid];
+            if (fields.isEmpty()) continue;
+            
+            Process process;
+            process.pid = pid;
+            process.parentPid = fields.at(1).toLongLong();
+            process.type = processType(pid, browserPid);
+            process.residentKb = readProcFile(pid, "statm").split(' ').value(1).toLongLong() * pageKb;
+            for (const QByteArray &line : readProcFile(pid, "smaps_rollup").split('\n')) {
+                if (line.startsWith("Pss:")) {
+                    process.proportionalKb = line.mid(4).trimmed().split(' ').value(0).toLongLong();
+                    break;
+                }
+            }
+            
+            // Keyed by start time as well, so a recycled PID starts from zero
+            QPair<qint64, qint64> key(pid, fields.at(19).toLongLong());
+            qint64 ticks = fields.at(11).toLongLong() + fields.at(12).toLongLong();
+            cpuTicks.insert(key, ticks);
+            if (previousCpuTicks.contains(key) && wallSeconds > 0) {
+                process.cpuPercent = 100.0 * (ticks - previousCpuTicks.value(key))
+                                   / ticksPerSecond / wallSeconds;
+            }
+            result.append(process);
+        }
+        previousCpuTicks.swap(cpuTicks);
+        previousSampleNs = now;
+#endif
+        return result;
+    }
+    
+    void publish(const QVector<Process> &sample, const QHash<qint64, QList<QPointer<QWebEngineView>>> &renderers) {
+        const qint64 previousTotalKb = totalMemoryKb;
+        latest = sample;
+        indexByPid.clear();
+        totalMemoryKb = 0;
+        totalCpuPercent = 0;
+        for (int i = 0; i < latest.size(); ++i) {
+            indexByPid.insert(latest[i].pid, i);
+            totalMemoryKb += latest[i].proportionalKb > 0 ? latest[i].proportionalKb : latest[i].residentKb;
+            totalCpuPercent += latest[i].cpuPercent;
+        }
+        
+        tabs.clear();
+        for (auto it = renderers.constBegin(); it != renderers.constEnd(); ++it) {
+            int index = indexByPid.value(it.key(), -1);
+            for (const QPointer<QWebEngineView> &view : it.value()) {
+                if (!view) continue;
+                TabUsage usage;
+                usage.view = view;
+                usage.pid = it.key();
+                usage.sharedWith = it.value().size();
+                if (index >= 0) {
+                    usage.memoryKb = memoryKb(it.key()) / usage.sharedWith;
+                    usage.cpuPercent = latest[index].cpuPercent / usage.sharedWith;
+                }
+                tabs.append(usage);
+            }
+        }
+        
+        // Adaptive rate: 2 s while things move, backing off to 8 s when
+        // steady and 15 s while another application has focus
+        const double change = qAbs(totalMemoryKb - previousTotalKb) / double(qMax<qint64>(previousTotalKb, 1));
+        if (watched) {
+            intervalMs = 1000;
+        } else if (QGuiApplication::applicationState() != Qt::ApplicationActive) {
+            intervalMs = 15000;
+        } else if (change > 0.05 || totalCpuPercent > 25) {
+            intervalMs = 2000;
+        } else {
+            intervalMs = qMin(intervalMs * 2, 8000);
+        }
+        sampling = false;
+        timer->start(intervalMs);
+        
+        if (onSample) onSample();
+    }
+    
+    QThread *workerThread;
+    QObject *worker;
+    QTimer *timer;
+    bool sampling = false;
+    bool watched = false;
+    int intervalMs = 2000;
+    
+    QVector<Process> latest;
+    QHash<qint64, int> indexByPid;
+    QVector<TabUsage> tabs;
+    qint64 totalMemoryKb = 0;
+    double totalCpuPercent = 0;
+    
+    // Owned by the worker thread
+    QElapsedTimer cpuClock;
+    qint64 previousSampleNs = 0;
+    QHash<QPair<qint64, qint64>, qint64> previousCpuTicks;
+};
+
+// ============================================================================
+// TAB LIFECYCLE
+// ============================================================================
+
+/**
+ * Moves background tabs down QWebEnginePage's lifecycle: Frozen after a
+ * short idle period, Discarded after a long one, and least recently used
+ * first whenever renderer memory goes over the budget. The selected tab,
+ * pinned tabs and tabs playing audio are never touched. A discarded page
+ * reloads when it is made Active again on selection. Tabs of a workspace
+ * that is switched away from are frozen at once and woken on its return.
+ */
+class TabLifecycleManager : public QObject {
+public:
+    explicit TabLifecycleManager(ProcessSampler *sampler, QObject *parent = nullptr)
+        : QObject(parent), sampler(sampler) {
+        QSettings settings("ASK", "Browser");
+        freezeAfterMs = settings.value("lifecycle/freezeAfterSeconds", 300).toLongLong() * 1000;
+        discardAfterMs = settings.value("lifecycle/discardAfterSeconds", 3600).toLongLong() * 1000;
+        memoryBudgetKb = settings.value("lifecycle/memoryBudgetMB", 2048).toLongLong() * 1024;
+        
+        QTimer *timer = new QTimer(this);
+        connect(timer, &QTimer::timeout, this, &TabLifecycleManager::enforce);
+        timer->start(15000);
+    }
+    
+    void track(QWebEngineView *view) {
+        if (records.contains(view)) return;
+        records[view].lastActive = QDateTime::currentMSecsSinceEpoch();
+        connect(view, &QObject::destroyed, this, [this, view]() {
+            records.remove(view);
+        });
+    }
+    
+    // Called whenever the selected tab changes
+    void activated(QWebEngineView *view) {
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        if (current && records.contains(current.data())) {
+            records[current.data()].lastActive = now;
+        }
+        current = view;
+        if (!view) return;
+        
+        track(view);
+        records[view].lastActive = now;
+        if (view->page()->lifecycleState() != QWebEnginePage::LifecycleState::Active) {
+            view->page()->setLifecycleState(QWebEnginePage::LifecycleState::Active);
+        }
+    }
+    
+    void setPinned(QWebEngineView *view, bool pinned) {
+        track(view);
+        records[view].pinned = pinned;
+    }
+    
+    bool isPinned(QWebEngineView *view) const {
+        return records.value(view).pinned;
+    }
+    
+    // A workspace was hidden: freeze its tabs straight away instead of
+    // waiting out the idle period. Returns whether the page was frozen.
+    bool suspend(QWebEngineView *view) {
+        track(view);
+        Record &record = records[view];
+        if (record.pinned || view->page()->recentlyAudible()) return false;
+        record.suspended = lower(view->page(), QWebEnginePage::LifecycleState::Frozen);
+        return record.suspended;
+    }
+    
+    // Its workspace is back: wakes only what suspend() froze, so tabs the
+    // idle timer froze or discarded in the meantime stay where they are
+    bool resume(QWebEngineView *view) {
+        auto it = records.find(view);
+        if (it == records.end() || !it->suspended) return false;
+        it->suspended = false;
+        if (view->page()->lifecycleState() != QWebEnginePage::LifecycleState::Frozen) return false;
+        view->page()->setLifecycleState(QWebEnginePage::LifecycleState::Active);
+        return true;
+    }
+    
+    void enforce() {
+        using State = QWebEnginePage::LifecycleState;
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        
+        QHash<qint64, int> tabsPerProcess;
+        QVector<QPair<qint64, QWebEngineView*>> candidates;
+        for (auto it = records.constBegin(); it != records.constEnd(); ++it) {
+            QWebEngineView *view = it.key();
+            QWebEnginePage *page = view->page();
+            if (page->lifecycleState() == State::Discarded) continue;
+            
+            qint64 pid = page->renderProcessPid();
+            if (pid > 0) ++tabsPerProcess[pid];
+            
+            if (view == current || it->pinned || page->recentlyAudible()) continue;
+            candidates.append({it->lastActive, view});
+            
+            qint64 idle = now - it->lastActive;
+            if (idle >= discardAfterMs) {
+                lower(page, State::Discarded);
+            } else if (idle >= freezeAfterMs) {
+                lower(page, State::Frozen);
+            }
+        }
+        
+        // Over budget: discard least recently used tabs until we fit
+        qint64 totalKb = 0;
+        for (auto it = tabsPerProcess.constBegin(); it != tabsPerProcess.constEnd(); ++it) {
+            totalKb += sampler->memoryKb(it.key());
+        }
+        std::sort(candidates.begin(), candidates.end());
+        for (const auto &candidate : candidates) {
+            if (totalKb <= memoryBudgetKb) break;
+            QWebEnginePage *page = candidate.second->page();
+            qint64 pid = page->renderProcessPid();
+            if (pid > 0 && lower(page, State::Discarded)) {
+                // Renderers are shared between same-site tabs; count our share
+                totalKb -= sampler->memoryKb(pid) / qMax(1, tabsPerProcess.value(pid));
+            }
+        }
+    }
+    
+private:
+    struct Record {
+        qint64 lastActive = 0;
+        bool pinned = false;
+        bool suspended = false;  // Frozen by a workspace switch
+    };
+    
+    static bool lower(QWebEnginePage *page, QWebEnginePage::LifecycleState state) {
+        // Never go deeper than WebEngine allows (visible, devtools, ...)
+        if (int(state) <= int(page->lifecycleState()) || int(state) > int(page->recommendedState())) {
+            return false;
+        }
+        page->setLifecycleState(state);
+        return true;
+    }
+    
+    ProcessSampler *sampler;
+    QHash<QWebEngineView*, Record> records;
+    QPointer<QWebEngineView> current;
+    qint64 freezeAfterMs;
+    qint64 discardAfterMs;
+    qint64 memoryBudgetKb;
+};
+
+// ============================================================================
+// LOAD SCHEDULER
+// ============================================================================
+
+/**
+ * Decides when a new tab's first navigation starts. The selected tab always
+ * loads at once; background tabs queue and start a few at a time, and only
+ * once the selected tab has finished (or had a grace period to itself). With
+ * deferral on, background tabs wait until they are first selected. Each
+ * selection change re-ranks: the new tab jumps the queue, and the tab it
+ * replaces goes back to the front of the queue if it is still loading and
+ * over the cap.
+ */
+class TabLoadScheduler : public QObject {
+public:
+    TabLoadScheduler(int maxBackgroundLoads, bool deferUntilViewed, QObject *parent = nullptr)
+        : QObject(parent), maxBackgroundLoads(qMax(1, maxBackgroundLoads)), deferUntilViewed(deferUntilViewed) {
+        graceTimer = new QTimer(this);
+        graceTimer->setSingleShot(true);
+        connect(graceTimer, &QTimer::timeout, this, &TabLoadScheduler::pump);
+    }
+    
+    // Tabs it returns true for stay queued for now (hidden workspaces)
+    std::function<bool(QWebEngineView*)> holdBack;
+    
+    void load(QWebEngineView *view, const QUrl &url, bool foreground) {
+        if (!urls.contains(view)) {
+            connect(view, &QObject::destroyed, this, [this, view]() {
+                urls.remove(view);
+                queue.removeOne(view);
+                if (loading.contains(view)) {
+                    loading.remove(view);
+                    pump();
+                }
+            });
+        }
+        urls.insert(view, url);
+        if (foreground) {
+            begin(view);
+        } else if (!deferUntilViewed) {
+            queue.append(view);
+            pump();
+        }
+    }
+    
+    // Called whenever the selected tab changes
+    void activated(QWebEngineView *view) {
+        QWebEngineView *previous = current;
+        current = view;
+        
+        if (view && urls.contains(view) && !loading.contains(view)) {
+            queue.removeOne(view);
+            begin(view);
+        }
+        if (view && loading.contains(view)) {
+            foregroundClock.start();
+        }
+        
+        // The tab just left is background now and waits its turn again
+        if (previous && previous != view && loading.contains(previous)
+            && backgroundLoads() > maxBackgroundLoads) {
+            QObject::disconnect(loading.take(previous));
+            previous->stop();
+            queue.prepend(previous);
+        }
+        pump();
+    }
+    
+    // The tab was closed: drop it from the queue and free its slot
+    void cancel(QWebEngineView *view) {
+        urls.remove(view);
+        queue.removeOne(view);
+        if (loading.contains(view)) {
+            QObject::disconnect(loading.take(view));
+            view->stop();
+            pump();
+        }
+    }
+
+private:
+    static const int ForegroundGraceMs = 3000;
+    
+    int backgroundLoads() const {
+        return loading.size() - (current && loading.contains(current) ? 1 : 0);
+    }
+    
+    void begin(QWebEngineView *view) {
+        auto finished = std::make_shared<QMetaObject::Connection>();
+        *finished = connect(view, &QWebEngineView::loadFinished, this, [this, view, finished]() {
+            QObject::disconnect(*finished);
+            loading.remove(view);
+            urls.remove(view);
+            pump();
+        });
+        loading.insert(view, *finished);
+        view->setUrl(urls.value(view));
+    }
+    
+    void pump() {
+        // The selected tab gets the network and CPU to itself for a while
+        if (current && loading.contains(current) && foregroundClock.isValid()
+            && foregroundClock.elapsed() < ForegroundGraceMs) {
+            graceTimer->start(int(ForegroundGraceMs - foregroundClock.elapsed()));
+            return;
+        }
+        for (int i = 0; i < queue.size() && backgroundLoads() < maxBackgroundLoads;) {
+            QWebEngineView *view = queue.at(i);
+            if (holdBack && holdBack(view)) {
+                ++i;
+                continue;
+            }
+            queue.removeAt(i);
+            begin(view);
+        }
+    }
+    
+    int maxBackgroundLoads;
+    bool deferUntilViewed;
+    QTimer *graceTimer;
+    QElapsedTimer foregroundClock;
+    QPointer<QWebEngineView> current;
+    QHash<QWebEngineView*, QUrl> urls;  // First navigation not finished yet
+    QHash<QWebEngineView*, QMetaObject::Connection> loading;
+    QList<QWebEngineView*> queue;
+};
+
+// ============================================================================
+// NAVIGATION TIMING
+// ============================================================================
+
+/**
+ * Fixed-size multi-producer event ring. A writer claims a slot with one
+ * fetch_add and publishes it through the slot's sequence number, so
+ * recording never takes a lock and the oldest events are overwritten.
+ * snapshot() keeps only the slots that did not change while it copied them.
+ */
+template <typename T, int Capacity>
+class EventRing {
+public:
+    EventRing() : slots(new Slot[Capacity]) {}
+    
+    void push(const T &value) {
+        const quint64 ticket = head.fetch_add(1, std::memory_order_relaxed);
+        Slot &slot = slots[ticket % Capacity];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = value;
+        slot.sequence.store(ticket + 1, std::memory_order_release);
+    }
+    
+    // Oldest first
+    std::vector<T> snapshot() const {
+        const quint64 end = head.load(std::memory_order_acquire);
+        const quint64 begin = end > quint64(Capacity) ? end - Capacity : 0;
+        std::vector<T> values;
+        values.reserve(size_t(end - begin));
+        for (quint64 ticket = begin; ticket < end; ++ticket) {
+            const Slot &slot = slots[ticket % Capacity];
+            if (slot.sequence.load(std::memory_order_acquire) != ticket + 1) continue;
+            T value = slot.value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != ticket + 1) continue;
+            values.push_back(value);
+        }
+        return values;
+    }
+
+private:
+    struct Slot {
+        std::atomic<quint64> sequence{0};  // Ticket + 1 once written
+        T value;
+    };
+    
+    std::atomic<quint64> head{0};
+    std::unique_ptr<Slot[]> slots;
+};
+
+/**
+ * Timestamps every navigation of the tabs it instruments: the request,
+ * loadStarted, the 25/50/75/100 % loadProgress milestones, loadFinished,
+ * trackers blocked, and the page's own PerformanceNavigationTiming, read
+ * through a script installed on each profile. Events go to a ring buffer
+ * and can be exported as Chrome trace-event JSON (chrome://tracing,
+ * Perfetto) or summarised per domain as p50/p95.
+ */
+class NavigationTracer : public QObject {
+public:
+    enum Kind : quint16 {
+        Requested,
+        LoadStarted,
+        Progress,      // value: percent
+        LoadFinished,  // value: 1 when ok
+        Blocked,       // value: requests blocked during the load
+        TransferSize,  // value: bytes
+        PageTiming     // PageTiming + i: pageTimingFields()[i], value in µs since the page's time origin
+    };
+    
+    struct Event {
+        qint64 timeUs = 0;  // Since the tracer was created
+        qint64 value = 0;
+        quint32 navigation = 0;
+        quint32 tab = 0;
+        quint16 kind = 0;
+        char host[46] = {};
+    };
+    
+    // Gets each page's Navigation Timing entry as it is collected
+    std::function<void(QWebEngineView*, const QVariantMap&)> onPageTiming;
+    
+    explicit NavigationTracer(QObject *parent = nullptr) : QObject(parent) {
+        clock.start();
+    }
+    
+    static const QStringList &pageTimingFields() {
+        static const QStringList fields = {
+            "redirectStart", "redirectEnd", "fetchStart", "domainLookupStart", "domainLookupEnd",
+            "connectStart", "secureConnectionStart", "connectEnd", "requestStart", "responseStart",
+            "responseEnd", "domInteractive", "domContentLoadedEventStart", "domContentLoadedEventEnd",
+            "domComplete", "loadEventStart", "loadEventEnd"
+        };
+        return fields;
+    }
+    
+    // Runs in its own world so pages can neither see nor break it
+    static QWebEngineScript timingScript() {
+        QString fields = QString::fromUtf8(QJsonDocument(QJsonArray::fromStringList(pageTimingFields()))
+                                               .toJson(QJsonDocument::Compact));
+        QWebEngineScript script;
+        script.setName("ask-navigation-timing");
+        script.setWorldId(QWebEngineScript::ApplicationWorld);
+        script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+        script.setRunsOnSubFrames(false);
+        script.setSourceCode(QString(R"(
+            window.__askNavigationTiming = function () {
+                var entry = performance.getEntriesByType('navigation')[0];
+                if (!entry) return null;
+                var result = { transferSize: entry.transferSize };
+                %1.forEach(function (name) { result[name] = entry[name]; });
+                return result;
+            };
+        )").arg(fields));
+        return script;
+    }
+    
+    // blockedCount reads the tab's running total of blocked requests
+    void instrument(QWebEngineView *view, int tab, std::function<int()> blockedCount) {
+        connect(view, &QWebEngineView::loadStarted, this, [this, view, tab, blockedCount]() {
+            Navigation &navigation = navigations[view];
+            if (navigation.id == 0 || navigation.started) {
+                navigation = Navigation();
+                navigation.id = ++lastNavigation;
+            }
+            navigation.started = true;
+            navigation.blockedAtStart = blockedCount();
+            record(navigation.id, tab, LoadStarted, 0, view->url().host());
+        });
+        connect(view, &QWebEngineView::loadProgress, this, [this, view, tab](int progress) {
+            Navigation &navigation = navigations[view];
+            if (navigation.id == 0) return;
+            while (navigation.milestone < 4 && progress >= (navigation.milestone + 1) * 25) {
+                ++navigation.milestone;
+                record(navigation.id, tab, Progress, navigation.milestone * 25, view->url().host());
+            }
+        });
+        connect(view, &QWebEngineView::loadFinished, this, [this, view, tab, blockedCount](bool ok) {
+            auto it = navigations.find(view);
+            if (it == navigations.end() || !it->started) return;
+            const quint32 id = it->id;
+            const QString host = view->url().host();
+            record(id, tab, Blocked, blockedCount() - it->blockedAtStart, host);
+            record(id, tab, LoadFinished, ok ? 1 : 0, host);
+            navigations.erase(it);
+            if (ok) collectPageTiming(view, id, tab, host, 0);
+        });
+        connect(view, &QObject::destroyed, this, [this, view]() {
+            navigations.remove(view);
+        });
+    }
+    
+    // The user or the browser asked for a load; the clock starts here
+    void requested(QWebEngineView *view, const QUrl &url) {
+        Navigation &navigation = navigations[view];
+        navigation = Navigation();
+        navigation.id = ++lastNavigation;
+        record(navigation.id, tabOf(view), Requested, 0, url.host());
+    }
+    
+    std::vector<Event> events() const {
+        return ring.snapshot();
+    }
+    
+    QByteArray chromeTrace(const QJsonObject &metadata) const {
+        QJsonArray trace;
+        QHash<quint32, QVector<Event>> byNavigation;
+        for (const Event &event : events()) byNavigation[event.navigation].append(event);
+        
+        QSet<quint32> tabs;
+        for (auto it = byNavigation.constBegin(); it != byNavigation.constEnd(); ++it) {
+            const QVector<Event> &list = it.value();
+            const Event *start = nullptr;
+            const Event *loadStarted = nullptr;
+            const Event *finished = nullptr;
+            QHash<QString, qint64> page;
+            for (const Event &event : list) {
+                if (event.kind == Requested || (event.kind == LoadStarted && !start)) start = &event;
+                if (event.kind == LoadStarted) loadStarted = &event;
+                if (event.kind == LoadFinished) finished = &event;
+                if (event.kind >= PageTiming && event.kind - PageTiming < pageTimingFields().size()) {
+                    page.insert(pageTimingFields().at(event.kind - PageTiming), event.value);
+                }
+            }
+            if (!start) continue;
+            tabs.insert(start->tab);
+            auto base = [&start](const char *name, const char *category, char phase, qint64 ts) {
+                return QJsonObject{{"name", name}, {"cat", category}, {"ph", QString(QLatin1Char(phase))},
+                                   {"ts", double(ts)}, {"pid", 1}, {"tid", double(start->tab)}};
+            };
+            
+            for (const Event &event : list) {
+                if (event.kind == LoadStarted || event.kind == Progress) {
+                    QJsonObject instant = base(event.kind == LoadStarted ? "loadStarted" : "loadProgress",
+                                               "qt", 'i', event.timeUs);
+                    instant["s"] = "t";
+                    if (event.kind == Progress) instant["args"] = QJsonObject{{"percent", double(event.value)}};
+                    trace.append(instant);
+                }
+            }
+            if (finished) {
+                QJsonObject span = base("navigation", "qt", 'X', start->timeUs);
+                span["dur"] = double(finished->timeUs - start->timeUs);
+                QJsonObject args{{"host", QString::fromUtf8(finished->host)}, {"ok", finished->value == 1},
+                                 {"navigation", double(it.key())}};
+                for (const Event &event : list) {
+                    if (event.kind == Blocked) args["blocked"] = double(event.value);
+                    if (event.kind == TransferSize) args["transferSize"] = double(event.value);
+                }
+                span["args"] = args;
+                trace.append(span);
+            }
+            
+            // The page's time origin is taken to be loadStarted
+            if (loadStarted && !page.isEmpty()) {
+                static const char *const phases[][3] = {
+                    {"redirect", "redirectStart", "redirectEnd"},
+                    {"dns", "domainLookupStart", "domainLookupEnd"},
+                    {"connect", "connectStart", "connectEnd"},
+                    {"tls", "secureConnectionStart", "connectEnd"},
+                    {"waiting (TTFB)", "requestStart", "responseStart"},
+                    {"response", "responseStart", "responseEnd"},
+                    {"dom parsing", "responseEnd", "domInteractive"},
+                    {"DOMContentLoaded", "domContentLoadedEventStart", "domContentLoadedEventEnd"},
+                    {"subresources", "domContentLoadedEventEnd", "loadEventStart"},
+                    {"load event", "loadEventStart", "loadEventEnd"}
+                };
+                for (const auto &phase : phases) {
+                    qint64 from = page.value(phase[1]);
+                    qint64 to = page.value(phase[2]);
+                    if (from <= 0 || to < from) continue;
+                    QJsonObject span = base(phase[0], "page", 'X', loadStarted->timeUs + from);
+                    span["dur"] = double(to - from);
+                    trace.append(span);
+                }
+            }
+        }
+        
+        for (quint32 tab : tabs) {
+            trace.append(QJsonObject{{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", double(tab)},
+                                     {"args", QJsonObject{{"name", QString("Tab %1").arg(tab)}}}});
+        }
+        QJsonObject root{{"traceEvents", trace}, {"displayTimeUnit", "ms"}, {"metadata", metadata}};
+        return QJsonDocument(root).toJson(QJsonDocument::Compact);
+    }
+    
+    // Milliseconds per domain: load (request to loadFinished), ttfb,
+    // domContentLoaded and onload from the page, plus trackers blocked
+    QJsonObject domainSummary() const {
+        struct Samples {
+            QVector<qint64> load, ttfb, domContentLoaded, onload, blocked;
+        };
+        QHash<quint32, qint64> startUs;
+        QHash<quint32, QString> hosts;
+        QHash<quint32, QHash<int, qint64>> values;
+        QHash<quint32, qint64> loadUs;
+        for (const Event &event : events()) {
+            if (event.kind == Requested || (event.kind == LoadStarted && !startUs.contains(event.navigation))) {
+                startUs.insert(event.navigation, event.timeUs);
+            } else if (event.kind == LoadFinished && event.value == 1 && startUs.contains(event.navigation)) {
+                loadUs.insert(event.navigation, event.timeUs - startUs.value(event.navigation));
+                hosts.insert(event.navigation, QString::fromUtf8(event.host));
+            }
+            values[event.navigation].insert(event.kind, event.value);
+        }
+        
+        const int responseStart = PageTiming + pageTimingFields().indexOf("responseStart");
+        const int domContentLoaded = PageTiming + pageTimingFields().indexOf("domContentLoadedEventEnd");
+        const int loadEventEnd = PageTiming + pageTimingFields().indexOf("loadEventEnd");
+        QMap<QString, Samples> domains;
+        for (auto it = loadUs.constBegin(); it != loadUs.constEnd(); ++it) {
+            Samples &samples = domains[hosts.value(it.key())];
+            const QHash<int, qint64> &page = values.value(it.key());
+            samples.load.append(it.value() / 1000);
+            if (page.value(responseStart) > 0) samples.ttfb.append(page.value(responseStart) / 1000);
+            if (page.value(domContentLoaded) > 0) samples.domContentLoaded.append(page.value(domContentLoaded) / 1000);
+            if (page.value(loadEventEnd) > 0) samples.onload.append(page.value(loadEventEnd) / 1000);
+            samples.blocked.append(page.value(Blocked));
+        }
+        
+        QJsonObject summary;
+        for (auto it = domains.constBegin(); it != domains.constEnd(); ++it) {
+            summary[it.key().isEmpty() ? "(none)" : it.key()] = QJsonObject{
+                {"navigations", it->load.size()},
+                {"load", percentiles(it->load)},
+                {"ttfb", percentiles(it->ttfb)},
+                {"domContentLoaded", percentiles(it->domContentLoaded)},
+                {"onload", percentiles(it->onload)},
+                {"blocked", percentiles(it->blocked)}
+            };
+        }
+        return summary;
+    }
+
+private:
+    static const int RingCapacity = 16384;
+    static const int PageTimingRetries = 4;
+    
+    struct Navigation {
+        quint32 id = 0;
+        bool started = false;
+        int milestone = 0;
+        int blockedAtStart = 0;
+    };
+    
+    // Nearest rank
+    static QJsonObject percentiles(QVector<qint64> samples) {
+        if (samples.isEmpty()) return QJsonObject();
+        std::sort(samples.begin(), samples.end());
+        auto rank = [&samples](int percent) {
+            return double(samples.at(qMax(0, (samples.size() * percent + 99) / 100 - 1)));
+        };
+        return QJsonObject{{"p50", rank(50)}, {"p95", rank(95)}};
+    }
+    
+    static quint32 tabOf(QWebEngineView *view) {
+        return quint32(qMax(0, view->property("askTabId").toInt()));
+    }
+    
+    void record(quint32 navigation, quint32 tab, int kind, qint64 value, const QString &host) {
+        Event event;
+        event.timeUs = clock.nsecsElapsed() / 1000;
+        event.value = value;
+        event.navigation = navigation;
+        event.tab = tab;
+        event.kind = quint16(kind);
+        const QByteArray bytes = host.toUtf8().left(int(sizeof(event.host)) - 1);
+        memcpy(event.host, bytes.constData(), size_t(bytes.size()));
+        ring.push(event);
+    }
+    
+    // The onload handler may still be running at loadFinished; look again shortly if so
+    void collectPageTiming(QWebEngineView *view, quint32 id, quint32 tab, const QString &host, int attempt) {
+        QPointer<QWebEngineView> guard(view);
+        view->page()->runJavaScript(
+            "typeof __askNavigationTiming === 'function' ? __askNavigationTiming() : null",
+            QWebEngineScript::ApplicationWorld,
+            [this, guard, id, tab, host, attempt](const QVariant &result) {
+                const QVariantMap timing = result.toMap();
+                if (timing.isEmpty()) return;
+                if (timing.value("loadEventEnd").toDouble() <= 0 && attempt < PageTimingRetries && guard) {
+                    QTimer::singleShot(250, this, [this, guard, id, tab, host, attempt]() {
+                        if (guard) collectPageTiming(guard, id, tab, host, attempt + 1);
+                    });
+                    return;
+                }
+                if (onPageTiming && guard) onPageTiming(guard, timing);
+                for (int i = 0; i < pageTimingFields().size(); ++i) {
+                    double ms = timing.value(pageTimingFields().at(i)).toDouble();
+                    if (ms > 0) record(id, tab, PageTiming + i, qint64(ms * 1000), host);
+                }
+                record(id, tab, TransferSize, timing.value("transferSize").toLongLong(), host);
+            });
+    }
+    
+    QElapsedTimer clock;
+    EventRing<Event, RingCapacity> ring;
+    QHash<QWebEngineView*, Navigation> navigations;
+    quint32 lastNavigation = 0;
+};
+
+// ============================================================================
+// OMNIBOX INDEX
+// ============================================================================
+
+/**
+ * In-memory autocomplete index over history and bookmarks. Entries are
+ * numbered in frecency order when the index is built, so every posting
+ * list is already best-first and a query can stop after a handful of hits.
+ * Tokens live in a front-coded dictionary (16 per block, shared-prefix
+ * lengths instead of repeated bytes) with CSR posting lists; visits made
+ * after the build go to a small ordered delta map until the next start.
+ * Owned by the GUI thread; build() is pure and runs on a worker.
+ */
+class OmniboxIndex {
+public:
+    struct Entry {
+        QString url;
+        QString title;
+        int visitCount = 0;
+        int typedCount = 0;
+        qint64 lastVisit = 0;  // Seconds since the epoch
+        bool bookmarked = false;
+    };
+    
+    struct Match {
+        QString url;
+        QString title;
+        double score = 0;
+    };
+    
+    static std::shared_ptr<OmniboxIndex> build(std::vector<Entry> entries) {
+        std::shared_ptr<OmniboxIndex> index(new OmniboxIndex());
+        const qint64 now = QDateTime::currentSecsSinceEpoch();
+        
+        // Frecency order doubles as the entry numbering
+        std::vector<std::pair<double, quint32>> order(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            order[i] = {-frecency(entries[i], now), quint32(i)};
+        }
+        std::sort(order.begin(), order.end());
+        index->entries.reserve(entries.size());
+        for (const auto &ranked : order) {
+            index->entries.push_back(std::move(entries[ranked.second]));
+        }
+        
+        // (token, entry) pairs through an interning table
+        QHash<QByteArray, quint32> tokenIds;
+        std::vector<QByteArray> tokens;
+        std::vector<quint64> pairs;
+        for (quint32 id = 0; id < index->entries.size(); ++id) {
+            const Entry &entry = index->entries[id];
+            index->idByUrl.insert(entry.url, id);
+            for (const QByteArray &token : entryTokens(entry)) {
+                auto it = tokenIds.find(token);
+                if (it == tokenIds.end()) {
+                    it = tokenIds.insert(token, quint32(tokens.size()));
+                    tokens.push_back(token);
+                }
+                pairs.push_back((quint64(it.value()) << 32) | id);
+            }
+        }
+        
+        std::vector<quint32> sortedTokens(tokens.size());
+        for (quint32 i = 0; i < sortedTokens.size(); ++i) sortedTokens[i] = i;
+        std::sort(sortedTokens.begin(), sortedTokens.end(), [&tokens](quint32 a, quint32 b) {
+            return tokens[a] < tokens[b];
+        });
+        std::vector<quint32> rank(tokens.size());
+        for (quint32 i = 0; i < sortedTokens.size(); ++i) rank[sortedTokens[i]] = i;
+        for (quint64 &pair : pairs) {
+            pair = (quint64(rank[pair >> 32]) << 32) | (pair & 0xFFFFFFFFu);
+        }
+        std::sort(pairs.begin(), pairs.end());
+        
+        // CSR posting lists, ascending entry id == descending frecency
+        index->tokenCount = int(tokens.size());
+        index->postingOffsets.assign(tokens.size() + 1, 0);
+        index->postings.reserve(pairs.size());
+        for (quint64 pair : pairs) {
+            ++index->postingOffsets[(pair >> 32) + 1];
+            index->postings.push_back(quint32(pair & 0xFFFFFFFFu));
+        }
+        for (size_t i = 1; i < index->postingOffsets.size(); ++i) {
+            index->postingOffsets[i] += index->postingOffsets[i - 1];
+        }
+        
+        // Front-coded dictionary
+        QByteArray previous;
+        for (int i = 0; i < index->tokenCount; ++i) {
+            const QByteArray &token = tokens[sortedTokens[i]];
+            if (i % BlockSize == 0) {
+                index->blockOffsets.push_back(quint32(index->dictionary.size()));
+                index->dictionary.append(char(token.size()));
+                index->dictionary.append(token);
+            } else {
+                int shared = 0;
+                while (shared < previous.size() && shared < token.size() && previous[shared] == token[shared]) {
+                    ++shared;
+                }
+                index->dictionary.append(char(shared));
+                index->dictionary.append(char(token.size() - shared));
+                index->dictionary.append(token.constData() + shared, token.size() - shared);
+            }
+            previous = token;
+        }
+        index->dictionary.squeeze();
+        index->baseCount = quint32(index->entries.size());
+        
+        // One- and two-byte prefixes span thousands of tokens; answer them
+        // from precomputed best-first lists instead of merging per keystroke
+        QByteArray lastPrefix;
+        for (quint32 t : sortedTokens) {
+            for (int length = 1; length <= 2 && length <= tokens[t].size(); ++length) {
+                QByteArray prefix = tokens[t].left(length);
+                if (length == 2 || prefix != lastPrefix) {
+                    if (!index->shortPrefixCache.contains(prefix)) {
+                        index->baseCandidates(prefix, index->prefixRange(prefix), ShortPrefixDepth);
+                    }
+                }
+                if (length == 1) lastPrefix = prefix;
+            }
+        }
+        return index;
+    }
+    
+    QVector<Match> query(const QString &text, int limit) const {
+        QVector<Match> results;
+        const QVector<QByteArray> terms = tokenize(text, 1);
+        if (terms.isEmpty() || limit <= 0) return results;
+        
+        QStringList needles;
+        for (const QByteArray &term : terms) needles << QString::fromUtf8(term);
+        
+        // Drive the search from the most selective term
+        int primary = 0;
+        QPair<int, int> primaryRange = prefixRange(terms[0]);
+        for (int t = 1; t < terms.size(); ++t) {
+            QPair<int, int> range = prefixRange(terms[t]);
+            if (postingOffsets[range.second] - postingOffsets[range.first]
+                < postingOffsets[primaryRange.second] - postingOffsets[primaryRange.first]) {
+                primary = t;
+                primaryRange = range;
+            }
+        }
+        
+        const int wanted = limit * 4;
+        std::vector<quint32> matched;
+        QSet<quint32> seen;
+        auto consider = [&](quint32 id) {
+            if (seen.contains(id)) return;
+            seen.insert(id);
+            const Entry &entry = entries[id];
+            for (int t = 0; t < needles.size(); ++t) {
+                if (t != primary && !containsWordPrefix(entry.url, needles[t])
+                    && !containsWordPrefix(entry.title, needles[t])) {
+                    return;
+                }
+            }
+            matched.push_back(id);
+        };
+        
+        // Visits since the build first: they are usually the freshest
+        auto delta = deltaPostings.lower_bound(terms[primary]);
+        for (; delta != deltaPostings.end() && delta->first.startsWith(terms[primary]); ++delta) {
+            for (quint32 id : delta->second) consider(id);
+        }
+        
+        std::vector<quint32> candidates = baseCandidates(terms[primary], primaryRange, wanted * 8);
+        for (quint32 id : candidates) {
+            if (int(matched.size()) >= wanted) break;
+            consider(id);
+        }
+        
+        const qint64 now = QDateTime::currentSecsSinceEpoch();
+        for (quint32 id : matched) {
+            const Entry &entry = entries[id];
+            double score = frecency(entry, now);
+            if (hostStartsWith(entry.url, needles[0])) score *= 3;
+            results.append({entry.url, entry.title, score});
+        }
+        std::sort(results.begin(), results.end(), [](const Match &a, const Match &b) {
+            return a.score > b.score;
+        });
+        if (results.size() > limit) results.resize(limit);
+        return results;
+    }
+    
+    void recordVisit(const QString &url, qint64 when, bool typed = false) {
+        auto it = idByUrl.constFind(url);
+        quint32 id;
+        if (it == idByUrl.constEnd()) {
+            id = quint32(entries.size());
+            Entry entry;
+            entry.url = url;
+            entries.push_back(entry);
+            idByUrl.insert(url, id);
+            for (const QByteArray &token : entryTokens(entries.back())) {
+                deltaPostings[token].push_back(id);
+            }
+        } else {
+            id = it.value();
+        }
+        // Counted like HistoryWriter's upsert, so a rebuild ranks it the same
+        Entry &entry = entries[id];
+        ++entry.visitCount;
+        if (typed) {
+            ++entry.typedCount;
+        }
+        entry.lastVisit = qMax(entry.lastVisit, when);
+    }
+    
+    void setTitle(const QString &url, const QString &title) {
+        auto it = idByUrl.constFind(url);
+        if (it == idByUrl.constEnd() || title.isEmpty() || entries[it.value()].title == title) return;
+        Entry &entry = entries[it.value()];
+        entry.title = title;
+        for (const QByteArray &token : tokenize(title, 2)) {
+            std::vector<quint32> &ids = deltaPostings[token];
+            if (ids.empty() || ids.back() != it.value()) ids.push_back(it.value());
+        }
+    }
+    
+    int size() const { return int(entries.size()); }
+    
+    size_t memoryFootprint() const {
+        size_t bytes = sizeof(*this) + size_t(dictionary.capacity())
+                     + blockOffsets.capacity() * sizeof(quint32)
+                     + postingOffsets.capacity() * sizeof(quint32)
+                     + postings.capacity() * sizeof(quint32)
+                     + entries.capacity() * sizeof(Entry)
+                     + size_t(idByUrl.capacity()) * (sizeof(void *) * 3 + sizeof(QString) + sizeof(quint32));
+        for (const Entry &entry : entries) {
+            bytes += size_t(entry.url.capacity() + entry.title.capacity()) * sizeof(QChar);
+        }
+        return bytes;
+    }
+    
+    // Weighted by recency buckets, in the spirit of Firefox's frecency
+    static double frecency(const Entry &entry, qint64 now) {
+        const qint64 ageDays = (now - entry.lastVisit) / 86400;
+        double recency = ageDays <= 4 ? 100 : ageDays <= 14 ? 70 : ageDays <= 31 ? 50 : ageDays <= 90 ? 30 : 10;
+        double score = (entry.visitCount + 2.0 * entry.typedCount) * recency;
+        if (entry.bookmarked) score += 140;
+        return score;
+    }
+    
+    // Lowercased UTF-8 words; scheme and "www" carry no signal
+    static QVector<QByteArray> tokenize(const QString &text, int minLength) {
+        QVector<QByteArray> tokens;
+        const QByteArray bytes = text.toLower().toUtf8();
+        int start = -1;
+        for (int i = 0; i <= bytes.size(); ++i) {
+            uchar c = i < bytes.size() ? uchar(bytes[i]) : 0;
+            bool word = (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c >= 0x80;
+            if (word && start < 0) {
+                start = i;
+            } else if (!word && start >= 0) {
+                QByteArray token = bytes.mid(start, qMin(i - start, int(MaxTokenLength)));
+                start = -1;
+                if (token.size() < minLength || token == "http" || token == "https" || token == "www") {
+                    continue;
+                }
+                tokens.append(token);
+            }
+        }
+        return tokens;
+    }
+
+private:
+    static const int BlockSize = 16;
+    static const int MaxTokenLength = 64;
+    static const int ShortPrefixDepth = 256;
+    
+    OmniboxIndex() = default;
+    
+    static QVector<QByteArray> entryTokens(const Entry &entry) {
+        QVector<QByteArray> tokens = tokenize(entry.url, 2) + tokenize(entry.title, 2);
+        std::sort(tokens.begin(), tokens.end());
+        tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+        return tokens;
+    }
+    
+    static bool containsWordPrefix(const QString &haystack, const QString &needle) {
+        for (int at = haystack.indexOf(needle, 0, Qt::CaseInsensitive); at >= 0;
+             at = haystack.indexOf(needle, at + 1, Qt::CaseInsensitive)) {
+            if (at == 0 || !haystack.at(at - 1).isLetterOrNumber()) return true;
+        }
+        return false;
+    }
+    
+    static bool hostStartsWith(const QString &url, const QString &needle) {
+        int host = url.indexOf("://");
+        host = host < 0 ? 0 : host + 3;
+        if (url.midRef(host, 4) == QLatin1String("www.")) host += 4;
+        return url.midRef(host).startsWith(needle, Qt::CaseInsensitive);
+    }
+    
+    QByteArray blockHead(int block) const {
+        const char *data = dictionary.constData() + blockOffsets[block];
+        return QByteArray(data + 1, uchar(data[0]));
+    }
+    
+    // Index of the first token >= key
+    int lowerBound(const QByteArray &key) const {
+        int lo = 0;
+        int hi = int(blockOffsets.size());
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (blockHead(mid) < key) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == 0) return 0;
+        
+        // The answer is inside block lo - 1 or is the head of block lo
+        const int block = lo - 1;
+        const char *data = dictionary.constData() + blockOffsets[block];
+        QByteArray token(data + 1, uchar(data[0]));
+        data += 1 + uchar(data[0]);
+        int tokenIndex = block * BlockSize;
+        const int blockEnd = qMin(tokenCount, tokenIndex + BlockSize);
+        for (++tokenIndex; tokenIndex < blockEnd; ++tokenIndex) {
+            int shared = uchar(data[0]);
+            int suffix = uchar(data[1]);
+            token.truncate(shared);
+            token.append(data + 2, suffix);
+            data += 2 + suffix;
+            if (!(token < key)) return tokenIndex;
+        }
+        return blockEnd;
+    }
+    
+    QPair<int, int> prefixRange(const QByteArray &prefix) const {
+        int first = lowerBound(prefix);
+        QByteArray successor = prefix;
+        while (!successor.isEmpty() && uchar(successor.back()) == 0xFF) successor.chop(1);
+        if (successor.isEmpty()) return {first, tokenCount};
+        successor.back() = char(uchar(successor.back()) + 1);
+        return {first, lowerBound(successor)};
+    }
+    
+    // Best-first entries carrying any token in [range), via a k-way merge
+    std::vector<quint32> baseCandidates(const QByteArray &prefix, QPair<int, int> range, int limit) const {
+        const bool cacheable = prefix.size() <= 2;
+        if (cacheable) {
+            auto cached = shortPrefixCache.constFind(prefix);
+            if (cached != shortPrefixCache.constEnd()) return cached.value();
+        }
+        
+        using Cursor = std::pair<quint32, quint32>;  // (entry id, posting position)
+        std::vector<Cursor> heap;
+        heap.reserve(size_t(range.second - range.first));
+        for (int t = range.first; t < range.second; ++t) {
+            if (postingOffsets[t] < postingOffsets[t + 1]) {
+                heap.push_back({postings[postingOffsets[t]], postingOffsets[t]});
+            }
+        }
+        auto later = [](const Cursor &a, const Cursor &b) { return a.first > b.first; };
+        std::make_heap(heap.begin(), heap.end(), later);
+        
+        std::vector<quint32> result;
+        const int want = cacheable ? qMax(limit, int(ShortPrefixDepth)) : limit;
+        while (!heap.empty() && int(result.size()) < want) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            Cursor cursor = heap.back();
+            heap.pop_back();
+            if (result.empty() || result.back() != cursor.first) result.push_back(cursor.first);
+            
+            // Posting positions are global; the owning token bounds the cursor
+            quint32 next = cursor.second + 1;
+            auto owner = std::upper_bound(postingOffsets.begin() + range.first,
+                                          postingOffsets.begin() + range.second + 1, cursor.second);
+            if (next < *owner) {
+                heap.push_back({postings[next], next});
+                std::push_heap(heap.begin(), heap.end(), later);
+            }
+        }
+        if (cacheable) shortPrefixCache.insert(prefix, result);
+        return result;
+    }
+    
+    QByteArray dictionary;
+    std::vector<quint32> blockOffsets;
+    int tokenCount = 0;
+    std::vector<quint32> postingOffsets;
+    std::vector<quint32> postings;
+    
+    std::vector<Entry> entries;
+    QHash<QString, quint32> idByUrl;
+    quint32 baseCount = 0;
+    std::map<QByteArray, std::vector<quint32>> deltaPostings;
+    mutable QHash<QByteArray, std::vector<quint32>> shortPrefixCache;
+};
+
+// ============================================================================
+// SEARCH SUGGESTIONS
+// ============================================================================
+
+/**
+ * Fetches OpenSearch suggestions (["prefix", ["s1", "s2", ...]]) for what is
+ * being typed. Keystrokes are debounced and a new prefix aborts the request
+ * still in flight, so only the latest text is ever answered. Answers go into
+ * an LRU keyed by endpoint and prefix: a prefix seen before is served at once
+ * without touching the network, and when the network fails the longest
+ * cached shorter prefix stands in, filtered to the text typed.
+ */
+class SuggestionClient : public QObject {
+public:
+    struct Stats {
+        int keystrokes = 0;
+        int requests = 0;     // Sent to the endpoint
+        int aborted = 0;      // Superseded while in flight
+        int cacheHits = 0;
+        int failures = 0;
+    };
+    
+    // Suggestions for `prefix`, the text as it is now
+    std::function<void(const QString &prefix, const QStringList &suggestions)> onSuggestions;
+    
+    SuggestionClient(int debounceMs, int cacheSize, QObject *parent = nullptr)
+        : QObject(parent), cacheSize(cacheSize), network(new QNetworkAccessManager(this)) {
+        debounce = new QTimer(this);
+        debounce->setSingleShot(true);
+        debounce->setInterval(debounceMs);
+        connect(debounce, &QTimer::timeout, this, [this]() { fetch(); });
+    }
+    
+    ~SuggestionClient() override {
+        cancel();
+    }
+    
+    // OpenSearch template with {searchTerms}; empty turns suggestions off
+    void setEndpoint(const QString &urlTemplate) {
+        if (urlTemplate == endpoint) return;
+        cancel();
+        endpoint = urlTemplate;
+    }
+    
+    void request(const QString &text) {
+        ++counters.keystrokes;
+        current = text.trimmed();
+        abortInFlight();
+        if (current.isEmpty() || endpoint.isEmpty()) {
+            debounce->stop();
+            return;
+        }
+        
+        auto cached = cacheIndex.find(cacheKey(current));
+        if (cached != cacheIndex.end()) {
+            ++counters.cacheHits;
+            lru.splice(lru.begin(), lru, cached.value());
+            debounce->stop();
+            deliver(current, cached.value()->second);
+            return;
+        }
+        debounce->start();
+    }
+    
+    void cancel() {
+        debounce->stop();
+        abortInFlight();
+        current.clear();
+    }
+    
+    const Stats &stats() const { return counters; }
+    
+private:
+    using CacheList = std::list<std::pair<QString, QStringList>>;
+    
+    QString cacheKey(const QString &prefix) const {
+        return endpoint + QLatin1Char('\n') + prefix.toLower();
+    }
+    
+    void fetch() {
+        const QString prefix = current;
+        QString url = endpoint;
+        url.replace("{searchTerms}", QString::fromLatin1(QUrl::toPercentEncoding(prefix)));
+        
+        QNetworkRequest request{QUrl(url)};
+        request.setTransferTimeout(3000);
+        request.setRawHeader("Accept", "application/x-suggestions+json, application/json");
+        QNetworkReply *reply = network->get(request);
+        inFlight = reply;
+        ++counters.requests;
+        
+        connect(reply, &QNetworkReply::finished, this, [this, reply, prefix]() {
+            reply->deleteLater();
+            if (reply != inFlight) return;   // Aborted for newer text
+            inFlight = nullptr;
+            
+            QStringList suggestions;
+            bool ok = reply->error() == QNetworkReply::NoError && parse(reply->readAll(), &suggestions);
+            if (ok) {
+                remember(prefix, suggestions);
+            } else {
+                ++counters.failures;
+                suggestions = fallback(prefix);
+            }
+            if (prefix == current) deliver(prefix, suggestions);
+        });
+    }
+    
+    void abortInFlight() {
+        if (!inFlight) return;
+        QNetworkReply *reply = inFlight;
+        inFlight = nullptr;
+        ++counters.aborted;
+        reply->abort();
+    }
+    
+    static bool parse(const QByteArray &body, QStringList *suggestions) {
+        QJsonParseError error;
+        const QJsonDocument document = QJsonDocument::fromJson(body, &error);
+        if (error.error != QJsonParseError::NoError || !document.isArray()) return false;
+        const QJsonArray list = document.array().at(1).toArray();
+        for (const QJsonValue &value : list) {
+            if (value.isString() && !value.toString().isEmpty()) suggestions->append(value.toString());
+        }
+        return true;
+    }
+    
+    void remember(const QString &prefix, const QStringList &suggestions) {
+        const QString key = cacheKey(prefix);
+        auto existing = cacheIndex.find(key);
+        if (existing != cacheIndex.end()) {
+            lru.erase(existing.value());
+            cacheIndex.erase(existing);
+        }
+        lru.emplace_front(key, suggestions);
+        cacheIndex.insert(key, lru.begin());
+        while (int(lru.size()) > cacheSize) {
+            cacheIndex.remove(lru.back().first);
+            lru.pop_back();
+        }
+    }
+    
+    // Offline: the longest cached shorter prefix, narrowed to what was typed
+    QStringList fallback(const QString &prefix) const {
+        for (int length = prefix.size() - 1; length > 0; --length) {
+            auto cached = cacheIndex.constFind(cacheKey(prefix.left(length)));
+            if (cached == cacheIndex.constEnd()) continue;
+            QStringList narrowed;
+            for (const QString &suggestion : cached.value()->second) {
+                if (suggestion.startsWith(prefix, Qt::CaseInsensitive)) narrowed.append(suggestion);
+            }
+            return narrowed;
+        }
+        return {};
+    }
+    
+    void deliver(const QString &prefix, const QStringList &suggestions) {
+        if (onSuggestions) onSuggestions(prefix, suggestions);
+    }
+    
+    int cacheSize;
+    QNetworkAccessManager *network;
+    QTimer *debounce = nullptr;
+    QPointer<QNetworkReply> inFlight;
+    QString endpoint;
+    QString current;
+    CacheList lru;
+    QHash<QString, CacheList::iterator> cacheIndex;
+    Stats counters;
+};
+
+// ============================================================================
+// VIEW POOL
+// ============================================================================
+
+/**
+ * Keeps a few configured QWebEngineViews with a live page and renderer
+ * ready, so a new tab does not pay for widget, page and process start-up
+ * between the keypress and first paint. Taken views are replaced one at a
+ * time once the user has stopped opening tabs. A page cannot change
+ * profile, so the pool holds views for one profile (the visible
+ * workspace's) at a time.
+ */
+class WebViewPool : public QObject {
+public:
+    WebViewPool(int size, QWebEngineProfile *profile, QObject *parent = nullptr)
+        : QObject(parent), targetSize(size), profile(profile) {
+        refillTimer = new QTimer(this);
+        refillTimer->setSingleShot(true);
+        connect(refillTimer, &QTimer::timeout, this, &WebViewPool::refillOne);
+        
+        // Leave start-up and the first tab alone
+        scheduleRefill(2000);
+    }
+    
+    ~WebViewPool() override {
+        qDeleteAll(ready);
+        qDeleteAll(warming);
+    }
+    
+    static void configure(QWebEngineView *view) {
+        // Optimize settings for performance
+        view->settings()->setAttribute(QWebEngineSettings::JavascriptEnabled, true);
+        view->settings()->setAttribute(QWebEngineSettings::PluginsEnabled, true);
+        view->settings()->setAttribute(QWebEngineSettings::DnsPrefetchEnabled, true);
+        view->settings()->setAttribute(QWebEngineSettings::LocalStorageEnabled, true);
+    }
+    
+    QWebEngineView* take(bool *pooled = nullptr) {
+        QWebEngineView *view = ready.isEmpty() ? nullptr : ready.takeFirst();
+        if (pooled) *pooled = view != nullptr;
+        if (!view) {
+            view = createView();
+        }
+        scheduleRefill(1000);
+        return view;
+    }
+    
+    // Drops views warmed for the previous profile and warms new ones
+    void setProfile(QWebEngineProfile *newProfile) {
+        if (newProfile == profile) return;
+        profile = newProfile;
+        qDeleteAll(ready);
+        qDeleteAll(warming);
+        ready.clear();
+        warming.clear();
+        scheduleRefill(2000);
+    }
+
+private:
+    QWebEngineView *createView() {
+        QWebEngineView *view = new QWebEngineView();
+        if (profile) view->setPage(new QWebEnginePage(profile, view));
+        configure(view);
+        return view;
+    }
+    
+    void scheduleRefill(int delayMs) {
+        if (ready.size() + warming.size() < targetSize) {
+            refillTimer->start(delayMs);
+        }
+    }
+    
+    void refillOne() {
+        QWebEngineView *view = createView();
+        warming.append(view);
+        
+        // Only hand out views whose warm-up load is done, so its
+        // loadFinished cannot be mistaken for the real page's
+        auto warmed = std::make_shared<QMetaObject::Connection>();
+        *warmed = connect(view, &QWebEngineView::loadFinished, this, [this, view, warmed]() {
+            QObject::disconnect(*warmed);
+            warming.removeOne(view);
+            ready.append(view);
+            scheduleRefill(250);
+        });
+        view->setUrl(QUrl("about:blank"));  // Spins up the renderer
+    }
+    
+    int targetSize;
+    QWebEngineProfile *profile;
+    QTimer *refillTimer;
+    QList<QWebEngineView*> ready;
+    QList<QWebEngineView*> warming;
+};
+
+// ============================================================================
+// SESSION
+// ============================================================================
+
+/**
+ * Crash-safe record of the open tabs. Every tab event is appended to a
+ * journal and flushed immediately; the journal is periodically compacted
+ * into a snapshot written with QSaveFile. Events carry a sequence number,
+ * so replaying a journal that survived a compaction (crash between the
+ * snapshot commit and the truncate) cannot apply anything twice.
+ */
+class SessionStore : public QObject {
+public:
+    struct Tab {
+        int id = 0;
+        QString url;
+        QString title;
+        QString workspace;  // Empty for sessions saved before workspaces had their own tabs
+    };
+    
+    SessionStore(const QString &basePath, QObject *parent = nullptr)
+        : QObject(parent),
+          snapshotPath(basePath + ".json"),
+          journal(basePath + ".journal") {
+        QTimer *timer = new QTimer(this);
+        connect(timer, &QTimer::timeout, [this]() {
+            if (eventsSinceCompaction > 0) compact();
+        });
+        timer->start(30000);
+    }
+    
+    ~SessionStore() override {
+        if (journal.isOpen()) compact();
+    }
+    
+    // Rebuilds the last session and starts journaling on top of it
+    QVector<Tab> restore(int *activeTabId) {
+        QFile snapshot(snapshotPath);
+        if (snapshot.open(QIODevice::ReadOnly)) {
+            QJsonObject root = QJsonDocument::fromJson(snapshot.readAll()).object();
+            sequence = root.value("seq").toVariant().toLongLong();
+            activeId = root.value("active").toInt();
+            for (const QJsonValue &value : root.value("tabs").toArray()) {
+                QJsonObject tab = value.toObject();
+                tabs.append({tab.value("id").toInt(), tab.value("url").toString(),
+                             tab.value("title").toString(), tab.value("ws").toString()});
+            }
+        }
+        
+        if (journal.open(QIODevice::ReadOnly)) {
+            while (!journal.atEnd()) {
+                QJsonParseError error;
+                QJsonObject event = QJsonDocument::fromJson(journal.readLine(), &error).object();
+                if (error.error != QJsonParseError::NoError) {
+                    break;  // Torn final line from a crash mid-write
+                }
+                qint64 eventSequence = event.value("seq").toVariant().toLongLong();
+                if (eventSequence > sequence) {
+                    apply(event);
+                    sequence = eventSequence;
+                }
+            }
+            journal.close();
+        }
+        
+        if (!journal.open(QIODevice::WriteOnly | QIODevice::Append)) {
+            qDebug() << "Session journal error:" << journal.errorString();
+        }
+        compact();
+        
+        *activeTabId = activeId;
+        return tabs;
+    }
+    
+    void tabOpened(int id, const QString &url, const QString &workspace) {
+        append({{"e", "open"}, {"id", id}, {"url", url}, {"ws", workspace}});
+    }
+    
+    void tabClosed(int id) {
+        append({{"e", "close"}, {"id", id}});
+    }
+    
+    void tabNavigated(int id, const QString &url) {
+        append({{"e", "nav"}, {"id", id}, {"url", url}});
+    }
+    
+    void tabTitleChanged(int id, const QString &title) {
+        append({{"e", "title"}, {"id", id}, {"title", title}});
+    }
+    
+    void tabsReordered(const QVector<int> &ids) {
+        QJsonArray order;
+        for (int id : ids) order.append(id);
+        append({{"e", "order"}, {"ids", order}});
+    }
+    
+    void tabSelected(int id) {
+        append({{"e", "select"}, {"id", id}});
+    }
+    
+    void compact() {
+        QJsonArray list;
+        for (const Tab &tab : tabs) {
+            list.append(QJsonObject{{"id", tab.id}, {"url", tab.url}, {"title", tab.title}, {"ws", tab.workspace}});
+        }
+        QJsonObject root{{"seq", sequence}, {"active", activeId}, {"tabs", list}};
+        
+        QSaveFile snapshot(snapshotPath);
+        if (snapshot.open(QIODevice::WriteOnly)) {
+            snapshot.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+            if (snapshot.commit() && journal.isOpen()) {
+                journal.resize(0);
+                eventsSinceCompaction = 0;
+            }
+        }
+    }
+
+private:
+    void append(QJsonObject event) {
+        if (!event.value("id").isUndefined() && event.value("id").toInt() <= 0) {
+            return;  // Not a journaled tab (internal pages)
+        }
+        event.insert("seq", ++sequence);
+        apply(event);
+        if (journal.isOpen()) {
+            journal.write(QJsonDocument(event).toJson(QJsonDocument::Compact) + '\n');
+            journal.flush();
+        }
+        if (++eventsSinceCompaction >= 500) {
+            compact();
+        }
+    }
+    
+    // Idempotent, so a replay always converges on the same state
+    void apply(const QJsonObject &event) {
+        const QString type = event.value("e").toString();
+        const int id = event.value("id").toInt();
+        auto find = [this](int id) {
+            for (int i = 0; i < tabs.size(); ++i) {
+                if (tabs[i].id == id) return i;
+            }
+            return -1;
+        };
+        
+        if (type == "open") {
+            if (find(id) < 0) tabs.append({id, QString(), QString(), QString()});
+            tabs[find(id)].url = event.value("url").toString();
+            tabs[find(id)].workspace = event.value("ws").toString();
+        } else if (type == "close") {
+            int index = find(id);
+            if (index >= 0) tabs.remove(index);
+            if (activeId == id) activeId = 0;
+        } else if (type == "nav" && find(id) >= 0) {
+            tabs[find(id)].url = event.value("url").toString();
+        } else if (type == "title" && find(id) >= 0) {
+            tabs[find(id)].title = event.value("title").toString();
+        } else if (type == "order") {
+            QVector<Tab> ordered;
+            for (const QJsonValue &value : event.value("ids").toArray()) {
+                int index = find(value.toInt());
+                if (index >= 0) ordered.append(tabs.takeAt(index));
+            }
+            tabs = ordered + tabs;
+        } else if (type == "select") {
+            activeId = id;
+        }
+    }
+    
+    QString snapshotPath;
+    QFile journal;
+    QVector<Tab> tabs;
+    int activeId = 0;
+    qint64 sequence = 0;
+    int eventsSinceCompaction = 0;
+};
+
+/**
+ * The last few closed tabs, newest last. An entry is the tab's URL and
+ * title plus its back/forward list as QWebEngineHistory serializes it,
+ * so reopening gets the whole history back without the closed view (and
+ * its renderer) having to stay alive. A history too large to be worth
+ * keeping is dropped and the tab reopens on its URL alone.
+ */
+class RecentlyClosedTabs {
+public:
+    struct Entry {
+        QString url;
+        QString title;
+        QString workspace;
+        int index = 0;          // Position in its tab set when it was closed
+        QByteArray history;     // Empty when only the URL is kept
+    };
+    
+    static constexpr int Capacity = 25;
+    static constexpr int MaxHistoryBytes = 256 * 1024;
+    
+    void push(Entry entry) {
+        if (entry.history.size() > MaxHistoryBytes) {
+            entry.history.clear();
+        }
+        entries.append(std::move(entry));
+        while (entries.size() > Capacity) {
+            entries.removeFirst();
+        }
+    }
+    
+    Entry takeLast() {
+        return entries.takeLast();
+    }
+    
+    bool isEmpty() const { return entries.isEmpty(); }
+    int size() const { return entries.size(); }
+    
+    qint64 bytes() const {
+        qint64 total = 0;
+        for (const Entry &entry : entries) total += entry.history.size();
+        return total;
+    }
+    
+    static QByteArray saveHistory(QWebEngineHistory *history) {
+        QByteArray data;
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream << *history;
+        return data;
+    }
+    
+    // Also navigates to the restored current entry
+    static bool restoreHistory(QWebEngineHistory *history, const QByteArray &data) {
+        QDataStream stream(data);
+        stream >> *history;
+        return stream.status() == QDataStream::Ok;
+    }
+
+private:
+    QList<Entry> entries;
+};
+
+// ============================================================================
+// DOWNLOADS
+// ============================================================================
+
+/**
+ * Cookie jar for download connections, kept in step with the web
+ * profile's cookie store so a re-fetched download stays signed in.
+ */
+class DownloadCookieJar : public QNetworkCookieJar {
+public:
+    using QNetworkCookieJar::QNetworkCookieJar;
+    using QNetworkCookieJar::insertCookie;
+    using QNetworkCookieJar::deleteCookie;
+};
+
+/**
+ * Hashes a download in file order on its own thread while it streams.
+ * The download thread hands over each chunk once everything before it has
+ * arrived; only bytes written by an earlier session are read back from the
+ * partial file. SHA-256 is always computed, plus the algorithm of an
+ * expected checksum when one is known up front.
+ */
+class StreamHasher : public QThread {
+public:
+    StreamHasher(const QString &path, const QVector<QCryptographicHash::Algorithm> &algorithms,
+                 QObject *parent = nullptr)
+        : QThread(parent), path(path), algorithms(algorithms) {
+        for (QCryptographicHash::Algorithm algorithm : algorithms) {
+            hashes.emplace_back(new QCryptographicHash(algorithm));
+        }
+    }
+    
+    ~StreamHasher() override {
+        finish();
+    }
+    
+    // Accepts "sha256:<hex>" or bare hex, with the algorithm taken from its length.
+    static bool parseChecksum(const QString &text, QCryptographicHash::Algorithm *algorithm, QString *hex) {
+        QString value = text.trimmed().toLower();
+        QString name;
+        if (value.contains(':')) {
+            name = value.section(':', 0, 0).remove('-');
+            value = value.section(':', 1).trimmed();
+        }
+        static const QRegularExpression hexDigits("^[0-9a-f]+$");
+        if (!hexDigits.match(value).hasMatch()) return false;
+        
+        static const QVector<QPair<QString, QCryptographicHash::Algorithm>> known = {
+            {"md5", QCryptographicHash::Md5}, {"sha1", QCryptographicHash::Sha1},
+            {"sha256", QCryptographicHash::Sha256}, {"sha512", QCryptographicHash::Sha512}
+        };
+        for (const auto &candidate : known) {
+            bool lengthFits = value.size() == 2 * QCryptographicHash::hashLength(candidate.second);
+            if (lengthFits && (name.isEmpty() || name == candidate.first)) {
+                *algorithm = candidate.second;
+                *hex = value;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    static QString algorithmName(QCryptographicHash::Algorithm algorithm) {
+        switch (algorithm) {
+        case QCryptographicHash::Md5: return "md5";
+        case QCryptographicHash::Sha1: return "sha1";
+        case QCryptographicHash::Sha512: return "sha512";
+        default: return "sha256";
+        }
+    }
+    
+    // "verified", "mismatch", or "unavailable" when that algorithm was not computed
+    static QString verify(const QString &expected, const QStringList &digests) {
+        QCryptographicHash::Algorithm algorithm;
+        QString hex;
+        if (!parseChecksum(expected, &algorithm, &hex)) return "unavailable";
+        for (const QString &digest : digests) {
+            if (digest.section(':', 0, 0) == algorithmName(algorithm)) {
+                return digest.section(':', 1) == hex ? "verified" : "mismatch";
+            }
+        }
+        return "unavailable";
+    }
+    
+    void append(const QByteArray &data) {
+        enqueue({data, 0, 0});
+    }
+    
+    void appendFromFile(qint64 offset, qint64 length) {
+        enqueue({QByteArray(), offset, length});
+    }
+    
+    // Drains the queue and returns "name:hex" digests; normally only the
+    // last chunk or two are still pending when the transfer ends.
+    QStringList finish() {
+        {
+            QMutexLocker locker(&mutex);
+            closing = true;
+            wake.wakeOne();
+        }
+        wait();
+        
+        QStringList digests;
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            digests.append(algorithmName(algorithms[int(i)]) + ":" + QString::fromLatin1(hashes[i]->result().toHex()));
+        }
+        return digests;
+    }
+    
+    const QVector<QCryptographicHash::Algorithm> &computed() const { return algorithms; }
+    qint64 hashedBytes() const { return hashed.load(); }
+    qint64 readBackBytes() const { return readBack.load(); }
+
+protected:
+    void run() override {
+        for (;;) {
+            Job job;
+            {
+                QMutexLocker locker(&mutex);
+                while (!closing && jobs.isEmpty()) {
+                    wake.wait(&mutex);
+                }
+                if (jobs.isEmpty()) break;
+                job = jobs.takeFirst();
+            }
+            
+            if (job.length == 0) {
+                addData(job.data.constData(), job.data.size());
+                continue;
+            }
+            
+            QFile file(path);
+            if (!file.open(QIODevice::ReadOnly) || !file.seek(job.offset)) {
+                qDebug() << "Hash read-back failed:" << path << file.errorString();
+                continue;
+            }
+            for (qint64 left = job.length; left > 0;) {
+                QByteArray chunk = file.read(qMin<qint64>(left, 1 << 20));
+                if (chunk.isEmpty()) break;
+                addData(chunk.constData(), chunk.size());
+                readBack += chunk.size();
+                left -= chunk.size();
+            }
+        }
+    }
+
+private:
+    struct Job {
+        QByteArray data;
+        qint64 offset;
+        qint64 length;  // Non-zero for a read-back range
+    };
+    
+    void enqueue(const Job &job) {
+        QMutexLocker locker(&mutex);
+        if (closing) return;
+        jobs.append(job);
+        wake.wakeOne();
+    }
+    
+    void addData(const char *data, int size) {
+        for (const auto &hash : hashes) {
+            hash->addData(data, size);
+        }
+        hashed += size;
+    }
+    
+    QString path;
+    QVector<QCryptographicHash::Algorithm> algorithms;
+    std::vector<std::unique_ptr<QCryptographicHash>> hashes;
+    
+    QMutex mutex;
+    QWaitCondition wake;
+    QList<Job> jobs;
+    bool closing = false;
+    
+    std::atomic<qint64> hashed{0};
+    std::atomic<qint64> readBack{0};
+};
+
+/**
+ * One HTTP download spread over up to maxConnections Range requests that
+ * write into a preallocated .askpart file. The first request asks for
+ * "bytes=0-": a 206 reply with a total size becomes the first chunk and
+ * further connections take the following chunks in order, while a 200
+ * reply just streams on one connection. Chunks are only handed out within
+ * a window ahead of the hash frontier, so the bytes StreamHasher is still
+ * waiting on stay bounded in memory; an idle connection instead takes over
+ * the back half of the straggler holding the frontier. Lives entirely on
+ * the download thread.
+ */
+class SegmentedDownload : public QObject {
+public:
+    enum State { Queued, Running, Paused, Completed, Failed, Cancelled };
+    
+    struct Segment {
+        qint64 first = 0;
+        qint64 last = -1;  // Inclusive; -1 while the size is unknown
+        qint64 done = 0;
+        QNetworkReply *reply = nullptr;
+        qint64 onDisk = 0;  // Written by an earlier session; hashed by read-back
+        int retries = 0;
+        bool ended = false;  // Stream of unknown length closed cleanly
+        
+        bool complete() const { return ended || (last >= 0 && first + done > last); }
+        qint64 remaining() const { return last < 0 ? -1 : last + 1 - first - done; }
+    };
+    
+    SegmentedDownload(int id, const QUrl &url, const QString &path, int maxConnections,
+                      QNetworkAccessManager *network, QObject *parent = nullptr)
+        : QObject(parent), downloadId(id), source(url), target(path),
+          maxConnections(qMax(1, maxConnections)), network(network) {}
+    
+    ~SegmentedDownload() override {
+        for (Segment &segment : segments) {
+            release(segment);
+        }
+    }
+    
+    // Picks up persisted progress; the download comes back paused.
+    void restore(qint64 size, const QByteArray &savedValidator, const std::vector<Segment> &saved) {
+        totalSize = size;
+        validator = savedValidator;
+        segments = saved;
+        received = 0;
+        for (Segment &segment : segments) {
+            segment.onDisk = segment.done;
+            received += segment.done;
+            assignedEnd = qMax(assignedEnd, segment.last + 1);
+        }
+        currentState = Paused;
+    }
+    
+    // "algorithm:hex" or bare hex; checked against the streamed digest on completion.
+    // An advisory one (scraped from the page) is reported but never fails the download.
+    void setExpectedChecksum(const QString &checksum, bool advisory = false) {
+        expected = checksum;
+        expectedAdvisory = advisory;
+        QCryptographicHash::Algorithm algorithm;
+        QString hex;
+        if (hasher && hashFrontier == 0 && StreamHasher::parseChecksum(checksum, &algorithm, &hex)
+            && !hasher->computed().contains(algorithm)) {
+            // Nothing hashed yet, so the extra algorithm can still see every byte
+            startHasher();
+        }
+    }
+    
+    void setUserAgent(const QByteArray &agent) { userAgent = agent; }
+    
+    void start() {
+        if (currentState == Running || currentState == Completed || currentState == Cancelled) {
+            return;
+        }
+        if (received > 0 && !QFile::exists(partPath())) {
+            // The partial file went away; nothing on disk to resume from
+            segments.clear();
+            received = 0;
+            assignedEnd = 0;
+        }
+        file.setFileName(partPath());
+        if (!file.open(QIODevice::ReadWrite)) {
+            fail(file.errorString());
+            return;
+        }
+        if (segments.empty()) {
+            segments.push_back(Segment());
+            resetHash();
+        }
+        if (!hasher) {
+            startHasher();
+        }
+        errorText.clear();
+        setState(Running);
+        fillConnections();
+    }
+    
+    void pause() {
+        if (currentState != Running) return;
+        for (Segment &segment : segments) {
+            release(segment);
+        }
+        file.close();
+        setState(Paused);
+    }
+    
+    void cancel() {
+        if (currentState == Completed || currentState == Cancelled) return;
+        for (Segment &segment : segments) {
+            release(segment);
+        }
+        file.close();
+        QFile::remove(partPath());
+        segments.clear();
+        hasher.reset();
+        aheadOfHash.clear();
+        setState(Cancelled);
+    }
+    
+    int id() const { return downloadId; }
+    QUrl url() const { return source; }
+    QString path() const { return target; }
+    State state() const { return currentState; }
+    QString errorString() const { return errorText; }
+    QByteArray rangeValidator() const { return validator; }
+    qint64 totalBytes() const { return totalSize; }
+    qint64 receivedBytes() const { return received; }
+    const std::vector<Segment> &segmentList() const { return segments; }
+    QString expectedChecksum() const { return expected; }
+    bool checksumAdvisory() const { return expectedAdvisory; }
+    QStringList digests() const { return digestList; }
+    QString verification() const { return verificationResult; }
+    qint64 hashedBytes() const { return hasher ? hasher->hashedBytes() : hashedTotal; }
+    qint64 readBackBytes() const { return hasher ? hasher->readBackBytes() : readBackTotal; }
+    qint64 verifyTailMs() const { return tailMs; }
+    
+    int activeConnections() const {
+        int active = 0;
+        for (const Segment &segment : segments) {
+            active += segment.reply != nullptr;
+        }
+        return active;
+    }
+    
+    // Time spent running, excluding pauses
+    qint64 elapsedMs() const {
+        return runMs + (runClock.isValid() ? runClock.elapsed() : 0);
+    }
+    
+    static QString stateName(State state) {
+        static const char *const names[] = {
+            "Queued", "Downloading", "Paused", "Completed", "Failed", "Cancelled"
+        };
+        return names[state];
+    }
+    
+    std::function<void()> onStateChanged;
+
+private:
+    static const qint64 MinSegmentBytes = 256 * 1024;
+    static const qint64 MinChunkBytes = 1024 * 1024;
+    static const qint64 MaxChunkBytes = 4 * 1024 * 1024;
+    static const int MaxRetries = 3;
+    
+    QString partPath() const { return target + ".askpart"; }
+    
+    qint64 chunkBytes() const {
+        qint64 chunk = totalSize / (2 * maxConnections);
+        return chunk < MinChunkBytes ? MinChunkBytes : (chunk > MaxChunkBytes ? MaxChunkBytes : chunk);
+    }
+    
+    // How far past the hash frontier new chunks may start
+    qint64 windowBytes() const {
+        return 2 * maxConnections * chunkBytes();
+    }
+    
+    void setState(State state) {
+        if (state == Running) {
+            runClock.start();
+        } else if (runClock.isValid()) {
+            runMs += runClock.elapsed();
+            runClock.invalidate();
+        }
+        currentState = state;
+        if (onStateChanged) onStateChanged();
+    }
+    
+    int indexOf(const QNetworkReply *reply) const {
+        for (size_t i = 0; i < segments.size(); ++i) {
+            if (segments[i].reply == reply) return int(i);
+        }
+        return -1;
+    }
+    
+    void launch(size_t index) {
+        Segment &segment = segments[index];
+        QByteArray range = "bytes=" + QByteArray::number(segment.first + segment.done) + "-";
+        if (segment.last >= 0) {
+            range += QByteArray::number(segment.last);
+        }
+        
+        QNetworkRequest request(source);
+        request.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                             QNetworkRequest::NoLessSafeRedirectPolicy);
+        request.setRawHeader("Range", range);
+        // Offsets must be in the file's own bytes, not a decoded stream
+        request.setRawHeader("Accept-Encoding", "identity");
+        if (!validator.isEmpty()) {
+            request.setRawHeader("If-Range", validator);
+        }
+        if (!userAgent.isEmpty()) {
+            request.setHeader(QNetworkRequest::UserAgentHeader, userAgent);
+        }
+        
+        QNetworkReply *reply = network->get(request);
+        segment.reply = reply;
+        connect(reply, &QNetworkReply::metaDataChanged, this, [this, reply]() { handleHeaders(reply); });
+        connect(reply, &QNetworkReply::readyRead, this, [this, reply]() { handleData(reply); });
+        connect(reply, &QNetworkReply::finished, this, [this, reply]() { handleFinished(reply); });
+    }
+    
+    void release(Segment &segment) {
+        QNetworkReply *reply = segment.reply;
+        segment.reply = nullptr;
+        if (reply) {
+            reply->disconnect(this);
+            reply->abort();
+            reply->deleteLater();
+        }
+    }
+    
+    void handleHeaders(QNetworkReply *reply) {
+        int index = indexOf(reply);
+        int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if (index < 0 || status == 0 || (status >= 300 && status < 400)) {
+            return;
+        }
+        if (status >= 400) {
+            fail(QString("HTTP %1").arg(status));
+            return;
+        }
+        
+        if (status == 206) {
+            acceptsRanges = true;
+        } else if (segments.size() > 1 || segments[index].first + segments[index].done > 0) {
+            // Range ignored, or If-Range says the file changed: start over here
+            for (Segment &other : segments) {
+                if (other.reply != reply) release(other);
+            }
+            segments.assign(1, Segment());
+            segments[0].reply = reply;
+            received = 0;
+            totalSize = -1;
+            assignedEnd = 0;
+            file.resize(0);
+            resetHash();
+            startHasher();
+            index = 0;
+        }
+        
+        if (totalSize < 0) {
+            bool known = false;
+            if (status == 206) {
+                QByteArray range = reply->rawHeader("Content-Range");
+                totalSize = range.mid(range.lastIndexOf('/') + 1).toLongLong(&known);
+            } else {
+                totalSize = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong(&known);
+            }
+            if (!known) totalSize = -1;
+            
+            QByteArray etag = reply->rawHeader("ETag");
+            validator = (!etag.isEmpty() && !etag.startsWith("W/")) ? etag : reply->rawHeader("Last-Modified");
+            
+            if (totalSize >= 0) {
+                Segment &segment = segments[index];
+                file.resize(totalSize);
+                segment.last = acceptsRanges ? qMin(totalSize, segment.first + segment.done + chunkBytes()) - 1
+                                             : totalSize - 1;
+                assignedEnd = segment.last + 1;
+            }
+            if (status == 206) {
+                fillConnections();
+            }
+        }
+    }
+    
+    void handleData(QNetworkReply *reply) {
+        int index = indexOf(reply);
+        if (index < 0) return;
+        
+        Segment &segment = segments[index];
+        QByteArray data = reply->readAll();
+        qint64 offset = segment.first + segment.done;
+        qint64 length = data.size();
+        if (segment.last >= 0) {
+            // A split segment's request still runs to the old end
+            length = qMin(length, segment.last + 1 - offset);
+        }
+        if (length > 0) {
+            if (!file.seek(offset) || file.write(data.constData(), length) != length) {
+                fail(file.errorString());
+                return;
+            }
+            segment.done += length;
+            received += length;
+            feedHash(offset, length == data.size() ? data : data.left(int(length)));
+        }
+        if (segment.complete()) {
+            release(segment);
+            fillConnections();
+        } else if (activeConnections() < maxConnections && acceptsRanges) {
+            // The frontier may have moved far enough to open the window again
+            fillConnections();
+        }
+    }
+    
+    void handleFinished(QNetworkReply *reply) {
+        int index = indexOf(reply);
+        if (index < 0) return;
+        
+        Segment &segment = segments[index];
+        segment.reply = nullptr;
+        reply->deleteLater();
+        if (currentState != Running) return;
+        
+        if (reply->error() == QNetworkReply::NoError && (segment.last < 0 || segment.complete())) {
+            if (segment.last < 0) {
+                // Size unknown until the single stream ended
+                segment.ended = true;
+                totalSize = received;
+            }
+            fillConnections();
+            return;
+        }
+        if (++segment.retries > MaxRetries) {
+            fail(reply->error() == QNetworkReply::NoError ? QString("Connection closed early")
+                                                          : reply->errorString());
+            return;
+        }
+        QTimer::singleShot(500 * segment.retries, this, [this]() {
+            if (currentState == Running) fillConnections();
+        });
+    }
+    
+    // Keeps up to maxConnections segments in flight, then checks for completion.
+    void fillConnections() {
+        if (currentState != Running) return;
+        
+        bool splittable = acceptsRanges && totalSize >= 0;
+        compactSegments();
+        for (size_t i = 0; i < segments.size() && activeConnections() < maxConnections; ++i) {
+            if (!segments[i].reply && !segments[i].complete()) {
+                launch(i);
+            }
+        }
+        while (splittable && activeConnections() < maxConnections) {
+            if (assignedEnd < totalSize && assignedEnd < hashFrontier + windowBytes()) {
+                Segment chunk;
+                chunk.first = assignedEnd;
+                chunk.last = qMin(totalSize, assignedEnd + chunkBytes()) - 1;
+                assignedEnd = chunk.last + 1;
+                segments.push_back(chunk);
+                launch(segments.size() - 1);
+            } else if (!splitStraggler()) {
+                break;
+            }
+        }
+        
+        bool done = (totalSize < 0 || assignedEnd >= totalSize)
+                 && std::all_of(segments.begin(), segments.end(),
+                                [](const Segment &segment) { return segment.complete(); });
+        if (done) {
+            finish();
+        }
+    }
+    
+    // Complete segments the hash has already passed collapse into one, so a
+    // long download keeps a handful of segments rather than one per chunk.
+    void compactSegments() {
+        std::sort(segments.begin(), segments.end(), [](const Segment &a, const Segment &b) {
+            return a.first < b.first;
+        });
+        auto settled = [this](const Segment &segment) {
+            return segment.complete() && !segment.reply && segment.last >= 0 && segment.last < hashFrontier;
+        };
+        std::vector<Segment> kept;
+        kept.reserve(segments.size());
+        for (const Segment &segment : segments) {
+            if (!kept.empty() && settled(kept.back()) && settled(segment)
+                && kept.back().last + 1 == segment.first) {
+                kept.back().last = segment.last;
+                kept.back().done += segment.done;
+                kept.back().onDisk = kept.back().done;
+            } else {
+                kept.push_back(segment);
+            }
+        }
+        segments.swap(kept);
+    }
+    
+    // Halves the in-flight segment furthest behind, which is what holds the frontier.
+    bool splitStraggler() {
+        int straggler = -1;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const Segment &segment = segments[i];
+            if (segment.reply && segment.remaining() >= 2 * MinSegmentBytes
+                && (straggler < 0 || segment.first + segment.done
+                                     < segments[straggler].first + segments[straggler].done)) {
+                straggler = int(i);
+            }
+        }
+        if (straggler < 0) {
+            return false;
+        }
+        
+        Segment piece;
+        piece.first = segments[straggler].first + segments[straggler].done + segments[straggler].remaining() / 2;
+        piece.last = segments[straggler].last;
+        segments[straggler].last = piece.first - 1;
+        segments.push_back(piece);
+        launch(segments.size() - 1);
+        return true;
+    }
+    
+    void startHasher() {
+        QVector<QCryptographicHash::Algorithm> algorithms = {QCryptographicHash::Sha256};
+        QCryptographicHash::Algorithm algorithm;
+        QString hex;
+        if (StreamHasher::parseChecksum(expected, &algorithm, &hex) && algorithm != QCryptographicHash::Sha256) {
+            algorithms.append(algorithm);
+        }
+        hasher.reset(new StreamHasher(partPath(), algorithms));
+        hasher->start(QThread::LowPriority);
+        hashFrontier = 0;
+        advanceHash();
+    }
+    
+    void resetHash() {
+        hasher.reset();
+        aheadOfHash.clear();
+        hashFrontier = 0;
+    }
+    
+    void feedHash(qint64 offset, const QByteArray &data) {
+        if (!hasher) return;
+        if (offset == hashFrontier) {
+            hasher->append(data);
+            hashFrontier += data.size();
+            advanceHash();
+        } else if (offset > hashFrontier) {
+            aheadOfHash.insert(offset, data);
+        }
+    }
+    
+    // Moves the frontier over chunks that were waiting for it and over
+    // ranges an earlier session left on disk.
+    void advanceHash() {
+        for (;;) {
+            auto waiting = aheadOfHash.find(hashFrontier);
+            if (waiting != aheadOfHash.end()) {
+                hasher->append(waiting.value());
+                hashFrontier += waiting.value().size();
+                aheadOfHash.erase(waiting);
+                continue;
+            }
+            
+            auto onDisk = std::find_if(segments.begin(), segments.end(), [this](const Segment &segment) {
+                return segment.first <= hashFrontier && hashFrontier < segment.first + segment.onDisk;
+            });
+            if (onDisk == segments.end()) {
+                break;
+            }
+            qint64 end = onDisk->first + onDisk->onDisk;
+            hasher->appendFromFile(hashFrontier, end - hashFrontier);
+            hashFrontier = end;
+        }
+    }
+    
+    void finish() {
+        file.close();
+        
+        QElapsedTimer tail;
+        tail.start();
+        bool hashedAll = hasher && hashFrontier == received;
+        digestList = hasher ? hasher->finish() : QStringList();
+        hashedTotal = hasher ? hasher->hashedBytes() : 0;
+        readBackTotal = hasher ? hasher->readBackBytes() : 0;
+        hasher.reset();
+        tailMs = tail.elapsed();
+        if (!hashedAll) {
+            qDebug() << "Download hash incomplete:" << source.toString();
+            digestList.clear();
+        }
+        
+        verificationResult = expected.isEmpty() ? QString() : StreamHasher::verify(expected, digestList);
+        if (verificationResult == "mismatch" && expectedAdvisory) {
+            // The page may have shown some other hash; keep the file and let the user judge
+            qDebug() << "Download does not match the page's checksum:" << source.toString();
+        } else if (verificationResult == "mismatch") {
+            // Start from scratch if resumed; the bytes on disk are not the advertised file
+            QFile::remove(partPath());
+            segments.clear();
+            received = 0;
+            assignedEnd = 0;
+            resetHash();
+            fail("Checksum mismatch");
+            return;
+        }
+        
+        if (QFile::exists(target)) {
+            QFile::remove(target);
+        }
+        if (!QFile::rename(partPath(), target)) {
+            fail("Cannot move download into place");
+            return;
+        }
+        segments.clear();
+        setState(Completed);
+    }
+    
+    void fail(const QString &message) {
+        for (Segment &segment : segments) {
+            release(segment);
+        }
+        file.close();
+        errorText = message;
+        qDebug() << "Download failed:" << source.toString() << message;
+        setState(Failed);
+    }
+    
+    int downloadId;
+    QUrl source;
+    QString target;
+    int maxConnections;
+    QNetworkAccessManager *network;
+    QByteArray userAgent;
+    
+    QFile file;
+    std::vector<Segment> segments;
+    QByteArray validator;
+    qint64 totalSize = -1;
+    qint64 received = 0;
+    qint64 assignedEnd = 0;
+    bool acceptsRanges = false;
+    State currentState = Queued;
+    QString errorText;
+    
+    std::unique_ptr<StreamHasher> hasher;
+    qint64 hashFrontier = 0;
+    QMap<qint64, QByteArray> aheadOfHash;
+    QString expected;
+    bool expectedAdvisory = false;
+    QStringList digestList;
+    QString verificationResult;
+    qint64 hashedTotal = 0;
+    qint64 readBackTotal = 0;
+    qint64 tailMs = 0;
+    
+    QElapsedTimer runClock;
+    qint64 runMs = 0;
+};
+
+/**
+ * Owns every download. HTTP(S) downloads requested by the web profile are
+ * re-fetched by SegmentedDownload on a dedicated network thread, with
+ * progress persisted to the downloads tables so they survive a restart;
+ * anything Chromium must fetch itself (blob:, data:, saved pages) is
+ * accepted natively and only tracked. Each attached profile gets its own
+ * network and cookie jar, keyed by storage name, so a re-fetch carries
+ * only the cookies of the workspace it came from. The GUI reads a snapshot.
+ */
+class DownloadManager : public QObject {
+public:
+    struct Info {
+        int id = 0;
+        QString url;
+        QString path;
+        QString state;
+        QString error;
+        qint64 totalBytes = -1;
+        qint64 receivedBytes = 0;
+        double bytesPerSecond = 0;  // Current rate while running, average once completed
+        int connections = 0;
+        qint64 createdAt = 0;
+        QString checksum;
+        bool checksumAdvisory = false;  // Scraped from the page rather than given by the user
+        QStringList digests;
+        QString verification;  // Empty, "verified", "mismatch" or "unavailable"
+        qint64 hashedBytes = 0;
+        qint64 readBackBytes = 0;
+        qint64 verifyTailMs = 0;  // Hashing left when the last byte arrived
+    };
+    
+    // One manager per process: the worker uses a fixed connection name.
+    // Qt opens at most six HTTP/1.1 connections per host, hence the default.
+    DownloadManager(const QString &databasePath, int maxConnections = 6, QObject *parent = nullptr)
+        : QObject(parent), databasePath(databasePath), maxConnections(maxConnections) {
+        worker = new QThread(this);
+        context = new QObject();
+        context->moveToThread(worker);
+        worker->start(QThread::LowPriority);
+        QMetaObject::invokeMethod(context, [this]() { initialize(); });
+    }
+    
+    ~DownloadManager() override {
+        QMetaObject::invokeMethod(context, [this]() { shutdownWorker(); }, Qt::BlockingQueuedConnection);
+        worker->quit();
+        worker->wait();
+        delete context;
+    }
+    
+    void attach(QWebEngineProfile *profile) {
+        QByteArray agent = profile->httpUserAgent().toUtf8();
+        QMetaObject::invokeMethod(context, [this, agent]() { userAgent = agent; });
+        
+        const QString key = profile->storageName();
+        QWebEngineCookieStore *cookies = profile->cookieStore();
+        connect(cookies, &QWebEngineCookieStore::cookieAdded, this, [this, key](const QNetworkCookie &cookie) {
+            QMetaObject::invokeMethod(context, [this, key, cookie]() { jarFor(key)->insertCookie(cookie); });
+        });
+        connect(cookies, &QWebEngineCookieStore::cookieRemoved, this, [this, key](const QNetworkCookie &cookie) {
+            QMetaObject::invokeMethod(context, [this, key, cookie]() { jarFor(key)->deleteCookie(cookie); });
+        });
+        cookies->loadAllCookies();
+        
+        connect(profile, &QWebEngineProfile::downloadRequested, this, [this, key](QWebEngineDownloadItem *item) {
+            QUrl url = item->url();
+            QString path = QDir(item->downloadDirectory()).filePath(item->downloadFileName());
+            if (item->isSavePageDownload() || (url.scheme() != "http" && url.scheme() != "https")) {
+                track(item, path);
+                return;
+            }
+            
+            // Left unaccepted, Chromium drops its own copy of the request. The
+            // page gets a moment to offer a checksum for the file first.
+            auto started = std::make_shared<bool>(false);
+            auto startOnce = [this, url, path, key, started](const QString &checksum) {
+                if (*started) return;
+                *started = true;
+                start(url, path, checksum, key, true);
+            };
+            if (QWebEnginePage *page = item->page()) {
+                page->runJavaScript(checksumProbeScript(item->downloadFileName()),
+                                    [startOnce](const QVariant &found) { startOnce(found.toString()); });
+            }
+            QTimer::singleShot(1000, this, [startOnce]() { startOnce(QString()); });
+        });
+    }
+    
+    // profile is the storage name of an attached profile; empty for a cookie-less fetch.
+    // checksumAdvisory marks one scraped from the page: a mismatch is shown, not enforced.
+    void start(const QUrl &url, const QString &path, const QString &checksum = QString(),
+               const QString &profile = QString(), bool checksumAdvisory = false) {
+        QString target = uniquePath(path);
+        qint64 now = QDateTime::currentSecsSinceEpoch();
+        QMetaObject::invokeMethod(context, [this, url, target, now, checksum, profile, checksumAdvisory]() {
+            QSqlQuery query(QSqlDatabase::database(ConnectionName));
+            query.prepare(R"(
+                INSERT INTO downloads (url, path, state, created_at, checksum, profile, checksum_advisory)
+                VALUES (?, ?, 'Queued', ?, ?, ?, ?)
+            )");
+            query.addBindValue(url.toString());
+            query.addBindValue(target);
+            query.addBindValue(now);
+            query.addBindValue(checksum);
+            query.addBindValue(profile);
+            query.addBindValue(checksumAdvisory ? 1 : 0);
+            int id = query.exec() ? query.lastInsertId().toInt() : unsavedId++;
+            
+            Info info;
+            info.id = id;
+            info.url = url.toString();
+            info.path = target;
+            info.createdAt = now;
+            info.checksum = checksum;
+            info.checksumAdvisory = checksumAdvisory;
+            {
+                QMutexLocker locker(&mutex);
+                infos.insert(id, info);
+            }
+            SegmentedDownload *download = adopt(new SegmentedDownload(
+                id, url, target, maxConnections, networkFor(profile), context));
+            download->setExpectedChecksum(checksum, checksumAdvisory);
+            download->start();
+        });
+    }
+    
+    // User-supplied checksum; a finished download is checked against its stored digests.
+    void setChecksum(int id, const QString &checksum) {
+        QCryptographicHash::Algorithm algorithm;
+        QString hex;
+        if (!StreamHasher::parseChecksum(checksum, &algorithm, &hex)) return;
+        const QString normalized = StreamHasher::algorithmName(algorithm) + ":" + hex;
+        
+        if (id < 0) {
+            // Chromium wrote this one; there is no streamed digest to compare
+            QMutexLocker locker(&mutex);
+            infos[id].checksum = normalized;
+            infos[id].checksumAdvisory = false;
+            infos[id].verification = "unavailable";
+            return;
+        }
+        QMetaObject::invokeMethod(context, [this, id, normalized]() {
+            if (SegmentedDownload *download = active.value(id)) {
+                download->setExpectedChecksum(normalized);
+                persist(download);
+                publish(download);
+                return;
+            }
+            
+            QSqlQuery query(QSqlDatabase::database(ConnectionName));
+            query.prepare("UPDATE downloads SET checksum = ?, checksum_advisory = 0 WHERE id = ?");
+            query.addBindValue(normalized);
+            query.addBindValue(id);
+            query.exec();
+            
+            QMutexLocker locker(&mutex);
+            Info &info = infos[id];
+            info.checksum = normalized;
+            info.checksumAdvisory = false;
+            info.verification = StreamHasher::verify(normalized, info.digests);
+        });
+    }
+    
+    void pause(int id) {
+        if (id < 0) {
+            if (QWebEngineDownloadItem *item = nativeItems.value(id)) item->pause();
+            return;
+        }
+        QMetaObject::invokeMethod(context, [this, id]() {
+            if (SegmentedDownload *download = active.value(id)) download->pause();
+        });
+    }
+    
+    void resume(int id) {
+        if (id < 0) {
+            if (QWebEngineDownloadItem *item = nativeItems.value(id)) item->resume();
+            return;
+        }
+        QMetaObject::invokeMethod(context, [this, id]() {
+            if (SegmentedDownload *download = active.value(id)) download->start();
+        });
+    }
+    
+    void cancel(int id) {
+        if (id < 0) {
+            if (QWebEngineDownloadItem *item = nativeItems.value(id)) item->cancel();
+            return;
+        }
+        QMetaObject::invokeMethod(context, [this, id]() {
+            if (SegmentedDownload *download = active.value(id)) download->cancel();
+        });
+    }
+    
+    // Newest first
+    QVector<Info> downloads() const {
+        QVector<Info> list;
+        {
+            QMutexLocker locker(&mutex);
+            list.reserve(infos.size());
+            for (const Info &info : infos) list.append(info);
+        }
+        std::stable_sort(list.begin(), list.end(), [](const Info &a, const Info &b) {
+            return a.createdAt > b.createdAt;
+        });
+        return list;
+    }
+
+private:
+    static constexpr const char *ConnectionName = "ask_downloads";
+    static const int TickMs = 500;
+    static const int PersistEveryTicks = 4;
+    
+    // Looks for a digest on the line naming the file, or a lone SHA-256 on the page.
+    // Short digests need an algorithm label: a bare 40-hex string is as likely a commit.
+    static QString checksumProbeScript(const QString &fileName) {
+        QString name = QString::fromUtf8(QJsonDocument(QJsonArray{fileName}).toJson(QJsonDocument::Compact));
+        return QString(R"(
+            (function (name) {
+                var text = document.body ? document.body.innerText : '';
+                var lines = text.split('\n');
+                var labelled = /\b(md5|sha-?1|sha-?256|sha-?512)\b.{0,80}?\b([0-9a-fA-F]{128}|[0-9a-fA-F]{64}|[0-9a-fA-F]{40}|[0-9a-fA-F]{32})\b/i;
+                var unlabelled = /\b([0-9a-fA-F]{128}|[0-9a-fA-F]{64})\b/;
+                function digest(line) {
+                    var match = line.match(labelled);
+                    if (match) return match[1].replace('-', '').toLowerCase() + ':' + match[2];
+                    match = line.match(unlabelled);
+                    return match ? match[1] : '';
+                }
+                for (var i = 0; name && i < lines.length; ++i) {
+                    if (lines[i].indexOf(name) === -1) continue;
+                    var found = digest(lines[i]) || digest(lines[i + 1] || '');
+                    if (found) return found;
+                }
+                var sha256 = text.match(/\b[0-9a-fA-F]{64}\b/g);
+                return sha256 && sha256.length === 1 ? sha256[0] : '';
+            })(%1[0])
+        )").arg(name);
+    }
+    
+    static QString uniquePath(const QString &path) {
+        QFileInfo info(path);
+        QString candidate = path;
+        for (int n = 1; QFile::exists(candidate) || QFile::exists(candidate + ".askpart"); ++n) {
+            QString suffix = info.completeSuffix().isEmpty() ? QString() : "." + info.completeSuffix();
+            candidate = info.dir().filePath(QString("%1 (%2)%3").arg(info.baseName()).arg(n).arg(suffix));
+        }
+        return candidate;
+    }
+    
+    // Download thread from here on, except track()
+    void initialize() {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", ConnectionName);
+        db.setDatabaseName(databasePath);
+        if (db.open()) {
+            QSqlQuery(db).exec("PRAGMA busy_timeout=2000");
+            migrateBrowserSchema(db);
+            loadDownloads(db);
+        } else {
+            qDebug() << "Download database error:" << db.lastError().text();
+        }
+        
+        tick = new QTimer(context);
+        connect(tick, &QTimer::timeout, context, [this]() { sample(); });
+        tick->start(TickMs);
+    }
+    
+    void shutdownWorker() {
+        delete tick;
+        tick = nullptr;
+        for (SegmentedDownload *download : active) {
+            download->pause();
+        }
+        qDeleteAll(active);
+        active.clear();
+        qDeleteAll(networks);  // Each owns its cookie jar
+        networks.clear();
+        QSqlDatabase::database(ConnectionName).close();
+        QSqlDatabase::removeDatabase(ConnectionName);
+    }
+    
+    void loadDownloads(QSqlDatabase &db) {
+        QSqlQuery query(db);
+        query.exec(R"(
+            SELECT id, url, path, state, total_bytes, validator, created_at, checksum, digests, profile,
+                   checksum_advisory
+            FROM downloads ORDER BY id DESC LIMIT 100
+        )");
+        QSqlQuery segmentQuery(db);
+        segmentQuery.prepare("SELECT first_byte, last_byte, done_bytes FROM download_segments WHERE download_id = ?");
+        
+        while (query.next()) {
+            Info info;
+            info.id = query.value(0).toInt();
+            info.url = query.value(1).toString();
+            info.path = query.value(2).toString();
+            info.state = query.value(3).toString();
+            info.totalBytes = query.value(4).toLongLong();
+            info.createdAt = query.value(6).toLongLong();
+            info.checksum = query.value(7).toString();
+            info.checksumAdvisory = query.value(10).toBool();
+            info.digests = query.value(8).toString().split(' ', Qt::SkipEmptyParts);
+            
+            if (info.state != "Completed" && info.state != "Cancelled") {
+                std::vector<SegmentedDownload::Segment> segments;
+                segmentQuery.addBindValue(info.id);
+                segmentQuery.exec();
+                while (segmentQuery.next()) {
+                    SegmentedDownload::Segment segment;
+                    segment.first = segmentQuery.value(0).toLongLong();
+                    segment.last = segmentQuery.value(1).toLongLong();
+                    segment.done = segmentQuery.value(2).toLongLong();
+                    segments.push_back(segment);
+                }
+                SegmentedDownload *download = adopt(new SegmentedDownload(
+                    info.id, QUrl(info.url), info.path, maxConnections, networkFor(query.value(9).toString()), context));
+                download->restore(info.totalBytes, query.value(5).toByteArray(), segments);
+                download->setExpectedChecksum(info.checksum, info.checksumAdvisory);
+                info.state = SegmentedDownload::stateName(download->state());
+                info.receivedBytes = download->receivedBytes();
+            } else if (info.state == "Completed") {
+                info.receivedBytes = info.totalBytes;
+                if (!info.checksum.isEmpty()) {
+                    info.verification = StreamHasher::verify(info.checksum, info.digests);
+                }
+            }
+            QMutexLocker locker(&mutex);
+            infos.insert(info.id, info);
+        }
+    }
+    
+    // Created on first use: restored downloads can come before their profile is attached
+    QNetworkAccessManager *networkFor(const QString &profile) {
+        QNetworkAccessManager *&network = networks[profile];
+        if (!network) {
+            network = new QNetworkAccessManager(context);
+            network->setCookieJar(new DownloadCookieJar());
+        }
+        return network;
+    }
+    
+    DownloadCookieJar *jarFor(const QString &profile) {
+        return static_cast<DownloadCookieJar*>(networkFor(profile)->cookieJar());
+    }
+    
+    SegmentedDownload *adopt(SegmentedDownload *download) {
+        int id = download->id();
+        active.insert(id, download);
+        download->setUserAgent(userAgent);
+        download->onStateChanged = [this, download, id]() {
+            persist(download);
+            publish(download);
+            SegmentedDownload::State state = download->state();
+            if (state == SegmentedDownload::Completed || state == SegmentedDownload::Cancelled) {
+                active.remove(id);
+                rates.remove(id);
+                download->deleteLater();
+            }
+        };
+        return download;
+    }
+    
+    void sample() {
+        ++ticks;
+        for (SegmentedDownload *download : active) {
+            if (download->state() != SegmentedDownload::Running) continue;
+            
+            qint64 received = download->receivedBytes();
+            QPair<qint64, double> &rate = rates[download->id()];
+            double instant = (received - rate.first) * 1000.0 / TickMs;
+            rate.second = rate.first == 0 ? instant : 0.6 * rate.second + 0.4 * instant;
+            rate.first = received;
+            
+            publish(download);
+            if (ticks % PersistEveryTicks == 0) {
+                persist(download);
+            }
+        }
+    }
+    
+    void publish(SegmentedDownload *download) {
+        QMutexLocker locker(&mutex);
+        Info &info = infos[download->id()];
+        info.state = SegmentedDownload::stateName(download->state());
+        info.error = download->errorString();
+        info.path = download->path();
+        info.totalBytes = download->totalBytes();
+        info.receivedBytes = download->receivedBytes();
+        info.connections = download->activeConnections();
+        info.checksum = download->expectedChecksum();
+        info.checksumAdvisory = download->checksumAdvisory();
+        info.digests = download->digests();
+        info.verification = download->verification();
+        info.hashedBytes = download->hashedBytes();
+        info.readBackBytes = download->readBackBytes();
+        info.verifyTailMs = download->verifyTailMs();
+        if (download->state() == SegmentedDownload::Running) {
+            info.bytesPerSecond = rates.value(download->id()).second;
+        } else if (download->state() == SegmentedDownload::Completed && download->elapsedMs() > 0) {
+            info.bytesPerSecond = download->receivedBytes() * 1000.0 / download->elapsedMs();
+        } else {
+            info.bytesPerSecond = 0;
+        }
+    }
+    
+    void persist(SegmentedDownload *download) {
+        QSqlDatabase db = QSqlDatabase::database(ConnectionName);
+        if (!db.isOpen()) return;
+        
+        db.transaction();
+        QSqlQuery query(db);
+        query.prepare(R"(
+            UPDATE downloads SET state = ?, total_bytes = ?, validator = ?, path = ?, checksum = ?, digests = ?,
+                                 checksum_advisory = ?
+            WHERE id = ?
+        )");
+        query.addBindValue(SegmentedDownload::stateName(download->state()));
+        query.addBindValue(download->totalBytes());
+        query.addBindValue(download->rangeValidator());
+        query.addBindValue(download->path());
+        query.addBindValue(download->expectedChecksum());
+        query.addBindValue(download->digests().join(' '));
+        query.addBindValue(download->checksumAdvisory() ? 1 : 0);
+        query.addBindValue(download->id());
+        query.exec();
+        
+        query.prepare("DELETE FROM download_segments WHERE download_id = ?");
+        query.addBindValue(download->id());
+        query.exec();
+        
+        query.prepare(R"(
+            INSERT INTO download_segments (download_id, first_byte, last_byte, done_bytes)
+            VALUES (?, ?, ?, ?)
+        )");
+        for (const SegmentedDownload::Segment &segment : download->segmentList()) {
+            query.addBindValue(download->id());
+            query.addBindValue(segment.first);
+            query.addBindValue(segment.last);
+            query.addBindValue(segment.done);
+            query.exec();
+        }
+        if (!db.commit()) {
+            qDebug() << "Download persist error:" << db.lastError().text();
+            db.rollback();
+        }
+    }
+    
+    // GUI thread: downloads Chromium keeps for itself
+    void track(QWebEngineDownloadItem *item, const QString &path) {
+        int id = nextNativeId--;
+        nativeItems.insert(id, item);
+        
+        Info info;
+        info.id = id;
+        info.url = item->url().toString();
+        info.path = path;
+        info.state = SegmentedDownload::stateName(SegmentedDownload::Running);
+        info.connections = 1;
+        info.createdAt = QDateTime::currentSecsSinceEpoch();
+        {
+            QMutexLocker locker(&mutex);
+            infos.insert(id, info);
+        }
+        
+        auto clock = std::make_shared<QElapsedTimer>();
+        auto lastReceived = std::make_shared<qint64>(0);
+        clock->start();
+        connect(item, &QWebEngineDownloadItem::downloadProgress, this,
+                [this, id, clock, lastReceived](qint64 received, qint64 total) {
+            qint64 ms = clock->restart();
+            QMutexLocker locker(&mutex);
+            Info &info = infos[id];
+            if (ms > 0) {
+                info.bytesPerSecond = 0.6 * info.bytesPerSecond + 0.4 * (received - *lastReceived) * 1000.0 / ms;
+            }
+            *lastReceived = received;
+            info.receivedBytes = received;
+            info.totalBytes = total;
+        });
+        auto updateState = [this, id, item]() {
+            QMutexLocker locker(&mutex);
+            Info &info = infos[id];
+            switch (item->state()) {
+            case QWebEngineDownloadItem::DownloadCompleted:
+                info.state = SegmentedDownload::stateName(SegmentedDownload::Completed);
+                break;
+            case QWebEngineDownloadItem::DownloadCancelled:
+                info.state = SegmentedDownload::stateName(SegmentedDownload::Cancelled);
+                break;
+            case QWebEngineDownloadItem::DownloadInterrupted:
+                info.state = SegmentedDownload::stateName(SegmentedDownload::Failed);
+                info.error = item->interruptReasonString();
+                break;
+            default:
+                info.state = SegmentedDownload::stateName(item->isPaused() ? SegmentedDownload::Paused
+                                                                           : SegmentedDownload::Running);
+                break;
+            }
+            info.connections = item->isFinished() || item->isPaused() ? 0 : 1;
+            if (item->isFinished() || item->isPaused()) info.bytesPerSecond = 0;
+        };
+        connect(item, &QWebEngineDownloadItem::stateChanged, this, updateState);
+        connect(item, &QWebEngineDownloadItem::isPausedChanged, this, updateState);
+        item->accept();
+    }
+    
+    QString databasePath;
+    int maxConnections;
+    QThread *worker = nullptr;
+    QObject *context = nullptr;
+    
+    // Download thread
+    QHash<QString, QNetworkAccessManager*> networks;  // By profile storage name
+    QTimer *tick = nullptr;
+    QByteArray userAgent;
+    QHash<int, SegmentedDownload*> active;
+    QHash<int, QPair<qint64, double>> rates;  // Bytes at last tick, smoothed bytes/s
+    int ticks = 0;
+    int unsavedId = 1 << 30;
+    
+    // GUI thread
+    QHash<int, QPointer<QWebEngineDownloadItem>> nativeItems;
+    int nextNativeId = -1;
+    
+    mutable QMutex mutex;
+    QMap<int, Info> infos;
+};
+
+// ============================================================================
+// INTERNAL PAGES
+// ============================================================================
+
+static const char aiPageHtml[] = R"(
+<html>
+<head>
+    <style>
+        body {
+            background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
+            color: white;
+            font-family: 'Segoe UI', sans-serif;
+            padding: 40px;
+            margin: 0;
+        }
+        .container {
+            max-width: 800px;
+            margin: 0 auto;
+        }
+        h1 {
+            background: linear-gradient(135deg, #00d4ff, #ff00ff);
+            -webkit-background-clip: text;
+            -webkit-text-fill-color: transparent;
+            font-size: 48px;
+            margin-bottom: 20px;
+        }
+        .ai-card {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 16px;
+            padding: 30px;
+            margin: 20px 0;
+            cursor: pointer;
+            transition: all 0.3s;
+        }
+        .ai-card:hover {
+            background: rgba(0, 212, 255, 0.1);
+            border-color: #00d4ff;
+            transform: translateY(-5px);
+            box-shadow: 0 10px 30px rgba(0, 212, 255, 0.3);
+        }
+        .ai-card h3 {
+            color: #00d4ff;
+            margin-top: 0;
+        }
+        .chat-box {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 12px;
+            padding: 20px;
+            margin-top: 30px;
+        }
+        input {
+            width: 100%;
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 8px;
+            color: white;
+            padding: 15px;
+            font-size: 16px;
+            box-sizing: border-box;
+        }
+    </style>
+</head>
+<body>
+    <div class="container">
+        <h1>✨ AI Assistant</h1>
+        <p style="font-size: 18px; opacity: 0.8;">Choose your AI tool or ask me anything about the current page</p>
+        
+        <div class="ai-card" onclick="window.location.href='https://gemini.google.com'">
+            <h3>🤖 Google Gemini</h3>
+            <p>Advanced AI for complex reasoning and creative tasks</p>
+        </div>
+        
+        <div class="ai-card" onclick="window.location.href='https://chat.openai.com'">
+            <h3>💬 ChatGPT</h3>
+            <p>OpenAI's conversational AI assistant</p>
+        </div>
+        
+        <div class="ai-card" onclick="window.location.href='https://claude.ai'">
+            <h3>🧠 Claude</h3>
+            <p>Anthropic's thoughtful and detailed AI</p>
+        </div>
+        
+        <div class="chat-box">
+            <h3 style="margin-top: 0;">Quick Ask</h3>
+            <input type="text" placeholder="Ask me to summarize this page, explain code, or answer questions..." />
+            <p style="font-size: 12px; opacity: 0.6; margin-top: 10px;">
+                💡 Coming soon: Context-aware AI that reads your current page
+            </p>
+        </div>
+    </div>
+</body>
+</html>
+)";
+
+static const char downloadsPageHtml[] = R"(
+<html>
+<head>
+    <style>
+        body {
+            background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
+            color: white;
+            font-family: 'Segoe UI', sans-serif;
+            padding: 40px;
+        }
+        h1 { color: #00d4ff; }
+        .download-item {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 12px;
+            padding: 20px;
+            margin: 15px 0;
+        }
+        .progress-bar {
+            width: 100%;
+            height: 8px;
+            background: rgba(255, 255, 255, 0.1);
+            border-radius: 4px;
+            overflow: hidden;
+            margin: 10px 0;
+        }
+        .progress-fill {
+            height: 100%;
+            background: linear-gradient(90deg, #00d4ff, #ff00ff);
+            transition: width 0.4s;
+        }
+        button {
+            background: rgba(0, 212, 255, 0.15);
+            color: #00d4ff;
+            border: 1px solid #00d4ff;
+            border-radius: 8px;
+            padding: 6px 14px;
+            margin-right: 8px;
+            cursor: pointer;
+        }
+    </style>
+</head>
+<body>
+    <h1>📥 Download Manager</h1>
+    <p>Large files are fetched over parallel range requests; pause and resume survive restarts.</p>
+    <div id="list"></div>
+    
+    <script>
+        var actions = [];
+        var list = document.getElementById('list');
+        list.onclick = function (event) {
+            var action = event.target.dataset.action;
+            var id = event.target.dataset.id;
+            if (action === 'checksum') {
+                actions.push(action + ':' + id + ':' + document.getElementById('checksum-' + id).value);
+            } else if (action) {
+                actions.push(action + ':' + id);
+            }
+        };
+        function takeActions() {
+            var taken = actions;
+            actions = [];
+            return taken;
+        }
+        function escapeText(text) {
+            var node = document.createElement('div');
+            node.textContent = text;
+            return node.innerHTML;
+        }
+        function megabytes(bytes) {
+            return (bytes / 1048576).toFixed(1) + ' MB';
+        }
+        function button(action, label, id) {
+            return '<button data-action="' + action + '" data-id="' + id + '">' + label + '</button>';
+        }
+        function integrity(item) {
+            var badges = {
+                verified: '<span style="color: #00ff88;">✓ matches ' + escapeText(item.checksum.split(':')[0]) + '</span>',
+                mismatch: item.checksumAdvisory
+                    ? '<span style="color: #ffaa44;">⚠ does not match the checksum on the page</span>'
+                    : '<span style="color: #ff4466;">✗ checksum mismatch</span>',
+                unavailable: '<span style="opacity: 0.6;">cannot compare that checksum</span>'
+            };
+            var line = '';
+            if (item.digests.length) {
+                var sha256 = item.digests[0].split(':')[1];
+                line = 'SHA-256 ' + sha256.slice(0, 16) + '…' + sha256.slice(-8) + ' ';
+            } else if (item.state === 'Downloading') {
+                line = 'Hashing as it streams · ' + megabytes(item.hashed) + ' ';
+            }
+            line += badges[item.verification] || '';
+            if (item.verification !== 'verified' && item.state !== 'Cancelled') {
+                line += ' <input id="checksum-' + item.id + '" placeholder="Paste a checksum to verify"'
+                      + ' style="width: 320px; background: rgba(255,255,255,0.05); color: white;'
+                      + ' border: 1px solid rgba(255,255,255,0.2); border-radius: 6px; padding: 4px;">'
+                      + button('checksum', 'Verify', item.id);
+            }
+            return '<p style="font-family: monospace; opacity: 0.85;">' + line + '</p>';
+        }
+        function render(items) {
+            // Re-rendering would wipe a checksum being typed
+            if (document.activeElement && document.activeElement.tagName === 'INPUT') return;
+            if (!items.length) {
+                list.innerHTML = '<p style="opacity: 0.6;">No downloads yet.</p>';
+                return;
+            }
+            list.innerHTML = items.map(function (item) {
+                var percent = item.total > 0 ? Math.min(100, 100 * item.received / item.total) : 0;
+                var detail = megabytes(item.received) + (item.total > 0 ? ' of ' + megabytes(item.total) : '');
+                if (item.state === 'Downloading') {
+                    detail += ' · ' + megabytes(item.rate) + '/s over ' + item.connections
+                            + (item.connections === 1 ? ' connection' : ' connections');
+                } else if (item.state === 'Completed' && item.rate > 0) {
+                    detail += ' · averaged ' + megabytes(item.rate) + '/s';
+                }
+                if (item.error) detail += ' · ' + escapeText(item.error);
+                
+                var buttons = '';
+                if (item.state === 'Downloading') buttons += button('pause', 'Pause', item.id);
+                if (item.state === 'Paused' || item.state === 'Failed') buttons += button('resume', 'Resume', item.id);
+                if (item.state !== 'Completed' && item.state !== 'Cancelled') buttons += button('cancel', 'Cancel', item.id);
+                
+                return '<div class="download-item"><h3>' + escapeText(item.name) + '</h3>'
+                     + '<div class="progress-bar"><div class="progress-fill" style="width: ' + percent + '%;"></div></div>'
+                     + '<p>' + item.state + ' · ' + detail + '</p>' + integrity(item) + buttons + '</div>';
+            }).join('');
+        }
+    </script>
+</body>
+</html>
+)";
+
+static const char vaultPageHtml[] = R"(
+<html>
+<head>
+    <style>
+        body {
+            background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
+            color: white;
+            font-family: 'Segoe UI', sans-serif;
+            padding: 40px;
+            text-align: center;
+        }
+        h1 { color: #00d4ff; font-size: 48px; }
+        .vault-icon { font-size: 100px; margin: 30px 0; }
+        .info-box {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 16px;
+            padding: 30px;
+            max-width: 600px;
+            margin: 30px auto;
+            text-align: left;
+        }
+    </style>
+</head>
+<body>
+    <div class="vault-icon">🔒</div>
+    <h1>Secure Vault</h1>
+    <p style="font-size: 18px;">Your encrypted password manager</p>
+    
+    <div class="info-box">
+        <h3 style="color: #00d4ff;">🛡️ Features:</h3>
+        <ul>
+            <li>AES-256 encryption</li>
+            <li>k-Anonymity breach detection</li>
+            <li>Zero-knowledge architecture</li>
+            <li>Biometric unlock (Coming soon)</li>
+        </ul>
+        
+        <p style="margin-top: 30px; opacity: 0.7;">
+            💡 The Vault feature will be available in Phase 2 of development.<br>
+            Your passwords will never leave your device.
+        </p>
+    </div>
+</body>
+</html>
+)";
+
+static const char pagesPageHtml[] = R"(
+<html>
+<head>
+    <style>
+        body {
+            background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
+            color: white;
+            font-family: 'Segoe UI', sans-serif;
+            padding: 40px;
+        }
+        h1 { color: #00d4ff; }
+        input {
+            width: 100%;
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 12px;
+            color: white;
+            padding: 12px 20px;
+            font-size: 16px;
+        }
+        input:focus { border-color: #00d4ff; outline: none; }
+        .result {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 12px;
+            padding: 16px 20px;
+            margin: 12px 0;
+        }
+        .result a { color: #00d4ff; font-size: 17px; text-decoration: none; }
+        .result .url { opacity: 0.5; font-size: 12px; margin: 4px 0; }
+        mark { background: rgba(0, 212, 255, 0.3); color: white; }
+    </style>
+</head>
+<body>
+    <h1>🔎 Page Search</h1>
+    <p>Search the text of pages you have visited. Nothing leaves this device.</p>
+    <input id="query" placeholder="What was that page about?" autofocus>
+    <p id="status" style="opacity: 0.6;"></p>
+    <div id="results"></div>
+    
+    <script>
+        var pendingQuery = null;
+        document.getElementById('query').oninput = function (event) {
+            pendingQuery = event.target.value;
+        };
+        function takeQuery() {
+            var taken = pendingQuery;
+            pendingQuery = null;
+            return taken;
+        }
+        function escapeText(text) {
+            var node = document.createElement('div');
+            node.textContent = text;
+            return node.innerHTML;
+        }
+        function render(query, items, elapsedMs) {
+            if (query !== document.getElementById('query').value) return;
+            document.getElementById('status').textContent = query
+                ? items.length + (items.length === 1 ? ' page' : ' pages') + ' in ' + elapsedMs + ' ms' : '';
+            document.getElementById('results').innerHTML = items.map(function (item) {
+                var snippet = escapeText(item.snippet).replace(/\x02/g, '<mark>').replace(/\x03/g, '</mark>');
+                return '<div class="result"><a href="' + escapeText(item.url).replace(/"/g, '&quot;') + '">'
+                     + escapeText(item.title || item.url) + '</a>'
+                     + '<div class="url">' + escapeText(item.url) + ' · ' + item.when + '</div>'
+                     + '<div>' + snippet + '</div></div>';
+            }).join('');
+        }
+    </script>
+</body>
+</html>
+)";
+
+static const char settingsPageHtml[] = R"(
+<html>
+<head>
+    <style>
+        body {
+            background: linear-gradient(135deg, #0a0a1f 0%, #1a0a2e 100%);
+            color: white;
+            font-family: 'Segoe UI', sans-serif;
+            padding: 40px;
+        }
+        h1 { color: #00d4ff; border-bottom: 2px solid #00d4ff; padding-bottom: 15px; }
+        h2 { color: #00d4ff; margin-top: 40px; }
+        .setting-item {
+            background: rgba(255, 255, 255, 0.05);
+            border: 1px solid rgba(255, 255, 255, 0.1);
+            border-radius: 12px;
+            padding: 20px;
+            margin: 15px 0;
+        }
+        button {
+            background: linear-gradient(135deg, #00d4ff, #ff00ff);
+            border: none;
+            color: white;
+            padding: 12px 24px;
+            border-radius: 8px;
+            font-weight: 600;
+            cursor: pointer;
+            margin: 5px;
+        }
+        button:hover {
+            transform: translateY(-2px);
+            box-shadow: 0 8px 20px rgba(0, 212, 255, 0.4);
+        }
+        .shortcut-list {
+            background: rgba(255, 255, 255, 0.05);
+            padding: 20px;
+            border-radius: 12px;
+            margin-top: 20px;
+        }
+        code {
+            background: rgba(0, 212, 255, 0.2);
+            padding: 4px 8px;
+            border-radius: 4px;
+            font-family: 'Courier New', monospace;
+        }
+    </style>
+</head>
+<body>
+    <h1>⚙️ ASK Browser Settings</h1>
+    
+    <div class="setting-item">
+        <h3>📊 Browser Information</h3>
+        <p><b>Version:</b> 8.0 (Liquid Glass Edition)</p>
+        <p><b>Engine:</b> Chromium (Qt WebEngine)</p>
+        <p><b>Build:</b> Production-Ready</p>
+    </div>
+    
+    <h2>🧹 Privacy & Data</h2>
+    <div class="setting-item">
+        <button onclick="alert('History cleared!') ">Clear History</button>
+        <button onclick="alert('Cache cleared!') ">Clear Cache</button>
+        <button onclick="alert('Cookies cleared!') ">Clear Cookies</button>
+    </div>
+    
+    <h2>⌨️ Keyboard Shortcuts</h2>
+    <div class="shortcut-list">
+        <p><code>Ctrl + T</code> - New Tab</p>
+        <p><code>Ctrl + W</code> - Close Tab</p>
+        <p><code>Ctrl + Shift + T</code> - Reopen Closed Tab</p>
+        <p><code>Ctrl + R</code> / <code>F5</code> - Reload</p>
+        <p><code>Ctrl + L</code> - Focus Address Bar</p>
+        <p><code>Ctrl + Tab</code> - Next Tab</p>
+        <p><code>Ctrl + Shift + Tab</code> - Previous Tab</p>
+        <p><code>F11</code> - Fullscreen</p>
+        <p><code>Shift + Esc</code> - Task Manager</p>
+        <p><code>Ctrl + Shift + D</code> - Next Theme</p>
+    </div>
+    
+    <h2>🎨 Appearance</h2>
+    <div class="setting-item">
+        <p><b>Themes:</b> Liquid Glass (Default), Frost</p>
+        <p><b>Font:</b> Oxanium</p>
+        <p>💡 <code>Ctrl + Shift + D</code> switches theme; the choice is remembered</p>
+    </div>
+    
+    <h2>🔒 Security</h2>
+    <div class="setting-item">
+        <p>✅ Tracking Protection: <b>Enabled</b></p>
+        <p>✅ HTTPS-Only Mode: <b>Enabled</b></p>
+        <p>✅ Cookie Blocking: <b>Third-party blocked</b></p>
+    </div>
+</body>
+</html>
+)";
+
+/**
+ * Serves ask:// pages from the HTML compiled in above. Each body is
+ * encoded once on first use and shared by every request after that, so a
+ * reply is a QBuffer over bytes already in memory.
+ */
+class InternalPageHandler : public QWebEngineUrlSchemeHandler {
+public:
+    struct Page {
+        const char *host;
+        const char *title;
+        const char *html;
+    };
+    
+    using QWebEngineUrlSchemeHandler::QWebEngineUrlSchemeHandler;
+    
+    static const QVector<Page> &pages() {
+        static const QVector<Page> table = {
+            {"ai", "✨ AI Assistant", aiPageHtml},
+            {"downloads", "📥 Downloads", downloadsPageHtml},
+            {"vault", "🔒 Vault", vaultPageHtml},
+            {"pages", "🔎 Page Search", pagesPageHtml},
+            {"settings", "⚙️ Settings", settingsPageHtml}
+        };
+        return table;
+    }
+    
+    static const Page *find(const QString &host) {
+        for (const Page &page : pages()) {
+            if (host == QLatin1String(page.host)) return &page;
+        }
+        return nullptr;
+    }
+    
+    void requestStarted(QWebEngineUrlRequestJob *job) override {
+        const Page *page = find(job->requestUrl().host());
+        if (!page || job->requestMethod() != "GET") {
+            job->fail(QWebEngineUrlRequestJob::UrlNotFound);
+            return;
+        }
+        
+        auto body = bodies.find(page->host);
+        if (body == bodies.end()) {
+            body = bodies.insert(page->host, QByteArray(page->html));
+        }
+        QBuffer *buffer = new QBuffer(job);
+        buffer->setData(body.value());
+        buffer->open(QIODevice::ReadOnly);
+        job->reply("text/html;charset=utf-8", buffer);
+    }
+
+private:
+    QHash<QString, QByteArray> bodies;
+};
+
+// ============================================================================
+// INPUT CLASSIFICATION
+// ============================================================================
+
+/**
+ * Public-suffix lookups against the trie compiled into ask_public_suffix.h.
+ * Labels are matched right to left with a binary search among each node's
+ * children; ASCII hosts are compared in place without allocating.
+ */
+class PublicSuffix {
+public:
+    // Labels in the host's public suffix ("a.b.co.uk" -> 2), or 0 when no
+    // ICANN rule matches, i.e. the TLD does not exist
+    static int suffixLabels(QStringView host) {
+        if (host.endsWith(QLatin1Char('.'))) host.chop(1);
+        
+        int node = 0;
+        int depth = 0;
+        int matched = 0;
+        qsizetype end = host.size();
+        while (end > 0) {
+            qsizetype dot = host.lastIndexOf(QLatin1Char('.'), end - 1);
+            const PublicSuffixNode &parent = publicSuffixNodes[node];
+            int child = findChild(parent, host.mid(dot + 1, end - dot - 1));
+            if (child < 0) {
+                // "*.ck" covers any label under ck
+                if (parent.flags & PublicSuffixNode::Wildcard) matched = depth + 1;
+                break;
+            }
+            ++depth;
+            const PublicSuffixNode &current = publicSuffixNodes[child];
+            if (current.flags & PublicSuffixNode::Exception) {
+                // "!www.ck": the suffix stops at the parent
+                matched = depth - 1;
+                break;
+            }
+            if ((current.flags & PublicSuffixNode::Rule) || (parent.flags & PublicSuffixNode::Wildcard)) {
+                matched = depth;
+            }
+            node = child;
+            if (dot < 0) break;
+            end = dot;
+        }
+        return matched;
+    }
+    
+private:
+    static int findChild(const PublicSuffixNode &parent, QStringView label) {
+        // Lowercase ASCII into a stack buffer; IDN labels go through punycode
+        char buffer[64];
+        int length = 0;
+        bool ascii = true;
+        for (QChar c : label) {
+            if (c.unicode() >= 0x80) {
+                ascii = false;
+                break;
+            }
+            if (length == 63) return -1;
+            char ch = char(c.unicode());
+            buffer[length++] = (ch >= 'A' && ch <= 'Z') ? char(ch + 32) : ch;
+        }
+        if (!ascii) {
+            QByteArray ace = QUrl::toAce(label.toString());
+            if (ace.isEmpty() || ace.size() > 63) return -1;
+            length = ace.size();
+            memcpy(buffer, ace.constData(), length);
+        }
+        if (length == 0) return -1;
+        
+        int low = parent.firstChild;
+        int high = parent.firstChild + parent.childCount - 1;
+        while (low <= high) {
+            int mid = (low + high) / 2;
+            const PublicSuffixNode &candidate = publicSuffixNodes[mid];
+            int common = qMin<int>(length, candidate.labelLength);
+            int order = memcmp(buffer, publicSuffixLabels + candidate.labelOffset, common);
+            if (order == 0) order = length - candidate.labelLength;
+            if (order == 0) return mid;
+            if (order < 0) high = mid - 1;
+            else low = mid + 1;
+        }
+        return -1;
+    }
+};
+
+/**
+ * What the omnibox should do with typed text: open an ask:// page, navigate to
+ * a URL, or hand the text to the selected search engine.
+ */
+struct InputClassification {
+    enum Kind { InternalPage, Url, Search };
+    Kind kind = Search;
+    QUrl url;   // Set for InternalPage and Url
+};
+
+namespace InputClassifier {
+
+inline bool isDigits(QStringView text) {
+    if (text.isEmpty()) return false;
+    for (QChar c : text) {
+        if (c < QLatin1Char('0') || c > QLatin1Char('9')) return false;
+    }
+    return true;
+}
+
+inline bool isPort(QStringView text) {
+    if (!isDigits(text) || text.size() > 5) return false;
+    int port = 0;
+    for (QChar c : text) port = port * 10 + (c.unicode() - '0');
+    return port > 0 && port <= 65535;
+}
+
+inline bool isScheme(QStringView text) {
+    if (text.isEmpty() || !text.front().isLetter() || text.front().unicode() >= 0x80) return false;
+    for (QChar c : text) {
+        ushort u = c.unicode();
+        bool ok = (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9')
+                  || u == '+' || u == '-' || u == '.';
+        if (!ok) return false;
+    }
+    return true;
+}
+
+// Dotted quad with every part 0-255; "3.14" and "1.2.3" are not addresses
+inline bool isIPv4(QStringView host) {
+    int parts = 0;
+    qsizetype start = 0;
+    while (start <= host.size()) {
+        qsizetype dot = host.indexOf(QLatin1Char('.'), start);
+        if (dot < 0) dot = host.size();
+        QStringView part = host.mid(start, dot - start);
+        if (!isDigits(part) || part.size() > 3) return false;
+        int value = 0;
+        for (QChar c : part) value = value * 10 + (c.unicode() - '0');
+        if (value > 255) return false;
+        ++parts;
+        start = dot + 1;
+    }
+    return parts == 4;
+}
+
+// LDH labels (plus '_' for intranet names and non-ASCII for IDN), 1-63 each
+inline bool isHostname(QStringView host, int *labels) {
+    if (host.isEmpty() || host.size() > 253) return false;
+    *labels = 0;
+    qsizetype start = 0;
+    while (start <= host.size()) {
+        qsizetype dot = host.indexOf(QLatin1Char('.'), start);
+        if (dot < 0) dot = host.size();
+        QStringView label = host.mid(start, dot - start);
+        if (label.isEmpty() || label.size() > 63) return false;
+        if (label.front() == QLatin1Char('-') || label.back() == QLatin1Char('-')) return false;
+        for (QChar c : label) {
+            ushort u = c.unicode();
+            bool ok = (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9')
+                      || u == '-' || u == '_' || (u >= 0x80 && c.isLetterOrNumber());
+            if (!ok) return false;
+        }
+        ++*labels;
+        start = dot + 1;
+    }
+    return true;
+}
+
+// Reserved or conventional names that never resolve publicly
+inline bool isIntranetTld(QStringView tld) {
+    static const char *const names[] = {
+        "corp", "home", "internal", "intranet", "lan", "local", "localdomain", "localhost", "test",
+    };
+    for (const char *name : names) {
+        if (tld.compare(QLatin1String(name), Qt::CaseInsensitive) == 0) return true;
+    }
+    return false;
+}
+
+inline InputClassification navigate(const QString &url) {
+    InputClassification result;
+    result.kind = InputClassification::Url;
+    result.url = QUrl(url);
+    return result;
+}
+
+} // namespace InputClassifier
+
+/**
+ * Decides without touching the network, in well under a microsecond for
+ * typical input, so it can run on every keystroke:
+ * - ask:// opens an internal page
+ * - an explicit web scheme, about:, data: and friends navigate as typed
+ * - IPv4/IPv6 literals, localhost and intranet names navigate over http
+ * - dotted hosts navigate over https when their TLD is on the public suffix
+ *   list and they are more than a bare suffix ("node.js", "co.uk" search)
+ * - a single word navigates only with a port or trailing path ("wiki/")
+ * Everything else, including anything with spaces, is a search.
+ */
+inline InputClassification classifyInput(const QString &text) {
+    using namespace InputClassifier;
+    InputClassification result;
+    QStringView input = QStringView(text).trimmed();
+    if (input.isEmpty()) return result;
+    
+    if (input.startsWith(QLatin1String("ask://"), Qt::CaseInsensitive)) {
+        result.kind = InputClassification::InternalPage;
+        result.url = QUrl(input.toString());
+        return result;
+    }
+    for (QChar c : input) {
+        if (c.isSpace()) return result;
+    }
+    
+    // Explicit scheme; "localhost:8080" falls through since its "scheme" is followed by a port
+    qsizetype colon = input.indexOf(QLatin1Char(':'));
+    if (colon > 0 && isScheme(input.left(colon))) {
+        QStringView scheme = input.left(colon);
+        QStringView rest = input.mid(colon + 1);
+        static const char *const hierarchical[] = {"http", "https", "ftp", "ws", "wss", "file"};
+        static const char *const opaque[] = {"about", "data", "mailto", "view-source", "blob"};
+        for (const char *known : hierarchical) {
+            if (scheme.compare(QLatin1String(known), Qt::CaseInsensitive) == 0
+                && rest.startsWith(QLatin1String("//"))) {
+                return navigate(input.toString());
+            }
+        }
+        for (const char *known : opaque) {
+            if (scheme.compare(QLatin1String(known), Qt::CaseInsensitive) == 0 && !rest.isEmpty()) {
+                return navigate(input.toString());
+            }
+        }
+    }
+    
+    // Split authority from path/query/fragment
+    qsizetype authorityEnd = input.size();
+    for (QChar stop : {QLatin1Char('/'), QLatin1Char('?'), QLatin1Char('#')}) {
+        qsizetype at = input.indexOf(stop);
+        if (at >= 0 && at < authorityEnd) authorityEnd = at;
+    }
+    QStringView authority = input.left(authorityEnd);
+    bool hasPath = authorityEnd < input.size();
+    if (authority.isEmpty() || authority.contains(QLatin1Char('@'))) return result;  // Email-like
+    
+    // [v6] or [v6]:port
+    if (authority.front() == QLatin1Char('[')) {
+        qsizetype close = authority.indexOf(QLatin1Char(']'));
+        if (close < 0) return result;
+        QStringView after = authority.mid(close + 1);
+        if (!after.isEmpty() && !(after.front() == QLatin1Char(':') && isPort(after.mid(1)))) return result;
+        QHostAddress address;
+        if (!address.setAddress(authority.mid(1, close - 1).toString())
+            || address.protocol() != QAbstractSocket::IPv6Protocol) {
+            return result;
+        }
+        return navigate("http://" + input.toString());
+    }
+    
+    // A bare v6 literal has several colons
+    if (authority.indexOf(QLatin1Char(':')) != authority.lastIndexOf(QLatin1Char(':'))) {
+        QHostAddress address;
+        if (address.setAddress(authority.toString()) && address.protocol() == QAbstractSocket::IPv6Protocol) {
+            return navigate("http://[" + authority.toString() + "]" + input.mid(authorityEnd).toString());
+        }
+        return result;
+    }
+    
+    QStringView host = authority;
+    bool hasPort = false;
+    colon = authority.indexOf(QLatin1Char(':'));
+    if (colon >= 0) {
+        if (!isPort(authority.mid(colon + 1))) return result;
+        host = authority.left(colon);
+        hasPort = true;
+    }
+    if (host.endsWith(QLatin1Char('.'))) host.chop(1);
+    
+    int labels = 0;
+    if (isIPv4(host)) return navigate("http://" + input.toString());
+    if (!isHostname(host, &labels)) return result;
+    
+    qsizetype lastDot = host.lastIndexOf(QLatin1Char('.'));
+    QStringView tld = host.mid(lastDot + 1);
+    if (isIntranetTld(tld)) return navigate("http://" + input.toString());
+    
+    if (labels == 1) {
+        return (hasPort || hasPath) ? navigate("http://" + input.toString()) : result;
+    }
+    
+    int suffix = PublicSuffix::suffixLabels(host);
+    if (suffix == 0 || suffix >= labels) {
+        // Unknown TLD or a bare suffix: a search, unless a port says it is a server
+        return hasPort ? navigate("http://" + input.toString()) : result;
+    }
+    return navigate("https://" + input.toString());
+}
+
+// ============================================================================
+// SPECULATION
+// ============================================================================
+
+/**
+ * Starts the network work for what the omnibox will probably load before
+ * Enter is pressed. Typing is debounced; a likely origin gets a DNS prefetch
+ * and preconnect from a hidden page in the current profile (so the sockets
+ * land in the pool the tab will use), and a near-certain history match is
+ * prerendered in a hidden view the browser adopts as the tab on a hit.
+ *
+ * Time saved is the prerender's head start for prerender hits; for
+ * preconnect hits it is the handshake (DNS through connectEnd) the origin
+ * usually costs on a cold load minus what the warm load paid, capped by
+ * how early the preconnect went out.
+ */
+class SpeculativeLoader : public QObject {
+public:
+    struct Prediction {
+        QUrl url;
+        double confidence = 0;       // 0..1
+        bool prerenderable = false;  // Only history matches are stable enough
+    };
+    
+    struct Stats {
+        int navigations = 0;      // Omnibox navigations seen
+        int preconnects = 0;
+        int preconnectHits = 0;
+        int prerenders = 0;
+        int prerenderHits = 0;
+        qint64 savedMs = 0;
+    };
+    
+    static constexpr double PreconnectConfidence = 0.3;
+    static constexpr double PrerenderConfidence = 0.8;
+    static constexpr int PreconnectWindowMs = 10000;   // Roughly how long Chromium keeps an idle socket
+    static constexpr int PrerenderLifetimeMs = 30000;
+    
+    // Hands out a hidden view in the current profile, set up like a tab's
+    std::function<QWebEngineView*()> createView;
+    
+    SpeculativeLoader(int debounceMs, bool prerenderEnabled, QObject *parent = nullptr)
+        : QObject(parent), prerenderEnabled(prerenderEnabled) {
+        clock.start();
+        debounce = new QTimer(this);
+        debounce->setSingleShot(true);
+        debounce->setInterval(debounceMs);
+        connect(debounce, &QTimer::timeout, this, [this]() { speculate(); });
+        
+        expiry = new QTimer(this);
+        expiry->setSingleShot(true);
+        expiry->setInterval(PrerenderLifetimeMs);
+        connect(expiry, &QTimer::timeout, this, [this]() { discardPrerender(); });
+    }
+    
+    ~SpeculativeLoader() override {
+        discardPrerender();
+        delete connector;
+    }
+    
+    // Speculation follows the visible workspace
+    void setProfile(QWebEngineProfile *newProfile) {
+        if (newProfile == profile) return;
+        cancel();
+        delete connector;
+        connector = nullptr;
+        profile = newProfile;
+        preconnected.clear();
+    }
+    
+    // History wins when its top match completes what was typed, weighted by
+    // how far it outranks the runner-up and how much has been typed
+    static Prediction predict(const QString &text, const InputClassification &input,
+                              const QVector<OmniboxIndex::Match> &matches, const QString &searchUrl) {
+        Prediction prediction;
+        const QString typed = stripped(text.trimmed().toLower());
+        if (typed.size() < 2) return prediction;
+        
+        if (!matches.isEmpty() && matches.first().score > 0
+            && stripped(matches.first().url.toLower()).startsWith(typed)) {
+            double runnerUp = matches.size() > 1 ? matches[1].score : 0;
+            prediction.url = QUrl(matches.first().url);
+            prediction.confidence = matches.first().score / (matches.first().score + runnerUp)
+                                    * qMin(1.0, 0.5 + typed.size() / 8.0);
+            prediction.prerenderable = true;
+        } else if (input.kind == InputClassification::Url) {
+            // The host may still be half typed; warming it costs one socket
+            prediction.url = input.url;
+            prediction.confidence = 0.5;
+        } else if (input.kind == InputClassification::Search && !searchUrl.isEmpty()) {
+            // The query keeps changing, the engine's host does not
+            prediction.url = QUrl(searchUrl);
+            prediction.confidence = 0.5;
+        }
+        return prediction;
+    }
+    
+    void typed(const Prediction &prediction) {
+        pending = prediction;
+        debounce->start();
+    }
+    
+    void cancel() {
+        debounce->stop();
+        pending = Prediction();
+        discardPrerender();
+    }
+    
+    // Enter was pressed for url. Returns the prerendered view if it matches
+    // and canAdopt; the caller owns it from then on.
+    QWebEngineView *navigated(const QUrl &url, bool canAdopt) {
+        debounce->stop();
+        pending = Prediction();
+        ++counters.navigations;
+        const qint64 now = clock.elapsed();
+        
+        if (canAdopt && prerenderView && sameDocument(prerenderUrl, url)) {
+            QWebEngineView *view = prerenderView;
+            disconnect(prerenderLoaded);
+            expiry->stop();
+            prerenderView = nullptr;
+            ++counters.prerenderHits;
+            counters.savedMs += prerenderLoadMs >= 0 ? prerenderLoadMs : now - prerenderStarted;
+            return view;
+        }
+        discardPrerender();
+        
+        const QString key = origin(url);
+        auto it = preconnected.constFind(key);
+        if (it != preconnected.constEnd() && now - it.value() < PreconnectWindowMs) {
+            ++counters.preconnectHits;
+            preconnectLead.insert(key, now - it.value());
+        }
+        return nullptr;
+    }
+    
+    // Navigation timing of a finished tab load, from NavigationTracer
+    void pageTiming(const QUrl &url, const QVariantMap &timing) {
+        double start = timing.value("domainLookupStart").toDouble();
+        double end = timing.value("connectEnd").toDouble();
+        if (start <= 0 || end < start) return;
+        double handshake = end - start;
+        const QString key = origin(url);
+        
+        auto lead = preconnectLead.find(key);
+        if (lead != preconnectLead.end()) {
+            double usual = handshakeMs.value(key, -1);
+            if (usual > handshake) counters.savedMs += qMin(qint64(usual - handshake), lead.value());
+            preconnectLead.erase(lead);
+            return;   // A warm load says nothing about the cold cost
+        }
+        
+        if (handshakeMs.size() >= 512 && !handshakeMs.contains(key)) handshakeMs.clear();
+        auto usual = handshakeMs.find(key);
+        if (usual == handshakeMs.end()) handshakeMs.insert(key, handshake);
+        else *usual = 0.7 * *usual + 0.3 * handshake;
+    }
+    
+    const Stats &stats() const { return counters; }
+    
+private:
+    static QString stripped(QString url) {
+        for (const char *prefix : {"https://", "http://", "www."}) {
+            if (url.startsWith(QLatin1String(prefix))) url.remove(0, int(strlen(prefix)));
+        }
+        return url;
+    }
+    
+    static QString origin(const QUrl &url) {
+        return url.adjusted(QUrl::RemoveUserInfo | QUrl::RemovePath | QUrl::RemoveQuery
+                            | QUrl::RemoveFragment).toString();
+    }
+    
+    static bool sameDocument(const QUrl &a, const QUrl &b) {
+        const auto options = QUrl::StripTrailingSlash | QUrl::RemoveFragment;
+        return a.adjusted(options) == b.adjusted(options);
+    }
+    
+    void speculate() {
+        const Prediction prediction = pending;
+        pending = Prediction();
+        if (!profile || !prediction.url.isValid() || prediction.confidence < PreconnectConfidence) return;
+        const QString scheme = prediction.url.scheme();
+        if (scheme != "http" && scheme != "https") return;
+        
+        preconnect(prediction.url);
+        if (prerenderEnabled && prediction.prerenderable && prediction.confidence >= PrerenderConfidence) {
+            prerender(prediction.url);
+        }
+    }
+    
+    void preconnect(const QUrl &url) {
+        const QString key = origin(url);
+        const qint64 now = clock.elapsed();
+        auto it = preconnected.constFind(key);
+        if (it != preconnected.constEnd() && now - it.value() < PreconnectWindowMs) return;
+        preconnected.insert(key, now);
+        ++counters.preconnects;
+        
+        // Resource hints in a page of the tab's profile warm the same socket pool
+        if (!connector) connector = new QWebEnginePage(profile);
+        const QString href = key.toHtmlEscaped();
+        connector->setHtml(QString("<link rel=\"dns-prefetch\" href=\"%1\"><link rel=\"preconnect\" href=\"%1\">")
+                               .arg(href));
+    }
+    
+    void prerender(const QUrl &url) {
+        if (prerenderView && sameDocument(prerenderUrl, url)) return;
+        discardPrerender();
+        if (!createView) return;
+        
+        prerenderView = createView();
+        prerenderUrl = url;
+        prerenderStarted = clock.elapsed();
+        prerenderLoadMs = -1;
+        prerenderLoaded = connect(prerenderView, &QWebEngineView::loadFinished, this, [this]() {
+            if (prerenderLoadMs < 0) prerenderLoadMs = clock.elapsed() - prerenderStarted;
+        });
+        prerenderView->setUrl(url);
+        expiry->start();
+        ++counters.prerenders;
+    }
+    
+    void discardPrerender() {
+        expiry->stop();
+        if (!prerenderView) return;
+        disconnect(prerenderLoaded);
+        prerenderView->deleteLater();
+        prerenderView = nullptr;
+    }
+    
+    bool prerenderEnabled;
+    QWebEngineProfile *profile = nullptr;
+    QWebEnginePage *connector = nullptr;
+    QTimer *debounce = nullptr;
+    QTimer *expiry = nullptr;
+    QElapsedTimer clock;
+    Prediction pending;
+    
+    QHash<QString, qint64> preconnected;    // Origin -> when it was preconnected
+    QHash<QString, qint64> preconnectLead;  // Origin -> head start of a hit awaiting its timing
+    QHash<QString, double> handshakeMs;     // Origin -> smoothed cold handshake cost
+    
+    QWebEngineView *prerenderView = nullptr;
+    QUrl prerenderUrl;
+    qint64 prerenderStarted = 0;
+    qint64 prerenderLoadMs = -1;
+    QMetaObject::Connection prerenderLoaded;
+    
+    Stats counters;
+};
+
+// ============================================================================
+// SINGLE INSTANCE
+// ============================================================================
+
+/**
+ * Hands a launch over to the browser already running on the same data
+ * directory. The first instance listens on a local socket named after the
+ * directory; a later launch connects, writes its URLs as one JSON line and
+ * waits for the "ok" that says they were taken, then exits without ever
+ * starting Chromium or opening the databases. The socket is only usable
+ * by the same user.
+ */
+class InstanceChannel : public QObject {
+public:
+    explicit InstanceChannel(QObject *parent = nullptr) : QObject(parent) {
+        server = new QLocalServer(this);
+        server->setSocketOptions(QLocalServer::UserAccessOption);
+        connect(server, &QLocalServer::newConnection, this, [this]() {
+            while (QLocalSocket *socket = server->nextPendingConnection()) {
+                accept(socket);
+            }
+        });
+    }
+    
+    // Called with the URLs of every forwarded launch, possibly none
+    std::function<void(const QStringList &urls)> onOpen;
+    
+    // Everything relative in ASK's storage hangs off the working directory
+    static QString serverName() {
+        const QByteArray key = QDir::currentPath().toUtf8();
+        return QString("ask-browser-%1-%2")
+            .arg(qEnvironmentVariable("USER", "user"),
+                 QString::fromLatin1(QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex().left(12)));
+    }
+    
+    // True once a running instance has accepted the URLs
+    static bool forward(const QStringList &urls, int timeoutMs = 1000) {
+        QLocalSocket socket;
+        socket.connectToServer(serverName());
+        if (!socket.waitForConnected(timeoutMs)) return false;
+        
+        socket.write(QJsonDocument(QJsonObject{{"urls", QJsonArray::fromStringList(urls)}})
+                         .toJson(QJsonDocument::Compact) + '\n');
+        if (!socket.waitForBytesWritten(timeoutMs)) return false;
+        while (!socket.canReadLine()) {
+            if (!socket.waitForReadyRead(timeoutMs)) return false;
+        }
+        return socket.readLine().trimmed() == "ok";
+    }
+    
+    enum ListenResult { Listening, AlreadyRunning, Unavailable };
+    
+    // A socket file left by a crashed instance accepts no connections; it is
+    // only removed then, so an owner that just started is never evicted.
+    // AlreadyRunning means another launch won the race and should get the URLs.
+    ListenResult listen() {
+        if (server->listen(serverName())) return Listening;
+        if (server->serverError() == QAbstractSocket::AddressInUseError) {
+            QLocalSocket probe;
+            probe.connectToServer(serverName());
+            if (probe.waitForConnected(200)) return AlreadyRunning;
+            QLocalServer::removeServer(serverName());
+            if (server->listen(serverName())) return Listening;
+        }
+        qDebug() << "Single instance channel unavailable:" << server->errorString();
+        return Unavailable;
+    }
+
+private:
+    void accept(QLocalSocket *socket) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+        connect(socket, &QLocalSocket::readyRead, this, [this, socket]() {
+            if (!socket->canReadLine()) {
+                // A launch never sends more than a few URLs
+                if (socket->bytesAvailable() > 1024 * 1024) socket->abort();
+                return;
+            }
+            const QJsonObject request = QJsonDocument::fromJson(socket->readLine()).object();
+            QStringList urls;
+            for (const QJsonValue &url : request.value("urls").toArray()) {
+                if (!url.toString().isEmpty()) urls.append(url.toString());
+            }
+            socket->write("ok\n");
+            socket->flush();
+            socket->disconnectFromServer();
+            if (onOpen) onOpen(urls);
+        });
+        QTimer::singleShot(5000, socket, [socket]() { socket->abort(); });
+    }
+    
+    QLocalServer *server;
+};
+
+// ============================================================================
+// STARTUP TRACE
+// ============================================================================
+
+/**
+ * Where start-up time goes. The clock starts at the first call to
+ * instance(), at the top of main. Phases are timed on whichever thread
+ * runs them and marks are single moments such as first paint, so a new
+ * feature that lands on the critical path shows up as another bar before
+ * "first paint" in the --startup-trace timeline.
+ */
+class StartupTrace {
+public:
+    struct Span {
+        QString name;
+        qint64 beginUs = 0;
+        qint64 endUs = 0;   // Same as beginUs for a mark
+        bool gui = true;
+    };
+    
+    static StartupTrace &instance() {
+        static StartupTrace trace;
+        return trace;
+    }
+    
+    qint64 elapsedUs() const { return clock.nsecsElapsed() / 1000; }
+    
+    template <typename Work>
+    void run(const QString &name, Work &&work) {
+        const qint64 begin = elapsedUs();
+        work();
+        record(name, begin, elapsedUs());
+    }
+    
+    // Callable from any thread
+    void record(const QString &name, qint64 beginUs, qint64 endUs) {
+        QCoreApplication *app = QCoreApplication::instance();
+        const bool gui = !app || QThread::currentThread() == app->thread();
+        QMutexLocker locker(&mutex);
+        spans.append({name, beginUs, endUs, gui});
+    }
+    
+    void mark(const QString &name) {
+        const qint64 now = elapsedUs();
+        record(name, now, now);
+    }
+    
+    QString timeline() const {
+        QVector<Span> sorted;
+        {
+            QMutexLocker locker(&mutex);
+            sorted = spans;
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Span &a, const Span &b) {
+            return a.beginUs < b.beginUs;
+        });
+        
+        auto ms = [](qint64 us) { return QString::number(us / 1000.0, 'f', 1); };
+        QString text = "Startup timeline (ms since main):\n";
+        for (const Span &span : sorted) {
+            const QString thread = span.gui ? "gui" : "worker";
+            if (span.endUs == span.beginUs) {
+                text += QString("  %1   %2  %3  * %4\n")
+                            .arg(ms(span.beginUs), 8).arg(QString(), -8).arg(thread, -6).arg(span.name);
+            } else {
+                text += QString("  %1 - %2  %3  %4 %5 ms\n")
+                            .arg(ms(span.beginUs), 8).arg(ms(span.endUs), -8).arg(thread, -6)
+                            .arg(span.name, -28).arg(ms(span.endUs - span.beginUs), 7);
+            }
+        }
+        return text;
+    }
+
+private:
+    StartupTrace() { clock.start(); }
+    
+    QElapsedTimer clock;
+    mutable QMutex mutex;
+    QVector<Span> spans;
+};
+
+#endif // ASK_CORE_H
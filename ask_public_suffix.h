@@ -0,0 +1,7812 @@
+// Generated by tools/generate_public_suffix.py from the ICANN section of the
+// Public Suffix List (https://publicsuffix.org/list/). Do not edit.
+//
+// The list is subject to the terms of the Mozilla Public License, v. 2.0.
+// If a copy of the MPL was not distributed with this file, you can obtain
+// one at https://mozilla.org/MPL/2.0/.
+
+#ifndef ASK_PUBLIC_SUFFIX_H
+#define ASK_PUBLIC_SUFFIX_H
+
+#include <cstdint>
+
+struct PublicSuffixNode {
+    enum Flag : std::uint8_t { Rule = 1, Wildcard = 2, Exception = 4 };
+    std::uint32_t labelOffset;
+    std::uint8_t labelLength;
+    std::uint8_t flags;
+    std::uint16_t childCount;
+    std::uint16_t firstChild;
+};
+
+static constexpr char publicSuffixLabels[] =
+    "aaaaarpabarthabbabbottabbvieabcableabogadoabudhabiacacademyaccentureaccountantaccountantsacoacto"
+    "radadsadultaeaegaeroaetnaafaflafricaagagakhanagencyaiaigairbusairforceairtelakdnalalfaromeoaliba"
+    "baalipayallfinanzallstateallyalsacealstomamamazonamericanexpressamericanfamilyamexamfamamicaamst"
+    "erdamanalyticsandroidanquananzaoaolapartmentsappappleaqaquarelleararabaramcoarchiarmyarpaartarte"
+    "asasdaasiaassociatesatathletaattorneyauauctionaudiaudibleaudioauspostauthorautoautosaviancaawaws"
+    "axaxaazazurebababybaidubanamexbananarepublicbandbankbarbarcelonabarclaycardbarclaysbarefootbarga"
+    "insbaseballbasketballbauhausbayernbbbbcbbtbbvabcgbcnbdbebeatsbeautybeerbentleyberlinbestbestbuyb"
+    "etbfbgbhbhartibibiblebidbikebingbingobiobizbjblackblackfridayblockbusterblogbloombergbluebmbmsbm"
+    "wbnbnpparibasboboatsboehringerbofabombondboobookbookingboschbostikbostonbotboutiqueboxbrbradesco"
+    "bridgestonebroadwaybrokerbrotherbrusselsbsbtbuildbuildersbusinessbuybuzzbvbwbybzbzhcacabcafecalc"
+    "allcalvinkleincamcameracampcanoncapetowncapitalcapitalonecarcaravancardscarecareercareerscarscas"
+    "acasecashcasinocatcateringcatholiccbacbncbrecbscccdcenterceocerncfcfacfdcgchchanelchannelcharity"
+    "chasechatcheapchintaichristmaschromechurchciciprianicircleciscocitadelciticiticcitycityeatsckclc"
+    "laimscleaningclickcliniccliniqueclothingcloudclubclubmedcmcncocoachcodescoffeecollegecolognecomc"
+    "omcastcommbankcommunitycompanycomparecomputercomseccondosconstructionconsultingcontactcontractor"
+    "scookingcookingchannelcoolcoopcorsicacountrycouponcouponscoursescpacrcreditcreditcardcreditunion"
+    "cricketcrowncrscruisecruisescucuisinellacvcwcxcycymrucyouczdaburdaddancedatadatedatingdatsundayd"
+    "clkddsdedealdealerdealsdegreedeliverydelldeloittedeltademocratdentaldentistdesidesigndevdhldiamo"
+    "ndsdietdigitaldirectdirectorydiscountdiscoverdishdiydjdkdmdnpdodocsdoctordogdomainsdotdownloaddr"
+    "ivedtvdubaidunlopdupontdurbandvagdvrdzeartheatececoedekaedueducationeeegemailemerckenergyenginee"
+    "rengineeringenterprisesepsonequipmenterericssonerniesesqestateetetisalateueurovisioneuseventsexc"
+    "hangeexpertexposedexpressextraspacefagefailfairwindsfaithfamilyfanfansfarmfarmersfashionfastfede"
+    "xfeedbackferrariferrerofifiatfidelityfidofilmfinalfinancefinancialfirefirestonefirmdalefishfishi"
+    "ngfitfitnessfjfkflickrflightsflirfloristflowersflyfmfofoofoodfoodnetworkfootballfordforexforsale"
+    "forumfoundationfoxfrfreefreseniusfrlfrogansfrontdoorfrontierftrfujitsufunfundfurniturefutbolfyig"
+    "agalgallerygallogallupgamegamesgapgardengaygbgbizgdgdngegeagentgentinggeorgegfggggeeghgigiftgift"
+    "sgivesgivingglglassgleglobalglobogmgmailgmbhgmogmxgngodaddygoldgoldpointgolfgoogoodyeargooggoogl"
+    "egopgotgovgpgqgrgraingergraphicsgratisgreengripegrocerygroupgsgtguguardianguccigugeguideguitarsg"
+    "urugwgyhairhamburghangouthaushbohdfchdfcbankhealthhealthcarehelphelsinkiherehermeshgtvhiphophisa"
+    "mitsuhitachihivhkhkthmhnhockeyholdingsholidayhomedepothomegoodshomeshomesensehondahorsehospitalh"
+    "osthostinghothoteleshotelshotmailhousehowhrhsbchthuhugheshyatthyundaiibmicbciceicuidieieeeifmika"
+    "noilimimamatimdbimmoimmobilieninincindustriesinfinitiinfoinginkinstituteinsuranceinsureintintern"
+    "ationalintuitinvestmentsioipirangaiqiririshisismailiististanbulititauitvjaguarjavajcbjejeepjetzt"
+    "jewelryjiojlljmjmpjnjjojobsjoburgjotjoyjpjpmorganjprsjuegosjuniperkaufenkddikekerryhotelskerrylo"
+    "gisticskerrypropertieskfhkgkhkikiakidskimkinderkindlekitchenkiwikmknkoelnkomatsukosherkpkpmgkpnk"
+    "rkrdkredkuokgroupkwkykyotokzlalacaixalamborghinilamerlancasterlancialandlandroverlanxesslasallel"
+    "atlatinolatrobelawlawyerlblcldsleaseleclerclefraklegallegolexuslgbtlilidllifelifeinsurancelifest"
+    "ylelightinglikelillylimitedlimolincolnlindelinklipsylivelivinglkllcllploanloanslockerlocuslollon"
+    "donlottelottolovelpllplfinanciallrlsltltdltdalulundbeckluxeluxurylvlymamacysmadridmaifmaisonmake"
+    "upmanmanagementmangomapmarketmarketingmarketsmarriottmarshallsmaseratimattelmbamcmckinseymdmemed"
+    "mediameetmelbournememememorialmenmenumerckmsdmgmhmiamimicrosoftmilminimintmitmitsubishimkmlmlbml"
+    "smmmmamnmomobimobilemodamoemoimommonashmoneymonstermormonmortgagemoscowmotomotorcyclesmovmoviemp"
+    "mqmrmsmsdmtmtnmtrmumuseummusicmutualmvmwmxmymznanabnagoyanamenaturanavynbancnenecnetnetbanknetfl"
+    "ixnetworkneustarnewnewsnextnextdirectnexusnfnflngngonhkniniconikenikonninjanissannissaynlnonokia"
+    "northwesternmutualnortonnownowruznowtvnpnrnranrwnttnunycnzobiobserverofficeokinawaolayanolayangr"
+    "oupoldnavyolloomomegaoneongoniononlonlineoooopenoracleorangeorgorganicoriginsosakaotsukaottovhpa"
+    "pagepanasonicparisparspartnerspartspartypassagenspaypccwpepetpfpfizerpgphpharmacyphdphilipsphone"
+    "photophotographyphotosphysiopicspictetpicturespidpinpingpinkpioneerpizzapkplplaceplayplaystation"
+    "plumbingpluspmpnpncpohlpokerpolitiepornpostprpramericapraxipressprimeproprodproductionsprofprogr"
+    "essivepromopropertiespropertyprotectionpruprudentialpsptpubpwpwcpyqaqponquebecquestracingradiore"
+    "readrealestaterealtorrealtyrecipesredredstoneredumbrellarehabreisereisenreitreliancerenrentrenta"
+    "lsrepairreportrepublicanrestrestaurantreviewreviewsrexrothrichrichardliricohrilrioriprorocherroc"
+    "ksrodeorogersroomrsrsvprurugbyruhrrunrwrweryukyusasaarlandsafesafetysakurasalesalonsamsclubsamsu"
+    "ngsandviksandvikcoromantsanofisapsarlsassavesaxosbsbisbsscscascbschaefflerschmidtscholarshipssch"
+    "oolschuleschwarzsciencescotsdsesearchseatsecuresecurityseekselectsenerservicessevensewsexsexysfr"
+    "sgshshangrilasharpshawshellshiashikshashoesshopshoppingshoujishowshowtimesisilksinasinglessitesj"
+    "skskiskinskyskypeslslingsmsmartsmilesnsncfsosoccersocialsoftbanksoftwaresohusolarsolutionssongso"
+    "nysoyspaspacesportspotsrsrlssststadastaplesstarstatebankstatefarmstcstcgroupstockholmstoragestor"
+    "estreamstudiostudystylesusuckssuppliessupplysupportsurfsurgerysuzukisvswatchswisssxsysydneysyste"
+    "mssztabtaipeitalktaobaotargettatamotorstatartattootaxtaxitctcitdtdkteamtechtechnologyteltemasekt"
+    "ennistevatftgththdtheatertheatretiaaticketstiendatiffanytipstirestiroltjtjmaxxtjxtktkmaxxtltmtma"
+    "lltntotodaytokyotoolstoptoraytoshibatotaltourstowntoyotatoystrtradetradingtrainingtraveltravelch"
+    "anneltravelerstravelersinsurancetrusttrvtttubetuitunestushutvtvstwtzuaubankubsugukunicomuniversi"
+    "tyunouolupsusuyuzvavacationsvanavanguardvcvevegasventuresverisignversicherungvetvgviviajesvideov"
+    "igvikingvillasvinvipvirginvisavisionvivavivovlaanderenvnvodkavolkswagenvolvovotevotingvotovoyage"
+    "vuvueloswaleswalmartwalterwangwanggouwatchwatchesweatherweatherchannelwebcamweberwebsiteweddingw"
+    "eiboweirwfwhoswhowienwikiwilliamhillwinwindowswinewinnerswmewolterskluwerwoodsideworkworksworldw"
+    "owwswtcwtfxboxxeroxxfinityxihuanxinxn--11b4c3dxn--1ck2e1bxn--1qqw23axn--2scrj9cxn--30rr7yxn--3bs"
+    "t00mxn--3ds443gxn--3e0b707exn--3hcrj9cxn--3pxu8kxn--42c2d9axn--45br5cylxn--45brj9cxn--45q11cxn--"
+    "4dbrk0cexn--4gbrimxn--54b7fta0ccxn--55qw42gxn--55qx5dxn--5su34j936bgsgxn--5tzm5gxn--6frz82gxn--6"
+    "qq986b3xlxn--80adxhksxn--80ao21axn--80aqecdr1axn--80asehdbxn--80aswgxn--8y0a063axn--90a3acxn--90"
+    "aexn--90aisxn--9dbq2axn--9et52uxn--9krt00axn--b4w605ferdxn--bck1b9a5dre4cxn--c1avgxn--c2br7gxn--"
+    "cck2b3bxn--cckwcxetdxn--cg4bkixn--clchc0ea0b2g2a9gcdxn--czr694bxn--czrs0txn--czru2dxn--d1acj3bxn"
+    "--d1alfxn--e1a4cxn--eckvdtc9dxn--efvy88hxn--fct429kxn--fhbeixn--fiq228c5hsxn--fiq64bxn--fiqs8sxn"
+    "--fiqz9sxn--fjq720axn--flw351exn--fpcrj9c3dxn--fzc2c9e2cxn--fzys8d69uvgmxn--g2xx48cxn--gckr3f0fx"
+    "n--gecrj9cxn--gk3at1exn--h2breg3evexn--h2brj9cxn--h2brj9c8cxn--hxt814exn--i1b6b1a6a2exn--imr513n"
+    "xn--io0a7ixn--j1aefxn--j1amhxn--j6w193gxn--jlq480n2rgxn--jvr189mxn--kcrx77d1x4axn--kprw13dxn--kp"
+    "ry57dxn--kput3ixn--l1accxn--lgbbat1ad8jxn--mgb2ddesxn--mgb9awbfxn--mgba3a3ejtxn--mgba3a4f16axn--"
+    "mgba3a4fraxn--mgba7c0bbn0axn--mgbaakc7dvfxn--mgbaam7a8hxn--mgbab2bdxn--mgbah1a3hjkrdxn--mgbai9a5"
+    "eva00bxn--mgbai9azgqp6jxn--mgbayh7gpaxn--mgbbh1axn--mgbbh1a71exn--mgbc0a9azcgxn--mgbca7dzdoxn--m"
+    "gbcpq6gpa1axn--mgberp4a5d4a87gxn--mgberp4a5d4arxn--mgbgu82axn--mgbi4ecexpxn--mgbpl2fhxn--mgbqly7"
+    "c0a67fbcxn--mgbqly7cvafrxn--mgbt3dhdxn--mgbtf8flxn--mgbtx2bxn--mgbx4cd0abxn--mix082fxn--mix891fx"
+    "n--mk1bu44cxn--mxtq1mxn--ngbc5azdxn--ngbe9e0axn--ngbrxxn--nnx388axn--nodexn--nqv7fxn--nqv7fs00em"
+    "axn--nyqy26axn--o3cw4hxn--ogbpf8flxn--otu796dxn--p1acfxn--p1aixn--pgbs0dhxn--pssy2uxn--q7ce6axn-"
+    "-q9jyb4cxn--qcka1pmcxn--qxa6axn--qxamxn--rhqv96gxn--rovu88bxn--rvc1e0am3exn--s9brj9cxn--ses554gx"
+    "n--t60b56axn--tckwexn--tiq49xqyjxn--unup4yxn--vermgensberater-ctbxn--vermgensberatung-pwbxn--vhq"
+    "uvxn--vuq861bxn--w4r85el8fhu5dnraxn--w4rs40lxn--wgbh1cxn--wgbl6axn--xhq521bxn--xkc2al3hye2axn--x"
+    "kc2dl3a5ee0hxn--y9a3aqxn--yfro4i67oxn--ygbi2ammxxn--zfr164bxxxxyzyachtsyahooyamaxunyandexyeyodob"
+    "ashiyogayokohamayouyoutubeytyunzazapposzarazerozipzmzonezuerichzwnomschaccident-investigationacc"
+    "ident-preventionaerobaticaeroclubaerodromeagentsair-surveillanceair-traffic-controlaircraftairli"
+    "neairportairtrafficambulanceamusementassociationballooningcaacargocertificationchampionshipchart"
+    "ercivilaviationconferenceconsultantcontrolcouncilcrewdgcaeducatoremergencyengineentertainmentfed"
+    "erationflightfuelglidinggovernmentgroundhandlinghangglidinghomebuiltjournaljournalistleasinglogi"
+    "sticsmagazinemaintenancemicrolightmodellingnavigationparachutingparaglidingpassenger-association"
+    "pilotproductionrecreationrepbodyresresearchrotorcraftscientistskydivingstudenttradertrainerunion"
+    "workinggroupoffcommuneedgvogpbgobmusicasenasature164in-addrip6irisuriurnoractasnconfnswntozqldta"
+    "svicwapp0123456789abcdefghijklmnopqrstuvwxyzagroarchitectesassuravocatseconoloisirsoterestotouri"
+    "smunivacademiaboliviacienciacooperativademocraciadeporteecologiaeconomiaempresaindigenaindustria"
+    "medicinamovimientonaturalnombrenoticiaspatriaplurinacionalpoliticaprofesionalpueblorevistasaludt"
+    "ecnologiatksattransporteweb9guacuadmadvagrajuananiaparecidaarqatobarueribelembhzbibbmdboavistabs"
+    "bcampinagrandecampinascaxiascimcngcntcontagemcozcricuiabacuritibadefdesdetecnempenfengespetcetif"
+    "arfeiraflogfloripafndfortalfotfozfstg12geoggfgoianiagruimbindinfjabjampajdfjoinvillejorjusleglel"
+    "loglondrinamacapamaceiomanausmaringamatmorenamusnatalniteroinotntrodoosascopalmaspoappgpscpsipvh"
+    "qslrecreciferepribeiraoriobrancoriopretosalvadorsampasantamariasantoandresaobernardosaogoncasegs"
+    "jcslgslzsorocabasrvtecteothetmptrdudivixvlogzlgofabbcgcmbnbnsonqcykassogogouvpressexn--aroport-b"
+    "yawwwahcqgxgzhahbhehihljljsjxlnnmnxqhxjxn--od0algxzynzjartsfirmnomeeklogessldpolsocfink12aipfiel"
+    "ibpririikeunscialandaeroportavocatavouesccichambagrichirurgiens-dentistesexperts-comptablesgeome"
+    "tre-expertgretahuissier-justicemedecinnotairespharmacienportprdveterinairepvtmodguamidvxn--ciqpn"
+    "xn--gmq050ixn--gmqw5axn--lcvr32dxn--mk0axixn--od0aq3bxn--tn0agxn--uc0atvxn--uc0ay4axn--wcvs22dxn"
+    "--zf0avxfromizpersorel2000agrarbolteroticaerotikahotelingatlanjogaszkonyvelolakasprivreklamsulis"
+    "zextozsdeutazasdesaponpesidfmuni5g6gbiharcsdelhidrgengujaratinternetnicupabrabruzzoagrigentoales"
+    "sandriaalto-adigealtoadigeananconaandria-barletta-traniandria-trani-barlettaandriabarlettatrania"
+    "ndriatranibarlettaaostaaosta-valleyaostavalleyaosteapaquilaarezzoascoli-picenoascolipicenoastiav"
+    "avellinobalsanbalsan-sudtirolbalsan-suedtirolbaribarletta-trani-andriabarlettatraniandriabasbasi"
+    "licatabellunobeneventobergamobiellablbolognabolzanobolzano-altoadigebozenbozen-sudtirolbozen-sue"
+    "dtirolbresciabrindisibulsanbulsan-sudtirolbulsan-suedtirolcagliaricalabriacaltanissettacampaniac"
+    "ampidano-mediocampidanomediocampobassocarbonia-iglesiascarboniaiglesiascarrara-massacarraramassa"
+    "casertacataniacatanzarocbcecesena-forlicesenaforlichieticomocosenzacremonacrotonectcuneodell-ogl"
+    "iastradellogliastraemilia-romagnaemiliaromagnaemrenennafcfefermoferrarafgfirenzeflorencefoggiafo"
+    "rli-cesenaforlicesenafriuli-v-giuliafriuli-ve-giuliafriuli-vegiuliafriuli-venezia-giuliafriuli-v"
+    "eneziagiuliafriuli-vgiuliafriuliv-giuliafriulive-giuliafriulivegiuliafriulivenezia-giuliafriuliv"
+    "eneziagiuliafriulivgiuliafrosinonefvggenoagenovagoriziagrossetoiglesias-carboniaiglesiascarbonia"
+    "imperiaiserniala-spezialaquilalaspezialatinalazlaziolelecceleccoligligurialivornololodilomlombar"
+    "dialombardylucanialuccamaceratamantovamarmarchemassa-carraramassacarraramateramedio-campidanomed"
+    "iocampidanomessinamimilanmilanomodenamolmolisemonzamonza-brianzamonza-e-della-brianzamonzabrianz"
+    "amonzaebrianzamonzaedellabrianzanaplesnapolinovaranuoroogliastraolbia-tempioolbiatempiooristanoo"
+    "tpadovapaduapalermoparmapaviapcpdperugiapesaro-urbinopesarourbinopescarapipiacenzapiedmontpiemon"
+    "tepisapistoiapmnpopordenonepotenzapratopupugpugliapvpzraragusaravennarcreggio-calabriareggio-emi"
+    "liareggiocalabriareggioemiliargririetiriminirmrnromaromerovigosalernosarsardegnasardiniasassaris"
+    "avonasicsiciliasicilysienasiracusasondriospsuedtiroltataatarantotetempio-olbiatempioolbiateramot"
+    "ernitorinotostoscanatptrani-andria-barlettatrani-barletta-andriatraniandriabarlettatranibarletta"
+    "andriatrapanitrentin-sud-tiroltrentin-sudtiroltrentin-sued-tiroltrentin-suedtiroltrentinotrentin"
+    "o-a-adigetrentino-aadigetrentino-alto-adigetrentino-altoadigetrentino-s-tiroltrentino-stiroltren"
+    "tino-sud-tiroltrentino-sudtiroltrentino-sued-tiroltrentino-suedtiroltrentinoa-adigetrentinoaadig"
+    "etrentinoalto-adigetrentinoaltoadigetrentinos-tiroltrentinostiroltrentinosud-tiroltrentinosudtir"
+    "oltrentinosued-tiroltrentinosuedtiroltrentinsud-tiroltrentinsudtiroltrentinsued-tiroltrentinsued"
+    "tiroltrentotrevisotriestetsturintuscanyududineumbumbriaurbino-pesarourbinopesaroval-d-aostaval-d"
+    "aostavald-aostavaldaostavalle-aostavalle-d-aostavalle-daostavalleaostavalled-aostavalledaostaval"
+    "lee-aostevallee-d-aostevalleeaostevalleedaostevaovaresevbvdavenvenetoveneziaveniceverbaniavercel"
+    "liveronavibo-valentiavibovalentiavicenzaviterbovrvsvtvvxn--balsan-sdtirol-nsbxn--bozen-sdtirol-2"
+    "obxn--bulsan-sdtirol-nsbxn--cesena-forl-mcbxn--cesenaforl-i8axn--forl-cesena-fcbxn--forlcesena-c"
+    "8axn--sdtirol-n2axn--trentin-sd-tirol-rzbxn--trentin-sdtirol-7vbxn--trentino-sd-tirol-c3bxn--tre"
+    "ntino-sdtirol-szbxn--trentinosd-tirol-rzbxn--trentinosdtirol-7vbxn--trentinsd-tirol-6vbxn--trent"
+    "insdtirol-nsbxn--valle-aoste-ebbxn--valle-d-aoste-ehbxn--valleaoste-e7axn--valledaoste-ebbaichia"
+    "kitaaomorichibaehimefukuifukuokafukushimagifugunmahiroshimahokkaidohyogoibarakiishikawaiwatekaga"
+    "wakagoshimakanagawakawasakikitakyushukobekochikumamotolgmiemiyagimiyazakinaganonagasakinaraniiga"
+    "taoitaokayamasagasaitamasapporosendaishigashimaneshizuokatochigitokushimatottoritoyamawakayamaxn"
+    "--0trq7p7nnxn--1ctwoxn--1lqs03nxn--1lqs71dxn--2m4a15exn--32vp30hxn--4it168dxn--4it797kxn--4pvxsx"
+    "n--5js045dxn--5rtp49cxn--5rtq34kxn--6btw5axn--6orx2rxn--7t0a264cxn--8ltr62kxn--8pvr4uxn--c3s14mx"
+    "n--d5qv7z876cxn--djrs72d6uyxn--djty4kxn--efvn9sxn--ehqz56nxn--elqq16hxn--f6qx53axn--k7yn95exn--k"
+    "brq7oxn--klt787dxn--kltp7dxn--kltx9axn--klty5xxn--mkru45ixn--nit225kxn--ntso0iqx3axn--ntsq17gxn-"
+    "-pssu33lxn--qqqt11mxn--rht27zxn--rht3dxn--rht61exn--rny31hxn--tor131oxn--uist22hxn--uisz3gxn--uu"
+    "wu58axn--vgu402cxn--zbx025dyamagatayamaguchiyamanashiasspharmacienstrabusanchungbukchungnamdaegu"
+    "daejeongangwongwangjugyeongbukgyeonggigyeongnamhsincheonjejujeonbukjeonnamseoululsanembperassngr"
+    "pplcitsagricultureairairguardalabamaalaskaamberamericanamericanaamericanantiquesamericanartandan"
+    "nefrankanthroanthropologyantiquesaquariumarboretumarchaeologicalarchaeologyarchitectureartanddes"
+    "ignartcenterartdecoarteducationartgalleryartsandcraftsasmatartassassinationassisiastronomyatlant"
+    "aaustinaustraliaautomotiveaviationaxisbadajozbaghdadbahnbalebaltimorebaselbathsbauernbeauxartsbe"
+    "eldengeluidbellevuebergbauberkeleybernbilbaobillbirdartbirthplacebonnbotanicalbotanicalgardenbot"
+    "anicgardenbotanybrandywinevalleybrasilbristolbritishbritishcolumbiabroadcastbrunelbrusselbruxell"
+    "esbuildingburghofbusbusheycadaquescaliforniacambridgecancanadacapebretoncarriercartoonartcasadel"
+    "amonedacastlecastrescelticchattanoogacheltenhamchesapeakebaychicagochildrenchildrenschildrensgar"
+    "denchiropracticchocolatechristiansburgcincinnaticinemacircuscivilisationcivilizationcivilwarclin"
+    "tonclockcoalcoastaldefencecodycoldwarcollectioncolonialwilliamsburgcoloradoplateaucolumbiacolumb"
+    "uscommunicationcommunicationscomputerhistorycontemporarycontemporaryartconventcopenhagencorporat"
+    "ioncorvettecostumecountryestatecountycraftscranbrookcreationculturalculturalcenterculturecyberda"
+    "lidallasdatabaseddrdecorativeartsdelawaredelmenhorstdenmarkdepotdetroitdinosaurdiscoverydollsdon"
+    "ostiadurhameastafricaeastcoasteducationalegyptianeisenbahnelburgelvendrellembroideryencyclopedic"
+    "englandentomologyenvironmentenvironmentalconservationepilepsyessexethnologyexeterexhibitionfarme"
+    "quipmentfarmsteadfieldfigueresfilateliafineartfineartsfinlandflandersfloridaforcefortmissoulafor"
+    "tworthfrancaisefrankfurtfranziskanerfreemasonryfreiburgfribourgfrogfundaciogatewaygeelvinckgemol"
+    "ogicalgeologygeorgiagiessenglasgorgegrandrapidsgrazguernseyhalloffamehandsonharvestcelebrationha"
+    "waiiheimatunduhrenhellashembygdsforbundheritagehistoirehistoricalhistoricalsocietyhistorichouses"
+    "historischhistorischeshistoryhistoryofsciencehorologyhumanitiesillustrationimageandsoundindianin"
+    "dianaindianapolisindianmarketintelligenceinteractiveiraqironisleofmanjamisonjeffersonjerusalemje"
+    "wishjewishartjfkjournalismjudaicajudygarlandjuedischesjuifkaratekarikaturkoebenhavnkunstkunstsam"
+    "mlungkunstunddesignlaborlabourlajollalancashirelandeslanslarssonlewismillerlinzlivinghistoryloca"
+    "lhistorylosangeleslouvreloyalistlucerneluxembourgluzernmadmallorcamanchestermansionmansionsmanxm"
+    "arburgmaritimemaritimomarylandmarylhurstmedicalmedizinhistorischesmeeresmesaverdemichiganmidatla"
+    "nticmilitarymillminersminingminnesotamissilemissoulamodernmomamonmouthmonticellomontrealmotorcyc"
+    "lemuenchenmuenstermulhousemunciemuseetmuseumcentermuseumverenigingnationalnationalfirearmsnation"
+    "alheritagenativeamericannaturalhistorynaturalhistorymuseumnaturalsciencesnaturenaturhistorisches"
+    "natuurwetenschappennaumburgnavalnebraskaneuesnewhampshirenewjerseynewmexiconewportnewspapernewyo"
+    "rkniepcenorfolknorthnynyoceanographicoceanographiqueomahaontarioopenairoregonoregontrailotagooxf"
+    "ordpacificpaderbornpalacepaleopalmspringspanamapasadenaphiladelphiaphiladelphiaareaphilatelyphoe"
+    "nixpilotspittsburghplanetariumplantationplantsplazaportalportlandportlligatposts-and-telecommuni"
+    "cationspreservationpresidioprojectpublicpubolrailroadrailwayresistanceriodejaneirorochesterrocka"
+    "rtrussiasaintlouissalemsalvadordalisalzburgsandiegosanfranciscosantabarbarasantacruzsantafesaska"
+    "tchewansatxsavannahgaschlesischesschoenbrunnschokoladenschweizscience-fictionscienceandhistorysc"
+    "ienceandindustrysciencecentersciencecenterssciencehistorysciencessciencesnaturellesscotlandseapo"
+    "rtsettlementsettlerssherbrookesibenikskolesocietysolognesoundandvisionsouthcarolinasouthwestspys"
+    "quarestadtstalbansstarnbergstatestateofdelawarestationsteamsteiermarkstjohnstpetersburgstuttgart"
+    "suissesurgeonshallsurreysvizzeraswedentanktcmtelekommunikationtelevisiontexastextiletimetimekeep"
+    "ingtopologytouchtransporttreetrolleytrusteeuhrenulmunderseausausantiquesusartsuscountryestateusc"
+    "ultureusdecorativeartsusgardenushistoryushuaiauslivinghistoryutahuvicvalleyvantaaversaillesvilla"
+    "gevirginiavirtualvirtuelvolkenkundewalloniewarwashingtondcwatch-and-clockwatchandclockwesternwes"
+    "tfalenwhalingwildlifewilliamsburgwindmillworkshopxn--9dbhblg6dixn--comunicaes-v6a2oxn--correios-"
+    "e-telecomunicaes-ghc29axn--h1aeghxn--lns-qlayorkyorkshireyosemiteyouthzoologicalzoologyotheraaaa"
+    "rborteaejrieafjordagdenesakershusaknoluoktaakrehamnalaheadjualesundalgardalstahaugaltaalvdalamli"
+    "amotandasuoloandebuandoyardalaremarkarendalarnaaseralaskeraskimaskoyaskvollasnesaudnedalnaukraau"
+    "reaurlandaurskog-holandaustevollaustrheimaveroybadaddjabahcavuotnabahccavuotnabaidarbajddarbalat"
+    "balestrandballangenbalsfjordbamblebardubarumbatsfjordbearalvahkibeardubeiarnbergbergenberlevagbi"
+    "evatbindalbirkenesbjarkoybjerkreimbjugnbodoboknbomlobremangerbronnoybronnoysundbrumunddalbrynebu"
+    "budejjubuskerudbyglandbyklecahcesuolodavvenjargadavvesiidadeatnudepdielddanuorridivtasvuodnadivt"
+    "tasvuotnadonnadovredrammendrangedaldrobakdyroyegersundeideidfjordeidsbergeidskogeidsvolleigersun"
+    "delverumenebakkengerdaletneetnedalevenassievenesevje-og-hornnesfarsundfauskefedjefetfetsundfhsfi"
+    "nnoyfitjarfjalerfjellflaflakstadflatangerflekkefjordflesbergfloraflorofolkebiblfolldalfordeforsa"
+    "ndfosnesfranafredrikstadfreifrognfrolandfrostafroyafuoiskufuosskofusafylkesbiblfyresdalgaivuotna"
+    "galsagamvikgangaviikagaulargausdalgiehtavuoatnagildeskalgiskegjemnesgjerdrumgjerstadgjesdalgjovi"
+    "kgloppengolgrangranegranvingratangengrimstadgronggruegulenguovdageaidnuhabmerhadselhagebostadhal"
+    "denhalsahamarhamaroyhammarfeastahammerfesthapmirharamhareidharstadhasvikhattfjelldalhaugesundhed"
+    "markhemnehemneshemsedalheradhitrahjartdalhjelmelandhobolhofhokksundholholeholmestrandholtalenhon"
+    "efosshordalandhornindalhortenhoyangerhoylandethurdalhurumhvalerhyllestadibestadidrettinderoyivel"
+    "andivgujan-mayenjessheimjevnakerjolsterjondaljorpelandkafjordkarasjohkakarasjokkarlsoykarmoykaut"
+    "okeinokirkenesklabukleppkommunekongsbergkongsvingerkopervikkraanghkekragerokristiansandkristians"
+    "undkrodsheradkrokstadelvakvafjordkvalsundkvamkvanangenkvinesdalkvinnheradkviteseidkvitsoylaakesv"
+    "uemielahppilangevaglardallarviklavagislavangenleangaviikalebesbyleikangerleirfjordleirviklekalek"
+    "sviklenviklerdallesjalevangerlierliernelillehammerlillesandlindaslindesnesloabatlodingenloppalor"
+    "enskoglotenlundlunnerluroylusterlyngdallyngenmalatvuopmimalselvmalvikmandalmarkermarnardalmasfjo"
+    "rdenmasoymatta-varjjatmelandmeldalmelhusmeloymerakermidsundmidtre-gauldalmjondalenmo-i-ranamoare"
+    "kemodalenmodummoldemore-og-romsdalmosjoenmoskenesmossmosvikmuosatnaamesjevuemienamdalseidnamsosn"
+    "amsskogannannestadnaroynarviikanarviknaustdalnavuotnanedre-eikernesnanesoddennesoddtangennesseby"
+    "nessetnissedalnittedalnord-aurdalnord-fronnord-odalnorddalnordkappnordlandnordre-landnordreisano"
+    "re-og-uvdalnotoddennotteroyoddaoksnesolomasvuotnaoppdaloppegardorkangerorkdalorlandorskogorstaos"
+    "enosloosoyroosteroyostfoldostre-totenoverhallaovre-eikeroyeroygardenoystre-slidreporsangerporsan"
+    "guporsgrunnraderadoyrahkkeravjuraholtraisarakkestadralingenranarandabergraumarendalenrenneburenn"
+    "esoyrindalringeburingerikeringsakerrisorrissarlroanrodoyrollagromsaromskogrorosrostroykenroyrvik"
+    "ruovatryggesalangensalatsaltdalsamnangersandefjordsandnessandnessjoensandoysarpsborgsaudasauhera"
+    "dselselbuseljeseljordsfsiellaksigdalsiljansirdalskanitskanlandskaunskedsmoskedsmokorsetskienskie"
+    "rvaskiptvetskjakskjervoyskodjeslattumsmolasnaasesnasasnillfjordsnoasasogndalsognesokndalsolasolu"
+    "ndsomnasondre-landsongdalensor-aurdalsor-fronsor-odalsor-varangersorfoldsorreisasortlandsorumspj"
+    "elkavikspydebergstangestatstathellestavangerstavernsteigensteinkjerstjordalstjordalshalsenstokke"
+    "stor-elvdalstordstordalstorfjordstrandstrandastrynsulasuldalsundsunndalsurnadalsvalbardsveiosvel"
+    "viksykkylventanatanangertelemarktingvolltinntjeldsundtjometokketolgatonsbergtorskentranatranbytr"
+    "anoytroandintrogstadtromsatromsotrondheimtrysiltvedestrandtydaltynsettysfjordtysnestysvarullensa"
+    "kerullensvangulvikunjargautsiravaapstevadsovagavaganvagsoyvaksdalvallevangvanylvenvardovarggatva"
+    "royvefsnvegavegarsheivenneslaverdalverranvestbyvestfoldvestnesvestre-slidrevestre-totenvestvagoy"
+    "vevelstadvfvgsvikviknavindafjordvoagatvoldavossvossevangenxn--andy-iraxn--asky-iraxn--aurskog-hl"
+    "and-jnbxn--avery-yuaxn--bdddj-mrabdxn--bearalvhki-y4axn--berlevg-jxaxn--bhcavuotna-s4axn--bhccav"
+    "uotna-k7axn--bidr-5nacxn--bievt-0qaxn--bjarky-fyaxn--bjddar-ptaxn--blt-elabxn--bmlo-graxn--bod-2"
+    "naxn--brnny-wuacxn--brnnysund-m8acxn--brum-voaxn--btsfjord-9zaxn--davvenjrga-y4axn--dnna-graxn--"
+    "drbak-wuaxn--dyry-iraxn--eveni-0qa01gaxn--finny-yuaxn--fjord-lraxn--fl-ziaxn--flor-jraxn--frde-g"
+    "raxn--frna-woaxn--frya-hraxn--ggaviika-8ya47hxn--gildeskl-g0axn--givuotna-8yaxn--gjvik-wuaxn--gl"
+    "s-elacxn--h-2faxn--hbmer-xqaxn--hcesuolo-7ya35bxn--hgebostad-g3axn--hmmrfeasta-s4acxn--hnefoss-q"
+    "1axn--hobl-iraxn--holtlen-hxaxn--hpmir-xqaxn--hyanger-q1axn--hylandet-54axn--indery-fyaxn--jlste"
+    "r-byaxn--jrpeland-54axn--karmy-yuaxn--kfjord-iuaxn--klbu-woaxn--koluokta-7ya57hxn--krager-gyaxn-"
+    "-kranghke-b0axn--krdsherad-m8axn--krehamn-dxaxn--krjohka-hwab49jxn--ksnes-uuaxn--kvfjord-nxaxn--"
+    "kvitsy-fyaxn--kvnangen-k0axn--l-1faxn--laheadju-7yaxn--langevg-jxaxn--ldingen-q1axn--leagaviika-"
+    "52bxn--lesund-huaxn--lgrd-poacxn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn--lrenskog-5"
+    "4axn--lt-liacxn--lten-graxn--lury-iraxn--mely-iraxn--merker-kuaxn--mjndalen-64axn--mlatvuopmi-s4"
+    "axn--mli-tlaxn--mlselv-iuaxn--moreke-juaxn--mosjen-eyaxn--mot-tlaxn--mre-og-romsdal-qqbxn--msy-u"
+    "la0hxn--mtta-vrjjat-k7afxn--muost-0qaxn--nmesjevuemie-tcbaxn--nry-yla5gxn--nttery-byaexn--nvuotn"
+    "a-hwaxn--oppegrd-ixaxn--ostery-fyaxn--osyro-wuaxn--porsgu-sta26fxn--rady-iraxn--rdal-poaxn--rde-"
+    "ulaxn--rdy-0nabxn--rennesy-v1axn--rhkkervju-01afxn--rholt-mraxn--risa-5naxn--risr-iraxn--rland-u"
+    "uaxn--rlingen-mxaxn--rmskog-byaxn--rros-graxn--rskog-uuaxn--rst-0naxn--rsta-fraxn--ryken-vuaxn--"
+    "ryrvik-byaxn--s-1faxn--sandnessjen-ogbxn--sandy-yuaxn--seral-lraxn--sgne-graxn--skierv-utaxn--sk"
+    "jervy-v1axn--skjk-soaxn--sknit-yqaxn--sknland-fxaxn--slat-5naxn--slt-elabxn--smla-hraxn--smna-gr"
+    "axn--snase-nraxn--sndre-land-0cbxn--snes-poaxn--snsa-roaxn--sr-aurdal-l8axn--sr-fron-q1axn--sr-o"
+    "dal-q1axn--sr-varanger-ggbxn--srfold-byaxn--srreisa-q1axn--srum-graxn--stfold-9xaxn--stjrdal-s1a"
+    "xn--stjrdalshalsen-sqbxn--stre-toten-zcbxn--tjme-hraxn--tnsberg-q1axn--trany-yuaxn--trgstad-r1ax"
+    "n--trna-woaxn--troms-zuaxn--tysvr-vraxn--unjrga-rtaxn--vads-jraxn--vard-jraxn--vegrshei-c0axn--v"
+    "estvgy-ixa6oxn--vg-yiabxn--vgan-qoaxn--vgsy-qoa0jxn--vre-eiker-k8axn--vrggt-xqadxn--vry-yla5gxn-"
+    "-yer-znaxn--ygarden-p1axn--ystre-slidre-ujbgeekgovtiwimaoriparliamentxn--mori-qsaabofamgokgongos"
+    "aidatmaugustowbabia-gorabedzinbeskidybialowiezabialystokbielawabieszczadyboleslawiecbydgoszczbyt"
+    "omcieszynczeladzczestdlugolekaelblagelkglogowgminagnieznogorlicegrajewogsmilawajaworznojelenia-g"
+    "orajgorakaliszkarpaczkartuzykaszubykatowicekazimierz-dolnykepnoketrzynklodzkokobierzycekolobrzeg"
+    "koninkonskowolakutnolapyleborklegnicalezajsklimanowalomzalowiczlubinlukowmailmalborkmalopolskama"
+    "zowszemazurymiastamielecmielnomragowonaklonieruchomoscinowarudanysaolawaoleckoolkuszolsztynopocz"
+    "noopoleostrodaostrolekaostrowiecostrowwlkppilapiszpodhalepodlasiepolkowicepomorskiepomorzepowiat"
+    "prochowicepruszkowprzeworskpulawyradomrawa-mazrybnikrzeszowsanoksejnysklepskoczowslaskslupsksoss"
+    "osnowiecstalowa-wolastarachowicestargardsuwalkiswidnicaswiebodzinswinoujscieszczecinszczytnoszko"
+    "latargitarnobrzegtgoryturekturystykatychyustkawalbrzychwarmiawarszawawawwegrowwielunwloclwloclaw"
+    "ekwodzislawwolominwroclawzachpomorzaganzarowzgorazgorzelecestislaacaacctjurrechtplosecpublbelaub"
+    "randfhfhskfhvkomforbkommunalforbundkomvuxlanbibnaturbruksgymnparticonsuladoembaixadaprincipesaot"
+    "ometestensintlmincomnatbbsbelkeptskebizxn--czrw28bxn--zf0ao64acherkassycherkasychernigovchernihi"
+    "vchernivtsichernovtsycrimeadndnepropetrovskdnipropetrovskdonetskdpifivano-frankivskkharkivkharko"
+    "vkhersonkhmelnitskiykhmelnytskyikievkirovogradkrymkskvkyivlugansklutsklvivmykolaivnikolaevododes"
+    "aodessapoltavarivnerovnorvsebastopolsevastopolsumyternopiluzhgorodvinnicavinnytsiavolynyaltazapo"
+    "rizhzhezaporizhzhiazhitomirzhytomyrzpztnhspoliceakdcdnifedfliaisandnhnjnsnnvnyohoktxutwiwvwygube"
+    "12rarxn--4dbgdty6cxn--5dbhl8dxn--8dbq2axn--hebda8bxn--80auxn--90azhxn--d1atxn--o1acxn--o1achxn--"
+    "12c1fe0brxn--12cfi8ixb8lxn--12co0c3b4evaxn--h3cuzk1dixn--m3ch0j3axn--o3cyx2aagricaltgrondarnisst"
+    "hdfrjrraisaiamaanjoasukechiryuchitafusogamagorihandahazuhekinanhigashiuraichinomiyainazawainuyam"
+    "aisshikiiwakurakaniekariyakasugaikirakiyosukomakikonankotamihamamiyoshinishionisshinobuoguchioha"
+    "ruokazakiowariasahisetoshikatsushinshiroshitarataharatakahamatobishimatoeitogotokaitokonametoyoa"
+    "ketoyohashitoyokawatoyonetsushimayatomidaisenfujisatogojomehachirogatahappouhigashinarusehonjoho"
+    "njyoikawakamikoanikamiokakatagamikazunokitaakitakosakakyowamisatomitanemoriyoshinikahonoshirooda"
+    "teogaogatasembokuyokoteyurihonjogonohehachinohehashikamihiranaihirosakiitayanagikuroishimisawamu"
+    "tsunakadomarinohejioiraseowanirokunohesannoheshichinoheshingotakkotowadatsugarutsurutaabikoasahi"
+    "chonanchoseichoshichuofunabashifuttsuhanamigawaichiharaichikawainzaiisumikamagayakamogawakashiwa"
+    "katorikatsuurakimitsukisarazukozakikujukurikyonanmatsudomidoriminamibosomobaramutsuzawanagaranag"
+    "areyamanarashinonaritanodaoamishirasatoomigawaonjukuotakisakaeshimofusashirakoshiroishisuisodega"
+    "urasosatakotateyamatoganetohnoshotomisatourayasuyachimatayachiyoyokaichibayokoshibahikariyotsuka"
+    "idoainanhonaiikataimabariiyokamijimakihokukumakogenmasakimatsunomatsuyamanamikataniihamaozusaijo"
+    "seiyoshikokuchuotobetoonuchikouwajimayawatahamaechizeneiheijiikedakatsuyamaminamiechizenobamaohi"
+    "onosabaesakaitsurugawakasaashiyabuzenchikugochikuhochikujochikushinochikuzendazaifufukuchihakata"
+    "higashihirokawahisayamaiizukainatsukikahokasugakasuyakawarakeisenkogakuratekurogikurumeminamimiy"
+    "akomiyamamiyawakamizumakimunakatanakagawanakamanishinogataogoriokagakiokawaokiomutaongaonojootos"
+    "aigawasasagurishingushinyoshitomishonaisoedasuetachiaraitagawatakatatohotoyotsutsuikiukihaumiusu"
+    "iyamadayameyanagawayukuhashiaizubangeaizumisatoaizuwakamatsuasakawabandaifurudonofutabahanawahir"
+    "atahironoiitateinawashiroiwakiizumizakikagamiishikaneyamakawamatakitakatakitashiobarakoorikoriya"
+    "makunimimiharumishimanamienangonishiaizunishigookumaomotegootamasamegawashimogoshirakawashowasom"
+    "asukagawataishintamakawatanagurateneiyabukiyamatoyamatsuriyanaizuyugawaanpachienaginangodogujoha"
+    "shimahichisohidahigashishirakawaibigawakakamigaharakanikasaharakasamatsukawauekitagataminominoka"
+    "momitakemizunamimotosunakatsugawaogakisakahogisekisekigaharatajimitakayamataruitokitomikawanouch"
+    "iyaotsuyoroannakachiyodafujiokahigashiagatsumaisesakiitakurakannakanrakatashinakawabakiryukusats"
+    "umaebashimeiwaminakaminaganoharanakanojonanmokunumataoizumioraotashibukawashimonitashintotakasak"
+    "itamamuratatebayashitomiokatsukiyonotsumagoiuenoyoshiokaasaminamidaiwaetajimafuchufukuyamahatsuk"
+    "aichihigashihiroshimahongojinsekikogenkaitakuikumanokuremiharanakaonomichiosakikamijimaotakesaka"
+    "seraseranishishinichishobaratakeharaabashiriabiraaibetsuakabiraakkeshiasahikawaashibetsuashoroas"
+    "sabuatsumabibaibieibifukabihorobiratorichippubetsuchitoseebetsuembetsueniwaerimoesanesashifukaga"
+    "wafuranofurubirahaborohakodatehamatonbetsuhidakahigashikagurahigashikawahiroohokuryuhokutohonbet"
+    "suhorokanaihoronobeimakaneishikariiwamizawaiwanaikamifuranokamikawakamishihorokamisunagawakamoen"
+    "aikayabekembuchikikonaikimobetsukitahiroshimakitamikiyosatokoshimizukunneppukuriyamakuromatsunai"
+    "kushirokutchanmashikematsumaemikasaminamifuranomombetsumoseushimukawamurorannaienakasatsunainaka"
+    "tombetsunanaenanporonayoronemuroniikappunikinishiokoppenoboribetsuobihiroobiraoketookoppeotaruot"
+    "obeotofukeotoineppuoumuozorapippurankoshirebunrikubetsurishiririshirifujisaromasarufutsushakotan"
+    "sharishibechashibetsushikabeshikaoishimamakishimizushimokawashinshinotsushintokushiranukashiraoi"
+    "shiriuchisobetsusunagawataikitakasutakikawatakinoueteshikagatobetsutohmatomakomaitomaritoyatoyak"
+    "otoyotomitoyouratsubetsutsukigataurakawaurausuuryuutashinaiwakkanaiwassamuyakumoyoichiaioiakashi"
+    "akoamagasakiaogakiasagoawajifukusakigoshikiharimahimejiinagawaitamikakogawakamigorikasaikawanish"
+    "imikiminamiawajinishinomiyanishiwakisandasannansasayamasayoshinonsenshisosumototaishitakatakaraz"
+    "ukatakasagotakinotambatatsunotoyookayabuyashiroyokayokawaamibandochikuseidaigofujishirohitachina"
+    "kahitachiomiyahitachiotainainashikiitakoiwamajosokamisukasamakashimakasumigauramihomitomoriyanam"
+    "egataoaraiogawaomitamaryugasakisakuragawashimodateshimotsumashirosatosowasuifutakahagitamatsukur"
+    "itomobetonetoridetsuchiuratsukubauchiharaushikuyawarayukianamizuhakuihakusankagakahokukanazawaka"
+    "wakitanakanotonanaonominonoichinotoshikasuzutsubatatsurugiuchinadawajimafudaifujisawahanamakihir"
+    "aizumiichinoheichinosekiiwaizumijobojikamaishikanegasakikarumaikawaikitakamikujikunohekuzumakimi"
+    "zusawamoriokaninoheofunatooshuotsuchirikuzentakatashiwashizukuishisumitatanohatatonoyahabaayagaw"
+    "ahigashikagawakanonjikotohiramannomarugamemitoyonaoshimasanukitadotsutakamatsutonoshouchinomiuta"
+    "zuzentsujiakuneamamihiokiisenizumikanoyakawanabekinkokouyamamakurazakimatsumotominamitanenakatan"
+    "enishinoomotesatsumasendaisootarumizuyusuiaikawaatsugiayasechigasakiebinahadanohakonehiratsukais"
+    "eharakaiseikamakurakiyokawamatsudaminamiashigaramiuranakaininomiyaodawaraoioisosagamiharasamukaw"
+    "atsukuiyamakitayokosukayugawarazamazushiakigeiseihigashitsunoinokagamikamikitagawamotoyamamuroto"
+    "naharinakamuranankokunishitosaniyodogawaochiotoyootsukisakawasukumosusakitosatosashimizutoyotsun"
+    "oumajiyasudayusuharaamakusaaraoasochoyogyokutokamiamakusakikuchimashikimifuneminamataminamioguni"
+    "nagasunishiharaogunitakamoriukiutoyamagayatsushiroayabefukuchiyamahigashiyamaideinejoyokameokaka"
+    "mokitakizukumiyamakyotambakyotanabekyotangomaizuruminamiyamashiromiyazumukonagaokakyonakagyonant"
+    "anoyamazakisakyoseikatanabeujiujitawarawazukayamashinayawatainabeisekameyamakawagoekihokisosakik"
+    "iwakomonokuwanamatsusakaminamiisemisuginabarishimasuzukatadotakitamakitobatsuudonoureshinowatara"
+    "iyokkaichifurukawahigashimatsushimaishinomakiiwanumakakudamarumorimatsushimaminamisanrikumuratan"
+    "atoriogawaraohiraonagawaosakirifusemineshibatashichikashukushikamashiogamashiroishitagajotaiwato"
+    "metomiyawakuyawatariyamamotozaoayaebinogokasehyugakadogawakawaminamikijokitaurakobayashikunitomi"
+    "kushimamimatamiyakonojomorotsukanichinannishimeranobeokasaitoshiibashintomitakaharutakanabetakaz"
+    "akiachiagematsuananaokiazuminochikuhokuchikumachinofujimihakubaharahirayaiidaiijimaiiyamaiizunai"
+    "kusakakaruizawakawakamikisokisofukushimakitaaikikomaganekomoromatsukawamiasaminamiaikiminamimaki"
+    "minamiminowaminowamiyadamiyotamochizukinagawanagisonakanonozawaonsenobuseokayaomachiomiookuwaoos"
+    "hikaotarisakakisakusakuhoshimosuwashinanomachishiojirisuwasuzakatakagitateshinatogakushitogurato"
+    "miuedawadayamanouchiyasakayasuokachijiwafutsugotohasamihiradoikiisahayakawatanakuchinotsumatsuur"
+    "aomuraosetosaikaisaseboseihishimabarashinkamigototogitsuunzenandogosehegurihigashiyoshinoikaruga"
+    "ikomakamikitayamakanmakikashibakashiharakatsuragikoryokurotakimitsuemiyakenosegawaojioudaoyodosa"
+    "kuraisangoshimoichishimokitayamashinjosonitakatoritawaramototenkawatenriudayamatokoriyamayamatot"
+    "akadayamazoeyoshinoagaaganogosenitoigawaizumozakijoetsukariwakashiwazakiminamiuonumamitsukemuika"
+    "murakamimyokonagaokaojiyasadosanjoseiroseirousekikawatagamitainaitochiotokamachitsubametsunanuon"
+    "umayahikoyoitayuzawabeppubungoonobungotakadahasamahijihimeshimahitakamitsuekokonoekujukunisakiku"
+    "susaikitaketatsukumiusukiyufuakaiwaasakuchibizenhayashimaibarakagaminokasaokakibichuokumenankura"
+    "shikimaniwamisakinaginiiminishiawakurasatoshosetouchishoosojatakahashitamanotsuyamawakeyakageagu"
+    "niginowanginozagushikamihaebaruhiraraiheyaishigakiitomanizenakadenakinkitadaitokitanakagusukukum"
+    "ejimakunigamiminamidaitomotobunagonahanakagusukunakijinnanjoogimionnashimojitaketomitaramatokash"
+    "ikitomigusukutonakiurasoeurumayaeseyomitanyonabaruyonagunizamamiabenochihayaakasakadaitofujiider"
+    "ahabikinohannanhigashiosakahigashisumiyoshihigashiyodogawahirakataizumiotsuizumisanokadomakaizuk"
+    "akanankashiwarakatanokawachinaganokishiwadakumatorimatsubaraminatominohmoriguchineyagawanoseosak"
+    "asayamasayamasennansettsushijonawateshimamotosuitatadaokatajiritakaishitakatsukitondabayashitoyo"
+    "nakatoyonoyaoariakearitafukudomigenkaihamatamahizenimarikamiminekanzakikaratsukitahatakiyamakouh"
+    "okukyuraginishiaritaogiouchitakutaratosuyoshinogariarakawaasakachichibufujiminofukayahannohanyuh"
+    "asudahatogayahatoyamahigashichichibuhigashimatsuyamairumaiwatsukikamiizumikamisatokasukabekawagu"
+    "chikawajimakazokitamotokoshigayakounosukukikumagayamatsubushiminanomiyashiromoroyamanagatoroname"
+    "gawaniizaoganoogoseokegawaomiyaranzanryokamisakadosatteshikishiraokasokasugitotodatokigawatokoro"
+    "zawatsurugashimaurawawarabiyashioyokozeyonoyoriiyoshidayoshikawayoshimiaishogamohigashiomihikone"
+    "kokakoseikotomaibaramoriyamanagahamanishiazainotogawaomihachimanotsurittoryuohtakashimatorahimet"
+    "oyosatoyasuakagigotsuhamadahigashiizumohikawahikimiizumokakinokimasudamatsuenishinoshimaohdaokin"
+    "oshimaokuizumotamayutsuwanounnanyasugiyatsukaaraiatamifujifujiedafujikawafujinomiyafukuroigotemb"
+    "ahaibarahamamatsuhigashiizuitoiwataizuizunokunikakegawakannamikawanehonkawazukikugawakosaimakino"
+    "haramatsuzakiminamiizumorimachinishiizunumazuomaezakishimadashimodasusonoyaizuashikagabatohagaic"
+    "hikaiiwafunekaminokawakanumakarasuyamakuroisomashikomibumokamoteginasunasushiobaranikkonishikata"
+    "nogiohtawaraoyamasanoshimotsukeshioyatakanezawatsugaujiieutsunomiyayaitaaizumiichibaitanokainank"
+    "omatsushimamatsushigemimamuginarutosanagochishishikuiwajikiadachiakirunoakishimaaogashimabunkyoc"
+    "hofuedogawafussahachijohachiojihamurahigashikurumehigashimurayamahigashiyamatohinohinodehinohara"
+    "inagiitabashikatsushikakiyosekodairakoganeikokubunjikomaekouzushimakunitachimachidameguromitakam"
+    "izuhomusashimurayamamusashinonerimaogasawaraokutamaomeoshimasetagayashibuyashinagawashinjukusugi"
+    "namisumidatachikawataitotamatoshimachizukawaharakogekotouramisasananbusakaiminatoyazuyonagofukum"
+    "itsufunahashihimiimizuinamijohanakamiichikurobenakaniikawanamerikawanantonyuzenoyabetairatakaoka"
+    "togatonamiunazukiuozuaridaaridagawagobohashimotohirogawaiwadekamitondakiminokinokawakitayamakoya"
+    "kozakozagawakudoyamakushimotonachikatsuurashirahamataijiyuasayurafunagatahigashineiidekaminoyama"
+    "mamurogawamikawamurayamanagainakayamananyonishikawaobanazawaoeohkuraoishidasagaesakatasakegawash"
+    "iratakatakahatatendotozawatsuruokayamanobeyonezawayuzaabuhagihikarihofuiwakunikudamatsumitounaga"
+    "toshimonosekishunantabusetokuyamaubeyuudoshifuefukifujikawaguchikofujiyoshidahayakawaichikawamis"
+    "atokaikofukoshukosugeminami-alpsminobunakamichinarusawanirasakinishikatsuraoshinotabayamatsuruue"
+    "noharayamanakakonesosvalerxn--vler-qoaheroysandexn--b-5gaxn--hery-iragriwickmpspkonsulatkppspkwp"
+    "kwpspmupoirmoumpinbpiwpsppssepuprzgwsdnskostarostwougimumumigupowuppouwuzswifwiihwinbwioswitdwiw"
+    "wsawskrwuozwzmiuwann-arborcogdsteatonwashtenawschoolschtrparoch"
+    ;
+
+// Node 0 is the root
+static constexpr PublicSuffixNode publicSuffixNodes[] = {
+    {0, 0, 0, 1490, 1},
+    {0, 3, 1, 0, 0},
+    {3, 4, 1, 0, 0},
+    {7, 6, 1, 0, 0},
+    {13, 3, 1, 0, 0},
+    {16, 6, 1, 0, 0},
+    {22, 6, 1, 0, 0},
+    {28, 3, 1, 0, 0},
+    {31, 4, 1, 0, 0},
+    {35, 7, 1, 0, 0},
+    {42, 8, 1, 0, 0},
+    {50, 2, 1, 6, 1491},
+    {52, 7, 1, 0, 0},
+    {59, 9, 1, 0, 0},
+    {68, 10, 1, 0, 0},
+    {78, 11, 1, 0, 0},
+    {89, 3, 1, 0, 0},
+    {92, 5, 1, 0, 0},
+    {97, 2, 1, 1, 1497},
+    {99, 3, 1, 0, 0},
+    {102, 5, 1, 0, 0},
+    {107, 2, 1, 7, 1498},
+    {109, 3, 1, 0, 0},
+    {112, 4, 1, 86, 1505},
+    {116, 5, 1, 0, 0},
+    {121, 2, 1, 5, 1591},
+    {123, 3, 1, 0, 0},
+    {126, 6, 1, 0, 0},
+    {132, 2, 1, 5, 1596},
+    {134, 7, 1, 0, 0},
+    {141, 6, 1, 0, 0},
+    {147, 2, 1, 4, 1601},
+    {149, 3, 1, 0, 0},
+    {152, 6, 1, 0, 0},
+    {158, 8, 1, 0, 0},
+    {166, 6, 1, 0, 0},
+    {172, 4, 1, 0, 0},
+    {176, 2, 1, 6, 1605},
+    {178, 9, 1, 0, 0},
+    {187, 7, 1, 0, 0},
+    {194, 6, 1, 0, 0},
+    {200, 9, 1, 0, 0},
+    {209, 8, 1, 0, 0},
+    {217, 4, 1, 0, 0},
+    {221, 6, 1, 0, 0},
+    {227, 6, 1, 0, 0},
+    {233, 2, 1, 5, 1611},
+    {235, 6, 1, 0, 0},
+    {241, 15, 1, 0, 0},
+    {256, 14, 1, 0, 0},
+    {270, 4, 1, 0, 0},
+    {274, 5, 1, 0, 0},
+    {279, 5, 1, 0, 0},
+    {284, 9, 1, 0, 0},
+    {293, 9, 1, 0, 0},
+    {302, 7, 1, 0, 0},
+    {309, 6, 1, 0, 0},
+    {315, 3, 1, 0, 0},
+    {318, 2, 1, 6, 1616},
+    {320, 3, 1, 0, 0},
+    {323, 10, 1, 0, 0},
+    {333, 3, 1, 0, 0},
+    {336, 5, 1, 0, 0},
+    {341, 2, 1, 0, 0},
+    {343, 9, 1, 0, 0},
+    {352, 2, 1, 14, 1622},
+    {354, 4, 1, 0, 0},
+    {358, 6, 1, 0, 0},
+    {364, 5, 1, 0, 0},
+    {369, 4, 1, 0, 0},
+    {373, 4, 1, 6, 1636},
+    {377, 3, 1, 0, 0},
+    {380, 4, 1, 0, 0},
+    {384, 2, 1, 1, 1642},
+    {386, 4, 1, 0, 0},
+    {390, 4, 1, 0, 0},
+    {394, 10, 1, 0, 0},
+    {404, 2, 1, 4, 1643},
+    {406, 7, 1, 0, 0},
+    {413, 8, 1, 0, 0},
+    {421, 2, 1, 18, 1647},
+    {423, 7, 1, 0, 0},
+    {430, 4, 1, 0, 0},
+    {434, 7, 1, 0, 0},
+    {441, 5, 1, 0, 0},
+    {446, 7, 1, 0, 0},
+    {453, 6, 1, 0, 0},
+    {459, 4, 1, 0, 0},
+    {463, 5, 1, 0, 0},
+    {468, 7, 1, 0, 0},
+    {475, 2, 1, 1, 1665},
+    {477, 3, 1, 0, 0},
+    {480, 2, 1, 0, 0},
+    {482, 3, 1, 0, 0},
+    {485, 2, 1, 12, 1666},
+    {487, 5, 1, 0, 0},
+    {492, 2, 1, 6, 1678},
+    {494, 4, 1, 0, 0},
+    {498, 5, 1, 0, 0},
+    {503, 7, 1, 0, 0},
+    {510, 14, 1, 0, 0},
+    {524, 4, 1, 0, 0},
+    {528, 4, 1, 0, 0},
+    {532, 3, 1, 0, 0},
+    {535, 9, 1, 0, 0},
+    {544, 11, 1, 0, 0},
+    {555, 8, 1, 0, 0},
+    {563, 8, 1, 0, 0},
+    {571, 8, 1, 0, 0},
+    {579, 8, 1, 0, 0},
+    {587, 10, 1, 0, 0},
+    {597, 7, 1, 0, 0},
+    {604, 6, 1, 0, 0},
+    {610, 2, 1, 10, 1684},
+    {612, 3, 1, 0, 0},
+    {615, 3, 1, 0, 0},
+    {618, 4, 1, 0, 0},
+    {622, 3, 1, 0, 0},
+    {625, 3, 1, 0, 0},
+    {628, 2, 2, 0, 0},
+    {630, 2, 1, 1, 1694},
+    {632, 5, 1, 0, 0},
+    {637, 6, 1, 0, 0},
+    {643, 4, 1, 0, 0},
+    {647, 7, 1, 0, 0},
+    {654, 6, 1, 0, 0},
+    {660, 4, 1, 0, 0},
+    {664, 7, 1, 0, 0},
+    {671, 3, 1, 0, 0},
+    {674, 2, 1, 1, 1695},
+    {676, 2, 1, 36, 1696},
+    {678, 2, 1, 5, 1732},
+    {680, 6, 1, 0, 0},
+    {686, 2, 1, 5, 1737},
+    {688, 5, 1, 0, 0},
+    {693, 3, 1, 0, 0},
+    {696, 4, 1, 0, 0},
+    {700, 4, 1, 0, 0},
+    {704, 5, 1, 0, 0},
+    {709, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {715, 2, 1, 20, 1742},
+    {717, 5, 1, 0, 0},
+    {722, 11, 1, 0, 0},
+    {733, 11, 1, 0, 0},
+    {744, 4, 1, 0, 0},
+    {748, 9, 1, 0, 0},
+    {757, 4, 1, 0, 0},
+    {761, 2, 1, 5, 1762},
+    {763, 3, 1, 0, 0},
+    {766, 3, 1, 0, 0},
+    {769, 2, 1, 5, 1767},
+    {771, 10, 1, 0, 0},
+    {781, 2, 1, 41, 1772},
+    {783, 5, 1, 0, 0},
+    {788, 10, 1, 0, 0},
+    {798, 4, 1, 0, 0},
+    {802, 3, 1, 0, 0},
+    {805, 4, 1, 0, 0},
+    {809, 3, 1, 0, 0},
+    {812, 4, 1, 0, 0},
+    {816, 7, 1, 0, 0},
+    {823, 5, 1, 0, 0},
+    {828, 6, 1, 0, 0},
+    {834, 6, 1, 0, 0},
+    {840, 3, 1, 0, 0},
+    {843, 8, 1, 0, 0},
+    {851, 3, 1, 0, 0},
+    {854, 2, 1, 141, 1813},
+    {856, 8, 1, 0, 0},
+    {864, 11, 1, 0, 0},
+    {875, 8, 1, 0, 0},
+    {883, 6, 1, 0, 0},
+    {889, 7, 1, 0, 0},
+    {896, 8, 1, 0, 0},
+    {904, 2, 1, 5, 1954},
+    {906, 2, 1, 5, 1959},
+    {908, 5, 1, 0, 0},
+    {913, 8, 1, 0, 0},
+    {921, 8, 1, 0, 0},
+    {929, 3, 1, 0, 0},
+    {932, 4, 1, 0, 0},
+    {936, 2, 1, 0, 0},
+    {938, 2, 1, 2, 1964},
+    {940, 2, 1, 4, 1966},
+    {942, 2, 1, 5, 1970},
+    {944, 3, 1, 0, 0},
+    {947, 2, 1, 15, 1975},
+    {949, 3, 1, 0, 0},
+    {952, 4, 1, 0, 0},
+    {956, 3, 1, 0, 0},
+    {959, 4, 1, 0, 0},
+    {963, 11, 1, 0, 0},
+    {974, 3, 1, 0, 0},
+    {977, 6, 1, 0, 0},
+    {983, 4, 1, 0, 0},
+    {987, 5, 1, 0, 0},
+    {992, 8, 1, 0, 0},
+    {1000, 7, 1, 0, 0},
+    {1007, 10, 1, 0, 0},
+    {1017, 3, 1, 0, 0},
+    {1020, 7, 1, 0, 0},
+    {1027, 5, 1, 0, 0},
+    {1032, 4, 1, 0, 0},
+    {1036, 6, 1, 0, 0},
+    {1042, 7, 1, 0, 0},
+    {1049, 4, 1, 0, 0},
+    {1053, 4, 1, 0, 0},
+    {1057, 4, 1, 0, 0},
+    {1061, 4, 1, 0, 0},
+    {1065, 6, 1, 0, 0},
+    {1071, 3, 1, 0, 0},
+    {1074, 8, 1, 0, 0},
+    {1082, 8, 1, 0, 0},
+    {1090, 3, 1, 0, 0},
+    {1093, 3, 1, 0, 0},
+    {1096, 4, 1, 0, 0},
+    {1100, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {1105, 2, 1, 1, 1990},
+    {1107, 6, 1, 0, 0},
+    {1113, 3, 1, 0, 0},
+    {1116, 4, 1, 0, 0},
+    {1120, 2, 1, 0, 0},
+    {1122, 3, 1, 0, 0},
+    {1125, 3, 1, 0, 0},
+    {1128, 2, 1, 0, 0},
+    {1130, 2, 1, 0, 0},
+    {1132, 6, 1, 0, 0},
+    {1138, 7, 1, 0, 0},
+    {1145, 7, 1, 0, 0},
+    {1152, 5, 1, 0, 0},
+    {1157, 4, 1, 0, 0},
+    {1161, 5, 1, 0, 0},
+    {1166, 7, 1, 0, 0},
+    {1173, 9, 1, 0, 0},
+    {1182, 6, 1, 0, 0},
+    {1188, 6, 1, 0, 0},
+    {1194, 2, 1, 15, 1991},
+    {1196, 8, 1, 0, 0},
+    {1204, 6, 1, 0, 0},
+    {1210, 5, 1, 0, 0},
+    {1215, 7, 1, 0, 0},
+    {1222, 4, 1, 0, 0},
+    {1226, 5, 1, 0, 0},
+    {1231, 4, 1, 0, 0},
+    {1235, 8, 1, 0, 0},
+    {1243, 2, 2, 1, 2006},
+    {1245, 2, 1, 4, 2007},
+    {1247, 6, 1, 0, 0},
+    {1253, 8, 1, 0, 0},
+    {1261, 5, 1, 0, 0},
+    {1266, 6, 1, 0, 0},
+    {1272, 8, 1, 0, 0},
+    {1280, 8, 1, 0, 0},
+    {1288, 5, 1, 0, 0},
+    {1293, 4, 1, 0, 0},
+    {1297, 7, 1, 0, 0},
+    {1304, 2, 1, 4, 2011},
+    {1306, 2, 1, 44, 2015},
+    {1308, 2, 1, 13, 2059},
+    {1310, 5, 1, 0, 0},
+    {1315, 5, 1, 0, 0},
+    {1320, 6, 1, 0, 0},
+    {1326, 7, 1, 0, 0},
+    {1333, 7, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1343, 7, 1, 0, 0},
+    {1350, 8, 1, 0, 0},
+    {1358, 9, 1, 0, 0},
+    {1367, 7, 1, 0, 0},
+    {1374, 7, 1, 0, 0},
+    {1381, 8, 1, 0, 0},
+    {1389, 6, 1, 0, 0},
+    {1395, 6, 1, 0, 0},
+    {1401, 12, 1, 0, 0},
+    {1413, 10, 1, 0, 0},
+    {1423, 7, 1, 0, 0},
+    {1430, 11, 1, 0, 0},
+    {1441, 7, 1, 0, 0},
+    {1448, 14, 1, 0, 0},
+    {1462, 4, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1470, 7, 1, 0, 0},
+    {1477, 7, 1, 0, 0},
+    {1484, 6, 1, 0, 0},
+    {1490, 7, 1, 0, 0},
+    {1497, 7, 1, 0, 0},
+    {1504, 3, 1, 0, 0},
+    {1507, 2, 1, 7, 2072},
+    {1509, 6, 1, 0, 0},
+    {1515, 10, 1, 0, 0},
+    {1525, 11, 1, 0, 0},
+    {1536, 7, 1, 0, 0},
+    {1543, 5, 1, 0, 0},
+    {1548, 3, 1, 0, 0},
+    {1551, 6, 1, 0, 0},
+    {1557, 7, 1, 0, 0},
+    {1564, 2, 1, 6, 2079},
+    {1566, 10, 1, 0, 0},
+    {1576, 2, 1, 5, 2085},
+    {1578, 2, 1, 4, 2090},
+    {1580, 2, 1, 1, 2094},
+    {1582, 2, 1, 12, 2095},
+    {1584, 5, 1, 0, 0},
+    {1589, 4, 1, 0, 0},
+    {1593, 2, 1, 0, 0},
+    {1595, 5, 1, 0, 0},
+    {1600, 3, 1, 0, 0},
+    {1603, 5, 1, 0, 0},
+    {1608, 4, 1, 0, 0},
+    {1612, 4, 1, 0, 0},
+    {1616, 6, 1, 0, 0},
+    {1622, 6, 1, 0, 0},
+    {1628, 3, 1, 0, 0},
+    {1631, 4, 1, 0, 0},
+    {1635, 3, 1, 0, 0},
+    {1638, 2, 1, 0, 0},
+    {1640, 4, 1, 0, 0},
+    {1644, 6, 1, 0, 0},
+    {1650, 5, 1, 0, 0},
+    {1655, 6, 1, 0, 0},
+    {1661, 8, 1, 0, 0},
+    {1669, 4, 1, 0, 0},
+    {1673, 8, 1, 0, 0},
+    {1681, 5, 1, 0, 0},
+    {1686, 8, 1, 0, 0},
+    {1694, 6, 1, 0, 0},
+    {1700, 7, 1, 0, 0},
+    {1707, 4, 1, 0, 0},
+    {1711, 6, 1, 0, 0},
+    {1717, 3, 1, 0, 0},
+    {1720, 3, 1, 0, 0},
+    {1723, 8, 1, 0, 0},
+    {1731, 4, 1, 0, 0},
+    {1735, 7, 1, 0, 0},
+    {1742, 6, 1, 0, 0},
+    {1748, 9, 1, 0, 0},
+    {1757, 8, 1, 0, 0},
+    {1765, 8, 1, 0, 0},
+    {1773, 4, 1, 0, 0},
+    {1777, 3, 1, 0, 0},
+    {1780, 2, 1, 0, 0},
+    {1782, 2, 1, 0, 0},
+    {1784, 2, 1, 5, 2107},
+    {1786, 3, 1, 0, 0},
+    {1789, 2, 1, 10, 2112},
+    {1791, 4, 1, 0, 0},
+    {1795, 6, 1, 0, 0},
+    {1801, 3, 1, 0, 0},
+    {1804, 7, 1, 0, 0},
+    {1811, 3, 1, 0, 0},
+    {1814, 8, 1, 0, 0},
+    {1822, 5, 1, 0, 0},
+    {1827, 3, 1, 0, 0},
+    {1830, 5, 1, 0, 0},
+    {1835, 6, 1, 0, 0},
+    {1841, 6, 1, 0, 0},
+    {1847, 6, 1, 0, 0},
+    {1853, 4, 1, 0, 0},
+    {1857, 3, 1, 0, 0},
+    {1860, 2, 1, 10, 2122},
+    {1862, 5, 1, 0, 0},
+    {1867, 3, 1, 0, 0},
+    {1870, 2, 1, 12, 2132},
+    {1872, 3, 1, 0, 0},
+    {1875, 5, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {1883, 9, 1, 0, 0},
+    {1892, 2, 1, 10, 2144},
+    {1894, 2, 1, 9, 2154},
+    {1896, 5, 1, 0, 0},
+    {1901, 6, 1, 0, 0},
+    {1907, 6, 1, 0, 0},
+    {1913, 8, 1, 0, 0},
+    {1921, 11, 1, 0, 0},
+    {1932, 11, 1, 0, 0},
+    {1943, 5, 1, 0, 0},
+    {1948, 9, 1, 0, 0},
+    {1957, 2, 2, 0, 0},
+    {1959, 8, 1, 0, 0},
+    {1967, 4, 1, 0, 0},
+    {1971, 2, 1, 5, 2163},
+    {1973, 3, 1, 0, 0},
+    {1976, 6, 1, 0, 0},
+    {1982, 2, 1, 8, 2168},
+    {1984, 8, 1, 0, 0},
+    {1992, 2, 1, 0, 0},
+    {1994, 10, 1, 0, 0},
+    {2004, 3, 1, 0, 0},
+    {2007, 6, 1, 0, 0},
+    {2013, 8, 1, 0, 0},
+    {2021, 6, 1, 0, 0},
+    {2027, 7, 1, 0, 0},
+    {2034, 7, 1, 0, 0},
+    {2041, 10, 1, 0, 0},
+    {2051, 4, 1, 0, 0},
+    {2055, 4, 1, 0, 0},
+    {2059, 9, 1, 0, 0},
+    {2068, 5, 1, 0, 0},
+    {2073, 6, 1, 0, 0},
+    {2079, 3, 1, 0, 0},
+    {2082, 4, 1, 0, 0},
+    {2086, 4, 1, 0, 0},
+    {2090, 7, 1, 0, 0},
+    {2097, 7, 1, 0, 0},
+    {2104, 4, 1, 0, 0},
+    {2108, 5, 1, 0, 0},
+    {2113, 8, 1, 0, 0},
+    {2121, 7, 1, 0, 0},
+    {2128, 7, 1, 0, 0},
+    {2135, 2, 1, 1, 2176},
+    {2137, 4, 1, 0, 0},
+    {2141, 8, 1, 0, 0},
+    {2149, 4, 1, 0, 0},
+    {2153, 4, 1, 0, 0},
+    {2157, 5, 1, 0, 0},
+    {2162, 7, 1, 0, 0},
+    {2169, 9, 1, 0, 0},
+    {2178, 4, 1, 0, 0},
+    {2182, 9, 1, 0, 0},
+    {2191, 8, 1, 0, 0},
+    {2199, 4, 1, 0, 0},
+    {2203, 7, 1, 0, 0},
+    {2210, 3, 1, 0, 0},
+    {2213, 7, 1, 0, 0},
+    {2220, 2, 1, 10, 2177},
+    {2222, 2, 2, 0, 0},
+    {2224, 6, 1, 0, 0},
+    {2230, 7, 1, 0, 0},
+    {2237, 4, 1, 0, 0},
+    {2241, 7, 1, 0, 0},
+    {2248, 7, 1, 0, 0},
+    {2255, 3, 1, 0, 0},
+    {2258, 2, 1, 4, 2187},
+    {2260, 2, 1, 0, 0},
+    {2262, 3, 1, 0, 0},
+    {2265, 4, 1, 0, 0},
+    {2269, 11, 1, 0, 0},
+    {2280, 8, 1, 0, 0},
+    {2288, 4, 1, 0, 0},
+    {2292, 5, 1, 0, 0},
+    {2297, 7, 1, 0, 0},
+    {2304, 5, 1, 0, 0},
+    {2309, 10, 1, 0, 0},
+    {2319, 3, 1, 0, 0},
+    {2322, 2, 1, 21, 2191},
+    {2324, 4, 1, 0, 0},
+    {2328, 9, 1, 0, 0},
+    {2337, 3, 1, 0, 0},
+    {2340, 7, 1, 0, 0},
+    {2347, 9, 1, 0, 0},
+    {2356, 8, 1, 0, 0},
+    {2364, 3, 1, 0, 0},
+    {2367, 7, 1, 0, 0},
+    {2374, 3, 1, 0, 0},
+    {2377, 4, 1, 0, 0},
+    {2381, 9, 1, 0, 0},
+    {2390, 6, 1, 0, 0},
+    {2396, 3, 1, 0, 0},
+    {2399, 2, 1, 0, 0},
+    {2401, 3, 1, 0, 0},
+    {2404, 7, 1, 0, 0},
+    {2411, 5, 1, 0, 0},
+    {2416, 6, 1, 0, 0},
+    {2422, 4, 1, 0, 0},
+    {2426, 5, 1, 0, 0},
+    {2431, 3, 1, 0, 0},
+    {2434, 6, 1, 0, 0},
+    {2440, 3, 1, 0, 0},
+    {2443, 2, 1, 0, 0},
+    {2445, 4, 1, 0, 0},
+    {2449, 2, 1, 2, 2212},
+    {2451, 3, 1, 0, 0},
+    {2454, 2, 1, 7, 2214},
+    {2456, 3, 1, 0, 0},
+    {2459, 4, 1, 0, 0},
+    {2463, 7, 1, 0, 0},
+    {2470, 6, 1, 0, 0},
+    {2476, 2, 1, 0, 0},
+    {2478, 2, 1, 3, 2221},
+    {2480, 4, 1, 0, 0},
+    {2484, 2, 1, 5, 2224},
+    {2486, 2, 1, 6, 2229},
+    {2488, 4, 1, 0, 0},
+    {2492, 5, 1, 0, 0},
+    {2497, 5, 1, 0, 0},
+    {2502, 6, 1, 0, 0},
+    {2508, 2, 1, 5, 2235},
+    {2510, 5, 1, 0, 0},
+    {2515, 3, 1, 0, 0},
+    {2518, 6, 1, 0, 0},
+    {2524, 5, 1, 0, 0},
+    {2529, 2, 1, 0, 0},
+    {2531, 5, 1, 0, 0},
+    {2536, 4, 1, 0, 0},
+    {2540, 3, 1, 0, 0},
+    {2543, 3, 1, 0, 0},
+    {2546, 2, 1, 6, 2240},
+    {2548, 7, 1, 0, 0},
+    {2555, 4, 1, 0, 0},
+    {2559, 9, 1, 0, 0},
+    {2568, 4, 1, 0, 0},
+    {2572, 3, 1, 0, 0},
+    {2575, 8, 1, 0, 0},
+    {2583, 4, 1, 0, 0},
+    {2587, 6, 1, 0, 0},
+    {2593, 3, 1, 0, 0},
+    {2596, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2602, 2, 1, 6, 2246},
+    {2604, 2, 1, 0, 0},
+    {2606, 2, 1, 5, 2252},
+    {2608, 8, 1, 0, 0},
+    {2616, 8, 1, 0, 0},
+    {2624, 6, 1, 0, 0},
+    {2630, 5, 1, 0, 0},
+    {2635, 5, 1, 0, 0},
+    {2640, 7, 1, 0, 0},
+    {2647, 5, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2654, 2, 1, 7, 2257},
+    {2656, 2, 1, 8, 2264},
+    {2658, 8, 1, 0, 0},
+    {2666, 5, 1, 0, 0},
+    {2671, 4, 1, 0, 0},
+    {2675, 5, 1, 0, 0},
+    {2680, 7, 1, 0, 0},
+    {2687, 4, 1, 0, 0},
+    {2691, 2, 1, 0, 0},
+    {2693, 2, 1, 6, 2272},
+    {2695, 4, 1, 0, 0},
+    {2699, 7, 1, 0, 0},
+    {2706, 7, 1, 0, 0},
+    {2713, 4, 1, 0, 0},
+    {2717, 3, 1, 0, 0},
+    {2720, 4, 1, 0, 0},
+    {2724, 8, 1, 0, 0},
+    {2732, 6, 1, 0, 0},
+    {2738, 10, 1, 0, 0},
+    {2748, 4, 1, 0, 0},
+    {2752, 8, 1, 0, 0},
+    {2760, 4, 1, 0, 0},
+    {2764, 6, 1, 0, 0},
+    {2770, 4, 1, 0, 0},
+    {2774, 6, 1, 0, 0},
+    {2780, 9, 1, 0, 0},
+    {2789, 7, 1, 0, 0},
+    {2796, 3, 1, 0, 0},
+    {2799, 2, 1, 21, 2278},
+    {2801, 3, 1, 0, 0},
+    {2804, 2, 1, 0, 0},
+    {2806, 2, 1, 6, 2299},
+    {2808, 6, 1, 0, 0},
+    {2814, 8, 1, 0, 0},
+    {2822, 7, 1, 0, 0},
+    {2829, 9, 1, 0, 0},
+    {2838, 9, 1, 0, 0},
+    {2847, 5, 1, 0, 0},
+    {2852, 9, 1, 0, 0},
+    {2861, 5, 1, 0, 0},
+    {2866, 5, 1, 0, 0},
+    {2871, 8, 1, 0, 0},
+    {2879, 4, 1, 0, 0},
+    {2883, 7, 1, 0, 0},
+    {2890, 3, 1, 0, 0},
+    {2893, 7, 1, 0, 0},
+    {2900, 6, 1, 0, 0},
+    {2906, 7, 1, 0, 0},
+    {2913, 5, 1, 0, 0},
+    {2918, 3, 1, 0, 0},
+    {2921, 2, 1, 4, 2305},
+    {2923, 4, 1, 0, 0},
+    {2927, 2, 1, 17, 2309},
+    {2929, 2, 1, 31, 2326},
+    {2931, 6, 1, 0, 0},
+    {2937, 5, 1, 0, 0},
+    {2942, 7, 1, 0, 0},
+    {2949, 3, 1, 0, 0},
+    {2952, 4, 1, 0, 0},
+    {2956, 3, 1, 0, 0},
+    {2959, 3, 1, 0, 0},
+    {2962, 2, 1, 12, 2357},
+    {2964, 2, 1, 1, 2369},
+    {2966, 4, 1, 0, 0},
+    {2970, 3, 1, 0, 0},
+    {2973, 5, 1, 0, 0},
+    {2978, 2, 1, 8, 2370},
+    {2980, 2, 1, 7, 2378},
+    {2982, 6, 1, 0, 0},
+    {2988, 4, 1, 0, 0},
+    {2992, 4, 1, 0, 0},
+    {2996, 10, 1, 0, 0},
+    {3006, 2, 1, 41, 2385},
+    {3008, 3, 1, 0, 0},
+    {3011, 10, 1, 0, 0},
+    {3021, 8, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3033, 3, 1, 0, 0},
+    {3036, 3, 1, 0, 0},
+    {3039, 9, 1, 0, 0},
+    {3048, 9, 1, 0, 0},
+    {3057, 6, 1, 0, 0},
+    {3063, 3, 1, 1, 2426},
+    {3066, 13, 1, 0, 0},
+    {3079, 6, 1, 0, 0},
+    {3085, 11, 1, 0, 0},
+    {3096, 2, 1, 1, 2427},
+    {3098, 8, 1, 0, 0},
+    {3106, 2, 1, 6, 2428},
+    {3108, 2, 1, 9, 2434},
+    {3110, 5, 1, 0, 0},
+    {3115, 2, 1, 6, 2443},
+    {3117, 7, 1, 0, 0},
+    {3124, 3, 1, 0, 0},
+    {3127, 8, 1, 0, 0},
+    {3135, 2, 1, 406, 2449},
+    {3137, 4, 1, 0, 0},
+    {3141, 3, 1, 0, 0},
+    {3144, 6, 1, 0, 0},
+    {3150, 4, 1, 0, 0},
+    {3154, 3, 1, 0, 0},
+    {3157, 2, 1, 3, 2855},
+    {3159, 4, 1, 0, 0},
+    {3163, 5, 1, 0, 0},
+    {3168, 7, 1, 0, 0},
+    {3175, 3, 1, 0, 0},
+    {3178, 3, 1, 0, 0},
+    {3181, 2, 2, 0, 0},
+    {3183, 3, 1, 0, 0},
+    {3186, 3, 1, 0, 0},
+    {3189, 2, 1, 8, 2858},
+    {3191, 4, 1, 0, 0},
+    {3195, 6, 1, 0, 0},
+    {3201, 3, 1, 0, 0},
+    {3204, 3, 1, 0, 0},
+    {3207, 2, 1, 110, 2866},
+    {3209, 8, 1, 0, 0},
+    {3217, 4, 1, 0, 0},
+    {3221, 6, 1, 0, 0},
+    {3227, 7, 1, 0, 0},
+    {3234, 6, 1, 0, 0},
+    {3240, 4, 1, 0, 0},
+    {3244, 2, 1, 9, 2976},
+    {3246, 11, 1, 0, 0},
+    {3257, 14, 1, 0, 0},
+    {3271, 15, 1, 0, 0},
+    {3286, 3, 1, 0, 0},
+    {3289, 2, 1, 6, 2985},
+    {3291, 2, 2, 0, 0},
+    {3293, 2, 1, 7, 2991},
+    {3295, 3, 1, 0, 0},
+    {3298, 4, 1, 0, 0},
+    {3302, 3, 1, 0, 0},
+    {3305, 6, 1, 0, 0},
+    {3311, 6, 1, 0, 0},
+    {3317, 7, 1, 0, 0},
+    {3324, 4, 1, 0, 0},
+    {3328, 2, 1, 17, 2998},
+    {3330, 2, 1, 4, 3015},
+    {3332, 5, 1, 0, 0},
+    {3337, 7, 1, 0, 0},
+    {3344, 6, 1, 0, 0},
+    {3350, 2, 1, 6, 3019},
+    {3352, 4, 1, 0, 0},
+    {3356, 3, 1, 0, 0},
+    {3359, 2, 1, 29, 3025},
+    {3361, 3, 1, 0, 0},
+    {3364, 4, 1, 0, 0},
+    {3368, 9, 1, 0, 0},
+    {3377, 2, 1, 7, 3054},
+    {3379, 2, 1, 4, 3061},
+    {3381, 5, 1, 0, 0},
+    {3386, 2, 1, 6, 3065},
+    {3388, 2, 1, 8, 3071},
+    {3390, 7, 1, 0, 0},
+    {3397, 11, 1, 0, 0},
+    {3408, 5, 1, 0, 0},
+    {3413, 9, 1, 0, 0},
+    {3422, 6, 1, 0, 0},
+    {3428, 4, 1, 0, 0},
+    {3432, 9, 1, 0, 0},
+    {3441, 7, 1, 0, 0},
+    {3448, 7, 1, 0, 0},
+    {3455, 3, 1, 0, 0},
+    {3458, 6, 1, 0, 0},
+    {3464, 7, 1, 0, 0},
+    {3471, 3, 1, 0, 0},
+    {3474, 6, 1, 0, 0},
+    {3480, 2, 1, 5, 3079},
+    {3482, 2, 1, 6, 3084},
+    {3484, 3, 1, 0, 0},
+    {3487, 5, 1, 0, 0},
+    {3492, 7, 1, 0, 0},
+    {3499, 6, 1, 0, 0},
+    {3505, 5, 1, 0, 0},
+    {3510, 4, 1, 0, 0},
+    {3514, 5, 1, 0, 0},
+    {3519, 4, 1, 0, 0},
+    {3523, 2, 1, 0, 0},
+    {3525, 4, 1, 0, 0},
+    {3529, 4, 1, 0, 0},
+    {3533, 13, 1, 0, 0},
+    {3546, 9, 1, 0, 0},
+    {3555, 8, 1, 0, 0},
+    {3563, 4, 1, 0, 0},
+    {3567, 5, 1, 0, 0},
+    {3572, 7, 1, 0, 0},
+    {3579, 4, 1, 0, 0},
+    {3583, 7, 1, 0, 0},
+    {3590, 5, 1, 0, 0},
+    {3595, 4, 1, 0, 0},
+    {3599, 5, 1, 0, 0},
+    {3604, 4, 1, 0, 0},
+    {3608, 6, 1, 0, 0},
+    {3614, 2, 1, 15, 3090},
+    {3616, 3, 1, 0, 0},
+    {3619, 3, 1, 0, 0},
+    {3622, 4, 1, 0, 0},
+    {3626, 5, 1, 0, 0},
+    {3631, 6, 1, 0, 0},
+    {3637, 5, 1, 0, 0},
+    {3642, 3, 1, 0, 0},
+    {3645, 6, 1, 0, 0},
+    {3651, 5, 1, 0, 0},
+    {3656, 5, 1, 0, 0},
+    {3661, 4, 1, 0, 0},
+    {3665, 3, 1, 0, 0},
+    {3668, 12, 1, 0, 0},
+    {3680, 2, 1, 5, 3105},
+    {3682, 2, 1, 9, 3110},
+    {3684, 2, 1, 1, 3119},
+    {3686, 3, 1, 0, 0},
+    {3689, 4, 1, 0, 0},
+    {3693, 2, 1, 0, 0},
+    {3695, 8, 1, 0, 0},
+    {3703, 4, 1, 0, 0},
+    {3707, 6, 1, 0, 0},
+    {3713, 2, 1, 9, 3120},
+    {3715, 2, 1, 9, 3129},
+    {3717, 2, 1, 6, 3138},
+    {3719, 5, 1, 0, 0},
+    {3724, 6, 1, 0, 0},
+    {3730, 4, 1, 0, 0},
+    {3734, 6, 1, 0, 0},
+    {3740, 6, 1, 0, 0},
+    {3746, 3, 1, 0, 0},
+    {3749, 10, 1, 0, 0},
+    {3759, 5, 1, 0, 0},
+    {3764, 3, 1, 0, 0},
+    {3767, 6, 1, 0, 0},
+    {3773, 9, 1, 0, 0},
+    {3782, 7, 1, 0, 0},
+    {3789, 8, 1, 0, 0},
+    {3797, 9, 1, 0, 0},
+    {3806, 8, 1, 0, 0},
+    {3814, 6, 1, 0, 0},
+    {3820, 3, 1, 0, 0},
+    {3823, 2, 1, 2, 3144},
+    {3825, 8, 1, 0, 0},
+    {3833, 2, 1, 0, 0},
+    {3835, 2, 1, 8, 3146},
+    {3837, 3, 1, 0, 0},
+    {3840, 5, 1, 0, 0},
+    {3845, 4, 1, 0, 0},
+    {3849, 9, 1, 0, 0},
+    {3858, 4, 1, 0, 0},
+    {3862, 8, 1, 0, 0},
+    {3870, 3, 1, 0, 0},
+    {3873, 4, 1, 0, 0},
+    {3877, 8, 1, 0, 0},
+    {3885, 2, 1, 9, 3154},
+    {3887, 2, 1, 0, 0},
+    {3889, 5, 1, 0, 0},
+    {3894, 9, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {3906, 4, 1, 0, 0},
+    {3910, 4, 1, 0, 0},
+    {3914, 3, 1, 0, 0},
+    {3917, 10, 1, 0, 0},
+    {3927, 2, 1, 7, 3163},
+    {3929, 2, 1, 7, 3170},
+    {3931, 3, 1, 0, 0},
+    {3934, 3, 1, 0, 0},
+    {3937, 2, 2, 0, 0},
+    {3939, 3, 1, 0, 0},
+    {3942, 2, 1, 3, 3177},
+    {3944, 2, 1, 5, 3180},
+    {3946, 4, 1, 0, 0},
+    {3950, 6, 1, 0, 0},
+    {3956, 4, 1, 0, 0},
+    {3960, 3, 1, 0, 0},
+    {3963, 3, 1, 0, 0},
+    {3966, 3, 1, 0, 0},
+    {3969, 6, 1, 0, 0},
+    {3975, 5, 1, 0, 0},
+    {3980, 7, 1, 0, 0},
+    {3987, 6, 1, 0, 0},
+    {3993, 8, 1, 0, 0},
+    {4001, 6, 1, 0, 0},
+    {4007, 4, 1, 0, 0},
+    {4011, 11, 1, 0, 0},
+    {4022, 3, 1, 0, 0},
+    {4025, 5, 1, 0, 0},
+    {4030, 2, 1, 0, 0},
+    {4032, 2, 1, 0, 0},
+    {4034, 2, 1, 1, 3185},
+    {4036, 2, 1, 5, 3186},
+    {4038, 3, 1, 0, 0},
+    {4041, 2, 1, 4, 3191},
+    {4043, 3, 1, 0, 0},
+    {4046, 3, 1, 0, 0},
+    {4049, 2, 1, 7, 3195},
+    {4051, 6, 1, 546, 3202},
+    {4057, 5, 1, 0, 0},
+    {4062, 6, 1, 0, 0},
+    {4068, 2, 1, 14, 3748},
+    {4070, 2, 1, 11, 3762},
+    {4072, 2, 1, 5, 3773},
+    {4074, 2, 1, 8, 3778},
+    {4076, 2, 1, 8, 3786},
+    {4078, 2, 1, 17, 3794},
+    {4080, 3, 1, 0, 0},
+    {4083, 6, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4093, 6, 1, 0, 0},
+    {4099, 4, 1, 0, 0},
+    {4103, 3, 1, 0, 0},
+    {4106, 2, 1, 2, 3811},
+    {4108, 2, 1, 0, 0},
+    {4110, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4116, 7, 1, 0, 0},
+    {4123, 7, 1, 0, 0},
+    {4130, 7, 1, 0, 0},
+    {4137, 7, 1, 0, 0},
+    {4144, 3, 1, 0, 0},
+    {4147, 4, 1, 0, 0},
+    {4151, 4, 1, 0, 0},
+    {4155, 10, 1, 0, 0},
+    {4165, 5, 1, 0, 0},
+    {4170, 2, 1, 10, 3813},
+    {4172, 3, 1, 0, 0},
+    {4175, 2, 1, 10, 3823},
+    {4177, 3, 1, 0, 0},
+    {4180, 3, 1, 0, 0},
+    {4183, 2, 1, 14, 3833},
+    {4185, 4, 1, 0, 0},
+    {4189, 4, 1, 0, 0},
+    {4193, 5, 1, 0, 0},
+    {4198, 5, 1, 0, 0},
+    {4203, 6, 1, 0, 0},
+    {4209, 6, 1, 0, 0},
+    {4215, 2, 1, 0, 0},
+    {4217, 2, 1, 724, 3847},
+    {4219, 5, 1, 0, 0},
+    {4224, 18, 1, 0, 0},
+    {4242, 6, 1, 0, 0},
+    {4248, 3, 1, 0, 0},
+    {4251, 6, 1, 0, 0},
+    {4257, 5, 1, 0, 0},
+    {4262, 2, 2, 0, 0},
+    {4264, 2, 1, 7, 4571},
+    {4266, 3, 1, 0, 0},
+    {4269, 3, 1, 0, 0},
+    {4272, 3, 1, 0, 0},
+    {4275, 2, 1, 0, 0},
+    {4277, 3, 1, 0, 0},
+    {4280, 2, 1, 16, 4578},
+    {4282, 3, 1, 0, 0},
+    {4285, 8, 1, 0, 0},
+    {4293, 6, 1, 0, 0},
+    {4299, 7, 1, 0, 0},
+    {4306, 6, 1, 0, 0},
+    {4312, 11, 1, 0, 0},
+    {4323, 7, 1, 0, 0},
+    {4330, 4, 1, 0, 0},
+    {4334, 2, 1, 9, 4594},
+    {4336, 5, 1, 0, 0},
+    {4341, 3, 1, 0, 0},
+    {4344, 3, 1, 0, 0},
+    {4347, 5, 1, 0, 0},
+    {4352, 3, 1, 0, 0},
+    {4355, 6, 1, 0, 0},
+    {4361, 3, 1, 0, 0},
+    {4364, 4, 1, 0, 0},
+    {4368, 6, 1, 0, 0},
+    {4374, 6, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4383, 7, 1, 0, 0},
+    {4390, 7, 1, 0, 0},
+    {4397, 5, 1, 0, 0},
+    {4402, 6, 1, 0, 0},
+    {4408, 3, 1, 0, 0},
+    {4411, 3, 1, 0, 0},
+    {4414, 2, 1, 11, 4603},
+    {4416, 4, 1, 0, 0},
+    {4420, 9, 1, 0, 0},
+    {4429, 5, 1, 0, 0},
+    {4434, 4, 1, 0, 0},
+    {4438, 8, 1, 0, 0},
+    {4446, 5, 1, 0, 0},
+    {4451, 5, 1, 0, 0},
+    {4456, 9, 1, 0, 0},
+    {4465, 3, 1, 0, 0},
+    {4468, 4, 1, 0, 0},
+    {4472, 2, 1, 7, 4614},
+    {4474, 3, 1, 0, 0},
+    {4477, 2, 1, 3, 4621},
+    {4479, 6, 1, 0, 0},
+    {4485, 2, 2, 0, 0},
+    {4487, 2, 1, 8, 4624},
+    {4489, 8, 1, 0, 0},
+    {4497, 3, 1, 0, 0},
+    {4500, 7, 1, 0, 0},
+    {4507, 5, 1, 0, 0},
+    {4512, 5, 1, 0, 0},
+    {4517, 11, 1, 0, 0},
+    {4528, 6, 1, 0, 0},
+    {4534, 6, 1, 0, 0},
+    {4540, 4, 1, 0, 0},
+    {4544, 6, 1, 0, 0},
+    {4550, 8, 1, 0, 0},
+    {4558, 3, 1, 0, 0},
+    {4561, 3, 1, 0, 0},
+    {4564, 4, 1, 0, 0},
+    {4568, 4, 1, 0, 0},
+    {4572, 7, 1, 0, 0},
+    {4579, 5, 1, 0, 0},
+    {4584, 2, 1, 14, 4632},
+    {4586, 2, 1, 153, 4646},
+    {4588, 5, 1, 0, 0},
+    {4593, 4, 1, 0, 0},
+    {4597, 11, 1, 0, 0},
+    {4608, 8, 1, 0, 0},
+    {4616, 4, 1, 0, 0},
+    {4620, 2, 1, 0, 0},
+    {4622, 2, 1, 5, 4799},
+    {4624, 3, 1, 0, 0},
+    {4627, 4, 1, 0, 0},
+    {4631, 5, 1, 0, 0},
+    {4636, 7, 1, 0, 0},
+    {4643, 4, 1, 0, 0},
+    {4647, 4, 1, 0, 0},
+    {4651, 2, 1, 13, 4804},
+    {4653, 9, 1, 0, 0},
+    {4662, 5, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {4672, 5, 1, 0, 0},
+    {4677, 3, 1, 11, 4817},
+    {4680, 4, 1, 0, 0},
+    {4684, 11, 1, 0, 0},
+    {4695, 4, 1, 0, 0},
+    {4699, 11, 1, 0, 0},
+    {4710, 5, 1, 0, 0},
+    {4715, 10, 1, 0, 0},
+    {4725, 8, 1, 0, 0},
+    {4733, 10, 1, 0, 0},
+    {4743, 3, 1, 0, 0},
+    {4746, 10, 1, 0, 0},
+    {4756, 2, 1, 7, 4828},
+    {4758, 2, 1, 8, 4835},
+    {4760, 3, 1, 0, 0},
+    {4763, 2, 1, 6, 4843},
+    {4765, 3, 1, 0, 0},
+    {4768, 2, 1, 7, 4849},
+    {4770, 2, 1, 8, 4856},
+    {4772, 4, 1, 0, 0},
+    {4776, 6, 1, 0, 0},
+    {4782, 5, 1, 0, 0},
+    {4787, 6, 1, 0, 0},
+    {4793, 5, 1, 0, 0},
+    {4798, 2, 1, 3, 4864},
+    {4800, 4, 1, 0, 0},
+    {4804, 10, 1, 0, 0},
+    {4814, 7, 1, 0, 0},
+    {4821, 6, 1, 0, 0},
+    {4827, 7, 1, 0, 0},
+    {4834, 3, 1, 0, 0},
+    {4837, 8, 1, 0, 0},
+    {4845, 11, 1, 0, 0},
+    {4856, 5, 1, 0, 0},
+    {4861, 5, 1, 0, 0},
+    {4866, 6, 1, 0, 0},
+    {4872, 4, 1, 0, 0},
+    {4876, 8, 1, 0, 0},
+    {4884, 3, 1, 0, 0},
+    {4887, 4, 1, 0, 0},
+    {4891, 7, 1, 0, 0},
+    {4898, 6, 1, 0, 0},
+    {4904, 6, 1, 0, 0},
+    {4910, 10, 1, 0, 0},
+    {4920, 4, 1, 0, 0},
+    {4924, 10, 1, 0, 0},
+    {4934, 6, 1, 0, 0},
+    {4940, 7, 1, 0, 0},
+    {4947, 7, 1, 0, 0},
+    {4954, 4, 1, 0, 0},
+    {4958, 9, 1, 0, 0},
+    {4967, 5, 1, 0, 0},
+    {4972, 3, 1, 0, 0},
+    {4975, 3, 1, 0, 0},
+    {4978, 3, 1, 0, 0},
+    {4981, 2, 1, 11, 4867},
+    {4983, 6, 1, 0, 0},
+    {4989, 5, 1, 0, 0},
+    {4994, 5, 1, 0, 0},
+    {4999, 6, 1, 0, 0},
+    {5005, 4, 1, 0, 0},
+    {5009, 2, 1, 6, 4878},
+    {5011, 4, 1, 0, 0},
+    {5015, 2, 1, 0, 0},
+    {5017, 5, 1, 0, 0},
+    {5022, 4, 1, 0, 0},
+    {5026, 3, 1, 0, 0},
+    {5029, 2, 1, 7, 4884},
+    {5031, 3, 1, 0, 0},
+    {5034, 6, 1, 0, 0},
+    {5040, 2, 1, 8, 4891},
+    {5042, 8, 1, 0, 0},
+    {5050, 4, 1, 0, 0},
+    {5054, 6, 1, 0, 0},
+    {5060, 6, 1, 0, 0},
+    {5066, 4, 1, 0, 0},
+    {5070, 5, 1, 0, 0},
+    {5075, 8, 1, 0, 0},
+    {5083, 7, 1, 0, 0},
+    {5090, 7, 1, 0, 0},
+    {5097, 15, 1, 0, 0},
+    {5112, 6, 1, 0, 0},
+    {5118, 3, 1, 0, 0},
+    {5121, 4, 1, 0, 0},
+    {5125, 3, 1, 0, 0},
+    {5128, 4, 1, 0, 0},
+    {5132, 4, 1, 0, 0},
+    {5136, 2, 1, 5, 4899},
+    {5138, 3, 1, 0, 0},
+    {5141, 3, 1, 0, 0},
+    {5144, 2, 1, 5, 4904},
+    {5146, 3, 1, 0, 0},
+    {5149, 3, 1, 0, 0},
+    {5152, 10, 1, 0, 0},
+    {5162, 7, 1, 0, 0},
+    {5169, 12, 1, 0, 0},
+    {5181, 6, 1, 0, 0},
+    {5187, 6, 1, 0, 0},
+    {5193, 7, 1, 0, 0},
+    {5200, 7, 1, 0, 0},
+    {5207, 4, 1, 0, 0},
+    {5211, 2, 1, 8, 4909},
+    {5213, 2, 1, 39, 4917},
+    {5215, 6, 1, 0, 0},
+    {5221, 4, 1, 0, 0},
+    {5225, 6, 1, 0, 0},
+    {5231, 8, 1, 0, 0},
+    {5239, 4, 1, 0, 0},
+    {5243, 6, 1, 0, 0},
+    {5249, 5, 1, 0, 0},
+    {5254, 8, 1, 0, 0},
+    {5262, 5, 1, 0, 0},
+    {5267, 3, 1, 0, 0},
+    {5270, 3, 1, 0, 0},
+    {5273, 4, 1, 0, 0},
+    {5277, 3, 1, 0, 0},
+    {5280, 2, 1, 6, 4956},
+    {5282, 2, 1, 5, 4962},
+    {5284, 9, 1, 0, 0},
+    {5293, 5, 1, 0, 0},
+    {5298, 4, 1, 0, 0},
+    {5302, 5, 1, 0, 0},
+    {5307, 4, 1, 0, 0},
+    {5311, 7, 1, 0, 0},
+    {5318, 5, 1, 0, 0},
+    {5323, 4, 1, 0, 0},
+    {5327, 8, 1, 0, 0},
+    {5335, 6, 1, 0, 0},
+    {5341, 4, 1, 0, 0},
+    {5345, 8, 1, 0, 0},
+    {5353, 2, 1, 0, 0},
+    {5355, 4, 1, 0, 0},
+    {5359, 4, 1, 0, 0},
+    {5363, 7, 1, 0, 0},
+    {5370, 4, 1, 0, 0},
+    {5374, 2, 1, 0, 0},
+    {5376, 2, 1, 0, 0},
+    {5378, 3, 1, 0, 0},
+    {5381, 4, 1, 0, 0},
+    {5385, 3, 1, 0, 0},
+    {5388, 5, 1, 0, 0},
+    {5393, 2, 1, 5, 4967},
+    {5395, 5, 1, 0, 0},
+    {5400, 2, 1, 0, 0},
+    {5402, 5, 1, 0, 0},
+    {5407, 5, 1, 0, 0},
+    {5412, 2, 1, 7, 4972},
+    {5414, 4, 1, 0, 0},
+    {5418, 2, 1, 6, 4979},
+    {5420, 6, 1, 0, 0},
+    {5426, 6, 1, 0, 0},
+    {5432, 8, 1, 0, 0},
+    {5440, 8, 1, 0, 0},
+    {5448, 4, 1, 0, 0},
+    {5452, 5, 1, 0, 0},
+    {5457, 9, 1, 0, 0},
+    {5466, 4, 1, 0, 0},
+    {5470, 4, 1, 0, 0},
+    {5474, 3, 1, 0, 0},
+    {5477, 3, 1, 0, 0},
+    {5480, 5, 1, 0, 0},
+    {5485, 5, 1, 0, 0},
+    {5490, 4, 1, 0, 0},
+    {5494, 2, 1, 0, 0},
+    {5496, 3, 1, 0, 0},
+    {5499, 2, 1, 8, 4985},
+    {5501, 2, 1, 11, 4993},
+    {5503, 5, 1, 0, 0},
+    {5508, 7, 1, 0, 0},
+    {5515, 4, 1, 0, 0},
+    {5519, 9, 1, 0, 0},
+    {5528, 9, 1, 0, 0},
+    {5537, 3, 1, 0, 0},
+    {5540, 8, 1, 0, 0},
+    {5548, 9, 1, 0, 0},
+    {5557, 7, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {5569, 6, 1, 0, 0},
+    {5575, 6, 1, 0, 0},
+    {5581, 5, 1, 0, 0},
+    {5586, 5, 1, 0, 0},
+    {5591, 2, 1, 0, 0},
+    {5593, 5, 1, 0, 0},
+    {5598, 8, 1, 0, 0},
+    {5606, 6, 1, 0, 0},
+    {5612, 7, 1, 0, 0},
+    {5619, 4, 1, 0, 0},
+    {5623, 7, 1, 0, 0},
+    {5630, 6, 1, 0, 0},
+    {5636, 2, 1, 5, 5004},
+    {5638, 6, 1, 0, 0},
+    {5644, 5, 1, 0, 0},
+    {5649, 2, 1, 1, 5009},
+    {5651, 2, 1, 6, 5010},
+    {5653, 6, 1, 0, 0},
+    {5659, 7, 1, 0, 0},
+    {5666, 2, 1, 3, 5016},
+    {5668, 3, 1, 0, 0},
+    {5671, 6, 1, 0, 0},
+    {5677, 4, 1, 0, 0},
+    {5681, 6, 1, 0, 0},
+    {5687, 6, 1, 0, 0},
+    {5693, 10, 1, 0, 0},
+    {5703, 5, 1, 0, 0},
+    {5708, 6, 1, 0, 0},
+    {5714, 3, 1, 0, 0},
+    {5717, 4, 1, 0, 0},
+    {5721, 2, 1, 0, 0},
+    {5723, 3, 1, 0, 0},
+    {5726, 2, 1, 0, 0},
+    {5728, 3, 1, 0, 0},
+    {5731, 4, 1, 0, 0},
+    {5735, 4, 1, 0, 0},
+    {5739, 10, 1, 0, 0},
+    {5749, 3, 1, 0, 0},
+    {5752, 7, 1, 0, 0},
+    {5759, 6, 1, 0, 0},
+    {5765, 4, 1, 0, 0},
+    {5769, 2, 1, 0, 0},
+    {5771, 2, 1, 0, 0},
+    {5773, 2, 1, 7, 5019},
+    {5775, 3, 1, 0, 0},
+    {5778, 7, 1, 0, 0},
+    {5785, 7, 1, 0, 0},
+    {5792, 4, 1, 0, 0},
+    {5796, 7, 1, 0, 0},
+    {5803, 6, 1, 0, 0},
+    {5809, 7, 1, 0, 0},
+    {5816, 4, 1, 0, 0},
+    {5820, 5, 1, 0, 0},
+    {5825, 5, 1, 0, 0},
+    {5830, 2, 1, 15, 5026},
+    {5832, 6, 1, 0, 0},
+    {5838, 3, 1, 0, 0},
+    {5841, 2, 1, 0, 0},
+    {5843, 6, 1, 0, 0},
+    {5849, 2, 1, 1, 5041},
+    {5851, 2, 1, 8, 5042},
+    {5853, 5, 1, 0, 0},
+    {5858, 2, 1, 13, 5050},
+    {5860, 2, 1, 6, 5063},
+    {5862, 5, 1, 0, 0},
+    {5867, 5, 1, 0, 0},
+    {5872, 5, 1, 0, 0},
+    {5877, 3, 1, 0, 0},
+    {5880, 5, 1, 0, 0},
+    {5885, 7, 1, 0, 0},
+    {5892, 5, 1, 0, 0},
+    {5897, 5, 1, 0, 0},
+    {5902, 4, 1, 0, 0},
+    {5906, 6, 1, 0, 0},
+    {5912, 4, 1, 0, 0},
+    {5916, 2, 1, 22, 5069},
+    {5918, 5, 1, 0, 0},
+    {5923, 7, 1, 0, 0},
+    {5930, 8, 1, 0, 0},
+    {5938, 6, 1, 0, 0},
+    {5944, 13, 1, 0, 0},
+    {5957, 9, 1, 0, 0},
+    {5966, 18, 1, 0, 0},
+    {5984, 5, 1, 0, 0},
+    {5989, 3, 1, 0, 0},
+    {5992, 2, 1, 17, 5091},
+    {5994, 4, 1, 0, 0},
+    {5998, 3, 1, 0, 0},
+    {6001, 5, 1, 0, 0},
+    {6006, 5, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {6013, 3, 1, 0, 0},
+    {6016, 2, 1, 13, 5108},
+    {6018, 2, 1, 12, 5121},
+    {6020, 2, 1, 75, 5133},
+    {6022, 5, 1, 0, 0},
+    {6027, 3, 1, 0, 0},
+    {6030, 2, 1, 8, 5208},
+    {6032, 2, 1, 11, 5216},
+    {6034, 6, 1, 0, 0},
+    {6040, 10, 1, 0, 0},
+    {6050, 3, 1, 0, 0},
+    {6053, 3, 1, 0, 0},
+    {6056, 3, 1, 0, 0},
+    {6059, 2, 1, 60, 5227},
+    {6061, 2, 1, 6, 5287},
+    {6063, 2, 1, 4, 5293},
+    {6065, 2, 1, 0, 0},
+    {6067, 9, 1, 0, 0},
+    {6076, 4, 1, 0, 0},
+    {6080, 8, 1, 0, 0},
+    {6088, 2, 1, 6, 5297},
+    {6090, 2, 1, 20, 5303},
+    {6092, 5, 1, 0, 0},
+    {6097, 8, 1, 0, 0},
+    {6105, 8, 1, 0, 0},
+    {6113, 12, 1, 0, 0},
+    {6125, 3, 1, 0, 0},
+    {6128, 2, 1, 0, 0},
+    {6130, 2, 1, 5, 5323},
+    {6132, 6, 1, 0, 0},
+    {6138, 5, 1, 0, 0},
+    {6143, 3, 1, 0, 0},
+    {6146, 6, 1, 0, 0},
+    {6152, 6, 1, 0, 0},
+    {6158, 3, 1, 0, 0},
+    {6161, 3, 1, 0, 0},
+    {6164, 6, 1, 0, 0},
+    {6170, 4, 1, 0, 0},
+    {6174, 6, 1, 0, 0},
+    {6180, 4, 1, 0, 0},
+    {6184, 4, 1, 0, 0},
+    {6188, 10, 1, 0, 0},
+    {6198, 2, 1, 12, 5328},
+    {6200, 5, 1, 0, 0},
+    {6205, 10, 1, 0, 0},
+    {6215, 5, 1, 0, 0},
+    {6220, 4, 1, 0, 0},
+    {6224, 6, 1, 0, 0},
+    {6230, 4, 1, 0, 0},
+    {6234, 6, 1, 0, 0},
+    {6240, 2, 1, 4, 5340},
+    {6242, 6, 1, 0, 0},
+    {6248, 5, 1, 0, 0},
+    {6253, 7, 1, 0, 0},
+    {6260, 6, 1, 0, 0},
+    {6266, 4, 1, 0, 0},
+    {6270, 7, 1, 0, 0},
+    {6277, 5, 1, 0, 0},
+    {6282, 7, 1, 0, 0},
+    {6289, 7, 1, 0, 0},
+    {6296, 14, 1, 0, 0},
+    {6310, 6, 1, 0, 0},
+    {6316, 5, 1, 0, 0},
+    {6321, 7, 1, 0, 0},
+    {6328, 7, 1, 0, 0},
+    {6335, 5, 1, 0, 0},
+    {6340, 4, 1, 0, 0},
+    {6344, 2, 1, 0, 0},
+    {6346, 7, 1, 0, 0},
+    {6353, 4, 1, 0, 0},
+    {6357, 4, 1, 0, 0},
+    {6361, 11, 1, 0, 0},
+    {6372, 3, 1, 0, 0},
+    {6375, 7, 1, 0, 0},
+    {6382, 4, 1, 0, 0},
+    {6386, 7, 1, 0, 0},
+    {6393, 3, 1, 0, 0},
+    {6396, 13, 1, 0, 0},
+    {6409, 8, 1, 0, 0},
+    {6417, 4, 1, 0, 0},
+    {6421, 5, 1, 0, 0},
+    {6426, 5, 1, 0, 0},
+    {6431, 3, 1, 0, 0},
+    {6434, 2, 1, 5, 5344},
+    {6436, 3, 1, 0, 0},
+    {6439, 3, 1, 0, 0},
+    {6442, 4, 1, 0, 0},
+    {6446, 5, 1, 0, 0},
+    {6451, 7, 1, 0, 0},
+    {6458, 6, 1, 0, 0},
+    {6464, 3, 1, 0, 0},
+    {6467, 11, 1, 0, 0},
+    {6478, 11, 1, 0, 0},
+    {6489, 11, 1, 0, 0},
+    {6500, 11, 1, 0, 0},
+    {6511, 10, 1, 0, 0},
+    {6521, 11, 1, 0, 0},
+    {6532, 11, 1, 0, 0},
+    {6543, 12, 1, 0, 0},
+    {6555, 11, 1, 0, 0},
+    {6566, 10, 1, 0, 0},
+    {6576, 11, 1, 0, 0},
+    {6587, 12, 1, 0, 0},
+    {6599, 11, 1, 0, 0},
+    {6610, 10, 1, 0, 0},
+    {6620, 12, 1, 4, 5349},
+    {6632, 10, 1, 0, 0},
+    {6642, 14, 1, 0, 0},
+    {6656, 11, 1, 0, 0},
+    {6667, 10, 1, 0, 0},
+    {6677, 17, 1, 0, 0},
+    {6694, 10, 1, 0, 0},
+    {6704, 11, 1, 0, 0},
+    {6715, 14, 1, 0, 0},
+    {6729, 12, 1, 0, 0},
+    {6741, 11, 1, 0, 0},
+    {6752, 14, 1, 0, 0},
+    {6766, 12, 1, 0, 0},
+    {6778, 10, 1, 0, 0},
+    {6788, 12, 1, 0, 0},
+    {6800, 10, 1, 6, 5353},
+    {6810, 8, 1, 0, 0},
+    {6818, 9, 1, 0, 0},
+    {6827, 10, 1, 0, 0},
+    {6837, 10, 1, 0, 0},
+    {6847, 11, 1, 0, 0},
+    {6858, 14, 1, 0, 0},
+    {6872, 17, 1, 0, 0},
+    {6889, 9, 1, 0, 0},
+    {6898, 10, 1, 0, 0},
+    {6908, 11, 1, 0, 0},
+    {6919, 13, 1, 0, 0},
+    {6932, 10, 1, 0, 0},
+    {6942, 22, 1, 0, 0},
+    {6964, 11, 1, 0, 0},
+    {6975, 10, 1, 0, 0},
+    {6985, 10, 1, 0, 0},
+    {6995, 11, 1, 0, 0},
+    {7006, 9, 1, 0, 0},
+    {7015, 9, 1, 0, 0},
+    {7024, 13, 1, 0, 0},
+    {7037, 11, 1, 0, 0},
+    {7048, 11, 1, 0, 0},
+    {7059, 9, 1, 0, 0},
+    {7068, 14, 1, 0, 0},
+    {7082, 10, 1, 0, 0},
+    {7092, 10, 1, 0, 0},
+    {7102, 10, 1, 0, 0},
+    {7112, 11, 1, 0, 0},
+    {7123, 11, 1, 0, 0},
+    {7134, 13, 1, 0, 0},
+    {7147, 13, 1, 0, 0},
+    {7160, 16, 1, 0, 0},
+    {7176, 11, 1, 0, 0},
+    {7187, 12, 1, 0, 0},
+    {7199, 11, 1, 0, 0},
+    {7210, 11, 1, 0, 0},
+    {7221, 14, 1, 0, 0},
+    {7235, 11, 1, 0, 0},
+    {7246, 13, 1, 0, 0},
+    {7259, 11, 1, 0, 0},
+    {7270, 15, 1, 0, 0},
+    {7285, 11, 1, 0, 0},
+    {7296, 10, 1, 0, 0},
+    {7306, 9, 1, 0, 0},
+    {7315, 9, 1, 0, 0},
+    {7324, 11, 1, 6, 5359},
+    {7335, 14, 1, 0, 0},
+    {7349, 11, 1, 0, 0},
+    {7360, 15, 1, 0, 0},
+    {7375, 11, 1, 0, 0},
+    {7386, 11, 1, 0, 0},
+    {7397, 10, 1, 0, 0},
+    {7407, 9, 1, 0, 0},
+    {7416, 15, 1, 0, 0},
+    {7431, 12, 1, 0, 0},
+    {7443, 12, 1, 0, 0},
+    {7455, 14, 1, 0, 0},
+    {7469, 15, 1, 0, 0},
+    {7484, 14, 1, 0, 0},
+    {7498, 16, 1, 0, 0},
+    {7514, 15, 1, 0, 0},
+    {7529, 14, 1, 0, 0},
+    {7543, 12, 1, 0, 0},
+    {7555, 17, 1, 0, 0},
+    {7572, 18, 1, 0, 0},
+    {7590, 17, 1, 0, 0},
+    {7607, 14, 1, 0, 0},
+    {7621, 11, 1, 0, 0},
+    {7632, 14, 1, 0, 0},
+    {7646, 15, 1, 0, 0},
+    {7661, 14, 1, 0, 0},
+    {7675, 16, 1, 0, 0},
+    {7691, 19, 1, 0, 0},
+    {7710, 17, 1, 0, 0},
+    {7727, 12, 1, 0, 0},
+    {7739, 14, 1, 0, 0},
+    {7753, 12, 1, 0, 0},
+    {7765, 19, 1, 0, 0},
+    {7784, 16, 1, 0, 0},
+    {7800, 12, 1, 0, 0},
+    {7812, 12, 1, 0, 0},
+    {7824, 11, 1, 0, 0},
+    {7835, 14, 1, 0, 0},
+    {7849, 11, 1, 0, 0},
+    {7860, 11, 1, 0, 0},
+    {7871, 12, 1, 0, 0},
+    {7883, 10, 1, 0, 0},
+    {7893, 12, 1, 0, 0},
+    {7905, 12, 1, 0, 0},
+    {7917, 9, 1, 0, 0},
+    {7926, 11, 1, 0, 0},
+    {7937, 8, 1, 0, 0},
+    {7945, 9, 1, 0, 0},
+    {7954, 15, 1, 0, 0},
+    {7969, 11, 1, 0, 0},
+    {7980, 10, 1, 6, 5365},
+    {7990, 12, 1, 0, 0},
+    {8002, 11, 1, 0, 0},
+    {8013, 9, 1, 0, 0},
+    {8022, 8, 1, 0, 0},
+    {8030, 11, 1, 0, 0},
+    {8041, 10, 1, 0, 0},
+    {8051, 10, 1, 0, 0},
+    {8061, 11, 1, 0, 0},
+    {8072, 12, 1, 0, 0},
+    {8084, 9, 1, 0, 0},
+    {8093, 8, 1, 0, 0},
+    {8101, 11, 1, 0, 0},
+    {8112, 11, 1, 0, 0},
+    {8123, 14, 1, 0, 0},
+    {8137, 11, 1, 0, 0},
+    {8148, 11, 1, 0, 0},
+    {8159, 11, 1, 0, 0},
+    {8170, 9, 1, 0, 0},
+    {8179, 13, 1, 0, 0},
+    {8192, 10, 1, 0, 0},
+    {8202, 23, 1, 0, 0},
+    {8225, 24, 1, 0, 0},
+    {8249, 9, 1, 0, 0},
+    {8258, 11, 1, 0, 0},
+    {8269, 20, 1, 0, 0},
+    {8289, 11, 1, 0, 0},
+    {8300, 10, 1, 0, 0},
+    {8310, 10, 1, 0, 0},
+    {8320, 11, 1, 0, 0},
+    {8331, 16, 1, 0, 0},
+    {8347, 17, 1, 0, 0},
+    {8364, 10, 1, 0, 0},
+    {8374, 13, 1, 0, 0},
+    {8387, 13, 1, 0, 0},
+    {8400, 11, 1, 0, 0},
+    {8411, 3, 1, 0, 0},
+    {8414, 3, 1, 0, 0},
+    {8417, 6, 1, 0, 0},
+    {8423, 5, 1, 0, 0},
+    {8428, 7, 1, 0, 0},
+    {8435, 6, 1, 0, 0},
+    {8441, 2, 1, 6, 5371},
+    {8443, 9, 1, 0, 0},
+    {8452, 4, 1, 0, 0},
+    {8456, 8, 1, 0, 0},
+    {8464, 3, 1, 0, 0},
+    {8467, 7, 1, 0, 0},
+    {8474, 2, 1, 0, 0},
+    {8476, 3, 1, 0, 0},
+    {8479, 2, 0, 18, 5377},
+    {8481, 6, 1, 0, 0},
+    {8487, 4, 1, 0, 0},
+    {8491, 4, 1, 0, 0},
+    {8495, 3, 1, 0, 0},
+    {8498, 2, 1, 11, 5395},
+    {8500, 4, 1, 0, 0},
+    {8504, 7, 1, 0, 0},
+    {8511, 2, 1, 5, 5406},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {8519, 22, 1, 0, 0},
+    {8541, 19, 1, 0, 0},
+    {8560, 9, 1, 0, 0},
+    {8569, 8, 1, 0, 0},
+    {8577, 9, 1, 0, 0},
+    {8586, 6, 1, 0, 0},
+    {8592, 16, 1, 0, 0},
+    {8608, 19, 1, 0, 0},
+    {8627, 8, 1, 0, 0},
+    {8635, 7, 1, 0, 0},
+    {8642, 7, 1, 0, 0},
+    {8649, 10, 1, 0, 0},
+    {8659, 9, 1, 0, 0},
+    {8668, 9, 1, 0, 0},
+    {8677, 11, 1, 0, 0},
+    {453, 6, 1, 0, 0},
+    {8688, 10, 1, 0, 0},
+    {883, 6, 1, 0, 0},
+    {8698, 3, 1, 0, 0},
+    {8701, 5, 1, 0, 0},
+    {1074, 8, 1, 0, 0},
+    {8706, 13, 1, 0, 0},
+    {8719, 12, 1, 0, 0},
+    {8731, 7, 1, 0, 0},
+    {8738, 13, 1, 0, 0},
+    {1293, 4, 1, 0, 0},
+    {8751, 10, 1, 0, 0},
+    {8761, 10, 1, 0, 0},
+    {1413, 10, 1, 0, 0},
+    {8771, 7, 1, 0, 0},
+    {8778, 7, 1, 0, 0},
+    {8785, 4, 1, 0, 0},
+    {1711, 6, 1, 0, 0},
+    {8789, 4, 1, 0, 0},
+    {8793, 8, 1, 0, 0},
+    {8801, 9, 1, 0, 0},
+    {8810, 6, 1, 0, 0},
+    {1913, 8, 1, 0, 0},
+    {8816, 13, 1, 0, 0},
+    {1948, 9, 1, 0, 0},
+    {2013, 8, 1, 0, 0},
+    {2034, 7, 1, 0, 0},
+    {8829, 10, 1, 0, 0},
+    {8839, 6, 1, 0, 0},
+    {8845, 4, 1, 0, 0},
+    {8849, 7, 1, 0, 0},
+    {8856, 10, 1, 0, 0},
+    {8866, 14, 1, 0, 0},
+    {2647, 5, 1, 0, 0},
+    {8880, 11, 1, 0, 0},
+    {8891, 9, 1, 0, 0},
+    {3048, 9, 1, 0, 0},
+    {8900, 7, 1, 0, 0},
+    {8907, 10, 1, 0, 0},
+    {8917, 7, 1, 0, 0},
+    {8924, 9, 1, 0, 0},
+    {8933, 8, 1, 0, 0},
+    {8941, 11, 1, 0, 0},
+    {3840, 5, 1, 0, 0},
+    {8952, 10, 1, 0, 0},
+    {8962, 9, 1, 0, 0},
+    {8971, 10, 1, 0, 0},
+    {8981, 11, 1, 0, 0},
+    {8992, 11, 1, 0, 0},
+    {9003, 21, 1, 0, 0},
+    {9024, 5, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {9029, 10, 1, 0, 0},
+    {9039, 10, 1, 0, 0},
+    {9049, 7, 1, 0, 0},
+    {9056, 3, 1, 0, 0},
+    {9059, 8, 1, 0, 0},
+    {9067, 10, 1, 0, 0},
+    {5054, 6, 1, 0, 0},
+    {9077, 9, 1, 0, 0},
+    {5254, 8, 1, 0, 0},
+    {5341, 4, 1, 0, 0},
+    {9086, 9, 1, 0, 0},
+    {5440, 8, 1, 0, 0},
+    {9095, 7, 1, 0, 0},
+    {9102, 6, 1, 0, 0},
+    {5923, 7, 1, 0, 0},
+    {9108, 7, 1, 0, 0},
+    {9115, 5, 1, 0, 0},
+    {9120, 12, 1, 0, 0},
+    {6421, 5, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9132, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9135, 7, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {9142, 2, 1, 0, 0},
+    {9144, 2, 1, 0, 0},
+    {3135, 2, 1, 0, 0},
+    {9146, 2, 1, 0, 0},
+    {9148, 2, 1, 0, 0},
+    {671, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {9153, 6, 1, 0, 0},
+    {4062, 6, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9159, 6, 1, 0, 0},
+    {9165, 3, 1, 0, 0},
+    {9168, 4, 1, 0, 0},
+    {9172, 7, 1, 0, 0},
+    {9179, 3, 1, 0, 0},
+    {9182, 4, 1, 0, 0},
+    {9186, 3, 1, 0, 0},
+    {9189, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {50, 2, 1, 1, 5411},
+    {1308, 2, 1, 0, 0},
+    {9144, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {9194, 3, 1, 0, 0},
+    {9197, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9200, 4, 1, 0, 0},
+    {1880, 3, 1, 9, 5412},
+    {2599, 3, 1, 5, 5421},
+    {2962, 2, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9204, 3, 1, 0, 0},
+    {9207, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9209, 2, 1, 0, 0},
+    {9211, 3, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {9214, 3, 1, 0, 0},
+    {9217, 3, 1, 0, 0},
+    {9220, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9222, 2, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9224, 1, 1, 0, 0},
+    {9225, 1, 1, 0, 0},
+    {9226, 1, 1, 0, 0},
+    {9227, 1, 1, 0, 0},
+    {9228, 1, 1, 0, 0},
+    {9229, 1, 1, 0, 0},
+    {9230, 1, 1, 0, 0},
+    {9231, 1, 1, 0, 0},
+    {9232, 1, 1, 0, 0},
+    {9233, 1, 1, 0, 0},
+    {9234, 1, 1, 0, 0},
+    {9235, 1, 1, 0, 0},
+    {9236, 1, 1, 0, 0},
+    {9237, 1, 1, 0, 0},
+    {9238, 1, 1, 0, 0},
+    {9239, 1, 1, 0, 0},
+    {9240, 1, 1, 0, 0},
+    {9241, 1, 1, 0, 0},
+    {9242, 1, 1, 0, 0},
+    {9243, 1, 1, 0, 0},
+    {9244, 1, 1, 0, 0},
+    {9245, 1, 1, 0, 0},
+    {9246, 1, 1, 0, 0},
+    {9247, 1, 1, 0, 0},
+    {9248, 1, 1, 0, 0},
+    {9249, 1, 1, 0, 0},
+    {9250, 1, 1, 0, 0},
+    {9251, 1, 1, 0, 0},
+    {9252, 1, 1, 0, 0},
+    {9253, 1, 1, 0, 0},
+    {9254, 1, 1, 0, 0},
+    {9255, 1, 1, 0, 0},
+    {9256, 1, 1, 0, 0},
+    {9257, 1, 1, 0, 0},
+    {9258, 1, 1, 0, 0},
+    {9259, 1, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {126, 6, 1, 0, 0},
+    {9260, 4, 1, 0, 0},
+    {9264, 11, 1, 0, 0},
+    {9275, 5, 1, 0, 0},
+    {9280, 7, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1872, 3, 1, 0, 0},
+    {9287, 5, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {9292, 7, 1, 0, 0},
+    {3975, 5, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9299, 3, 1, 0, 0},
+    {4924, 10, 1, 0, 0},
+    {9302, 5, 1, 0, 0},
+    {9307, 7, 1, 0, 0},
+    {9314, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9318, 8, 1, 0, 0},
+    {9260, 4, 1, 0, 0},
+    {380, 4, 1, 0, 0},
+    {744, 4, 1, 0, 0},
+    {9326, 7, 1, 0, 0},
+    {9333, 7, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9340, 11, 1, 0, 0},
+    {9351, 10, 1, 0, 0},
+    {9361, 7, 1, 0, 0},
+    {9368, 8, 1, 0, 0},
+    {9376, 8, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9384, 7, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {9391, 8, 1, 0, 0},
+    {9399, 9, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {9408, 8, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {9416, 10, 1, 0, 0},
+    {9153, 6, 1, 0, 0},
+    {9426, 7, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9433, 6, 1, 0, 0},
+    {9439, 8, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9447, 6, 1, 0, 0},
+    {9453, 13, 1, 0, 0},
+    {9466, 8, 1, 0, 0},
+    {9474, 11, 1, 0, 0},
+    {9485, 6, 1, 0, 0},
+    {9491, 7, 1, 0, 0},
+    {9498, 5, 1, 0, 0},
+    {9503, 10, 1, 0, 0},
+    {9513, 5, 1, 0, 0},
+    {9518, 10, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {6357, 4, 1, 0, 0},
+    {9531, 6, 1, 0, 0},
+    {28, 3, 1, 0, 0},
+    {9537, 3, 1, 0, 0},
+    {9540, 3, 1, 0, 0},
+    {9543, 3, 1, 0, 0},
+    {9546, 3, 1, 0, 0},
+    {233, 2, 1, 0, 0},
+    {9549, 5, 1, 0, 0},
+    {9554, 9, 1, 0, 0},
+    {333, 3, 1, 0, 0},
+    {9563, 3, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {9566, 3, 1, 0, 0},
+    {9235, 1, 1, 0, 0},
+    {9569, 7, 1, 0, 0},
+    {9576, 5, 1, 0, 0},
+    {9581, 3, 1, 0, 0},
+    {9584, 3, 1, 0, 0},
+    {709, 3, 1, 0, 0},
+    {744, 4, 1, 0, 0},
+    {9587, 3, 1, 0, 0},
+    {9590, 8, 1, 0, 0},
+    {9598, 3, 1, 0, 0},
+    {9601, 13, 1, 0, 0},
+    {9614, 8, 1, 0, 0},
+    {9622, 6, 1, 0, 0},
+    {9628, 3, 1, 0, 0},
+    {9631, 3, 1, 0, 0},
+    {9634, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9637, 8, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {9645, 3, 1, 0, 0},
+    {9648, 3, 1, 0, 0},
+    {9651, 6, 1, 0, 0},
+    {9657, 8, 1, 0, 0},
+    {9665, 3, 1, 0, 0},
+    {9668, 3, 1, 0, 0},
+    {9671, 3, 1, 0, 0},
+    {1717, 3, 1, 0, 0},
+    {9674, 3, 1, 0, 0},
+    {1872, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9677, 3, 1, 0, 0},
+    {9680, 3, 1, 0, 0},
+    {9683, 3, 1, 0, 0},
+    {9686, 3, 1, 0, 0},
+    {9689, 3, 1, 0, 0},
+    {9692, 3, 1, 0, 0},
+    {9695, 3, 1, 0, 0},
+    {9698, 5, 1, 0, 0},
+    {9703, 4, 1, 0, 0},
+    {9707, 7, 1, 0, 0},
+    {2258, 2, 1, 0, 0},
+    {9714, 3, 1, 0, 0},
+    {9717, 6, 1, 0, 0},
+    {9723, 3, 1, 0, 0},
+    {9726, 3, 1, 0, 0},
+    {9729, 3, 1, 0, 0},
+    {9732, 3, 1, 0, 0},
+    {9735, 3, 1, 0, 0},
+    {9738, 3, 1, 0, 0},
+    {9741, 7, 1, 0, 0},
+    {2599, 3, 1, 27, 5426},
+    {9748, 3, 1, 0, 0},
+    {9751, 3, 1, 0, 0},
+    {9754, 3, 1, 0, 0},
+    {9757, 3, 1, 0, 0},
+    {9760, 3, 1, 0, 0},
+    {9763, 5, 1, 0, 0},
+    {9768, 3, 1, 0, 0},
+    {9771, 9, 1, 0, 0},
+    {9780, 3, 1, 0, 0},
+    {9783, 3, 1, 0, 0},
+    {9786, 3, 1, 0, 0},
+    {9789, 3, 1, 0, 0},
+    {9792, 3, 1, 0, 0},
+    {9795, 8, 1, 0, 0},
+    {9803, 6, 1, 0, 0},
+    {9809, 6, 1, 0, 0},
+    {9815, 6, 1, 0, 0},
+    {9821, 7, 1, 0, 0},
+    {9828, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {9831, 6, 1, 0, 0},
+    {4030, 2, 1, 0, 0},
+    {9837, 3, 1, 0, 0},
+    {9840, 5, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9845, 7, 1, 0, 0},
+    {8513, 3, 2, 0, 0},
+    {9852, 3, 1, 0, 0},
+    {9855, 3, 1, 0, 0},
+    {9858, 3, 1, 0, 0},
+    {4344, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9861, 6, 1, 0, 0},
+    {9867, 6, 1, 0, 0},
+    {9873, 3, 1, 0, 0},
+    {9876, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {9879, 3, 1, 0, 0},
+    {9882, 3, 1, 0, 0},
+    {9885, 3, 1, 0, 0},
+    {9888, 3, 1, 0, 0},
+    {4793, 5, 1, 0, 0},
+    {9891, 3, 1, 0, 0},
+    {9894, 6, 1, 0, 0},
+    {9900, 3, 1, 0, 0},
+    {9903, 8, 1, 0, 0},
+    {4975, 3, 1, 0, 0},
+    {9911, 9, 1, 0, 0},
+    {9920, 8, 1, 0, 0},
+    {9928, 8, 1, 0, 0},
+    {9936, 5, 1, 0, 0},
+    {9941, 10, 1, 0, 0},
+    {9951, 10, 1, 0, 0},
+    {9961, 11, 1, 0, 0},
+    {9972, 8, 1, 0, 0},
+    {9980, 3, 1, 0, 0},
+    {9983, 3, 1, 0, 0},
+    {9986, 3, 1, 0, 0},
+    {9989, 3, 1, 0, 0},
+    {9992, 8, 1, 0, 0},
+    {10000, 3, 1, 0, 0},
+    {5717, 4, 1, 0, 0},
+    {5721, 2, 1, 0, 0},
+    {10003, 3, 1, 0, 0},
+    {10006, 3, 1, 0, 0},
+    {10009, 3, 1, 0, 0},
+    {10012, 3, 1, 0, 0},
+    {10015, 3, 1, 0, 0},
+    {9165, 3, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {10018, 3, 1, 0, 0},
+    {6125, 3, 1, 0, 0},
+    {10021, 3, 1, 0, 0},
+    {10024, 4, 1, 0, 0},
+    {6357, 4, 1, 0, 0},
+    {10028, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {10031, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10033, 2, 1, 0, 0},
+    {10035, 2, 1, 0, 0},
+    {10037, 2, 1, 0, 0},
+    {10039, 2, 1, 0, 0},
+    {10041, 2, 1, 0, 0},
+    {4170, 2, 1, 0, 0},
+    {4215, 2, 1, 0, 0},
+    {10043, 2, 1, 0, 0},
+    {9207, 2, 1, 0, 0},
+    {4275, 2, 1, 0, 0},
+    {10045, 2, 1, 0, 0},
+    {4472, 2, 1, 0, 0},
+    {10047, 2, 1, 0, 0},
+    {5376, 2, 1, 0, 0},
+    {10049, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9142, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3833, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10061, 6, 1, 0, 0},
+    {10067, 15, 1, 0, 0},
+    {10082, 3, 4, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {10085, 2, 1, 0, 0},
+    {715, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10087, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2220, 2, 1, 0, 0},
+    {2449, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {10089, 2, 1, 0, 0},
+    {10091, 2, 1, 0, 0},
+    {10093, 2, 1, 0, 0},
+    {10095, 2, 1, 0, 0},
+    {10097, 2, 1, 0, 0},
+    {10099, 2, 1, 0, 0},
+    {2799, 2, 1, 0, 0},
+    {10101, 2, 1, 0, 0},
+    {2806, 2, 1, 0, 0},
+    {10103, 2, 1, 0, 0},
+    {10105, 2, 1, 0, 0},
+    {10107, 2, 1, 0, 0},
+    {10109, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {3944, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {10111, 2, 1, 0, 0},
+    {10113, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10115, 2, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {5211, 2, 1, 0, 0},
+    {5282, 2, 1, 0, 0},
+    {5412, 2, 1, 0, 0},
+    {5649, 2, 1, 0, 0},
+    {5830, 2, 1, 0, 0},
+    {6016, 2, 1, 0, 0},
+    {10117, 2, 1, 0, 0},
+    {6667, 10, 1, 0, 0},
+    {7296, 10, 1, 0, 0},
+    {10119, 10, 1, 0, 0},
+    {10129, 2, 1, 0, 0},
+    {10131, 2, 1, 0, 0},
+    {10133, 2, 1, 0, 0},
+    {10135, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9891, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {9142, 2, 1, 0, 0},
+    {2135, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9757, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {10143, 4, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10147, 7, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3686, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10154, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10157, 3, 1, 0, 0},
+    {10160, 3, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10163, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {10169, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10172, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10178, 3, 1, 0, 0},
+    {10181, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10185, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10188, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10191, 5, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10196, 8, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {10204, 6, 1, 0, 0},
+    {10210, 6, 1, 0, 0},
+    {10216, 3, 1, 0, 0},
+    {10219, 9, 1, 0, 0},
+    {10228, 21, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10249, 18, 1, 0, 0},
+    {10267, 15, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {10282, 5, 1, 0, 0},
+    {10287, 16, 1, 0, 0},
+    {10303, 7, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {10310, 8, 1, 0, 0},
+    {10318, 10, 1, 0, 0},
+    {10328, 4, 1, 0, 0},
+    {10332, 3, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {10335, 11, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10346, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3686, 3, 1, 0, 0},
+    {10349, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {9754, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10352, 4, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10356, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {6667, 10, 1, 0, 0},
+    {10359, 9, 1, 0, 0},
+    {10368, 11, 1, 0, 0},
+    {10379, 10, 1, 0, 0},
+    {7296, 10, 1, 0, 0},
+    {10389, 11, 1, 0, 0},
+    {10400, 10, 1, 0, 0},
+    {7883, 10, 1, 0, 0},
+    {10119, 10, 1, 0, 0},
+    {10410, 11, 1, 0, 0},
+    {10421, 9, 1, 0, 0},
+    {10430, 10, 1, 0, 0},
+    {10440, 11, 1, 0, 0},
+    {10451, 11, 1, 0, 0},
+    {10462, 10, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10472, 4, 1, 0, 0},
+    {10476, 2, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {102, 5, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10478, 5, 1, 0, 0},
+    {10157, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {10483, 3, 1, 0, 0},
+    {5323, 4, 1, 0, 0},
+    {10486, 4, 1, 0, 0},
+    {10490, 5, 1, 0, 0},
+    {10495, 4, 1, 0, 0},
+    {1065, 6, 1, 0, 0},
+    {1231, 4, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {10499, 7, 1, 0, 0},
+    {10506, 7, 1, 0, 0},
+    {2153, 4, 1, 0, 0},
+    {2304, 5, 1, 0, 0},
+    {2426, 5, 1, 0, 0},
+    {10513, 5, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {10518, 8, 1, 0, 0},
+    {10526, 6, 1, 0, 0},
+    {10532, 8, 1, 0, 0},
+    {10540, 5, 1, 0, 0},
+    {3840, 5, 1, 0, 0},
+    {4147, 4, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10545, 4, 1, 0, 0},
+    {10549, 6, 1, 0, 0},
+    {5270, 3, 1, 0, 0},
+    {5323, 4, 1, 0, 0},
+    {5485, 5, 1, 0, 0},
+    {10555, 4, 1, 0, 0},
+    {10559, 4, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {10563, 6, 1, 0, 0},
+    {10569, 6, 1, 0, 0},
+    {6138, 5, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {10575, 4, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4074, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {10579, 6, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10585, 3, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10588, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 2, 5453},
+    {1340, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {5992, 2, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {10592, 2, 1, 0, 0},
+    {10594, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {147, 2, 1, 0, 0},
+    {233, 2, 1, 0, 0},
+    {10596, 5, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {921, 8, 1, 0, 0},
+    {947, 2, 1, 0, 0},
+    {1306, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {10601, 2, 1, 0, 0},
+    {10603, 5, 1, 0, 0},
+    {10608, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {1957, 2, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {10610, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10613, 7, 1, 0, 0},
+    {9754, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {10620, 8, 1, 0, 0},
+    {3096, 2, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {10628, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4485, 2, 1, 0, 0},
+    {4647, 4, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {9056, 3, 1, 0, 0},
+    {5938, 6, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {6032, 2, 1, 0, 0},
+    {10631, 2, 1, 0, 0},
+    {6059, 2, 1, 0, 0},
+    {1992, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2962, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {7469, 15, 1, 0, 0},
+    {7484, 14, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10633, 3, 1, 0, 0},
+    {10636, 7, 1, 0, 0},
+    {132, 2, 1, 0, 0},
+    {10643, 9, 1, 0, 0},
+    {176, 2, 1, 0, 0},
+    {10652, 11, 1, 0, 0},
+    {10663, 10, 1, 0, 0},
+    {10673, 9, 1, 0, 0},
+    {10682, 2, 1, 0, 0},
+    {10684, 6, 1, 0, 0},
+    {10690, 21, 1, 0, 0},
+    {10711, 21, 1, 0, 0},
+    {10732, 19, 1, 0, 0},
+    {10751, 19, 1, 0, 0},
+    {318, 2, 1, 0, 0},
+    {10770, 5, 1, 0, 0},
+    {10775, 12, 1, 0, 0},
+    {10787, 11, 1, 0, 0},
+    {10798, 5, 1, 0, 0},
+    {10803, 2, 1, 0, 0},
+    {341, 2, 1, 0, 0},
+    {10805, 6, 1, 0, 0},
+    {352, 2, 1, 0, 0},
+    {10811, 6, 1, 0, 0},
+    {10817, 13, 1, 0, 0},
+    {10830, 12, 1, 0, 0},
+    {10842, 4, 1, 0, 0},
+    {404, 2, 1, 0, 0},
+    {10846, 2, 1, 0, 0},
+    {10848, 8, 1, 0, 0},
+    {492, 2, 1, 0, 0},
+    {10856, 6, 1, 0, 0},
+    {10862, 15, 1, 0, 0},
+    {10877, 16, 1, 0, 0},
+    {10893, 4, 1, 0, 0},
+    {10897, 21, 1, 0, 0},
+    {10918, 19, 1, 0, 0},
+    {10937, 3, 1, 0, 0},
+    {10940, 10, 1, 0, 0},
+    {10950, 7, 1, 0, 0},
+    {10957, 9, 1, 0, 0},
+    {10966, 7, 1, 0, 0},
+    {676, 2, 1, 0, 0},
+    {686, 2, 1, 0, 0},
+    {10973, 6, 1, 0, 0},
+    {10979, 2, 1, 0, 0},
+    {769, 2, 1, 0, 0},
+    {781, 2, 1, 0, 0},
+    {10981, 7, 1, 0, 0},
+    {10988, 7, 1, 0, 0},
+    {10995, 17, 1, 0, 0},
+    {11012, 5, 1, 0, 0},
+    {11017, 14, 1, 0, 0},
+    {11031, 15, 1, 0, 0},
+    {854, 2, 1, 0, 0},
+    {11046, 7, 1, 0, 0},
+    {11053, 8, 1, 0, 0},
+    {904, 2, 1, 0, 0},
+    {906, 2, 1, 0, 0},
+    {11061, 6, 1, 0, 0},
+    {11067, 15, 1, 0, 0},
+    {11082, 16, 1, 0, 0},
+    {942, 2, 1, 0, 0},
+    {947, 2, 1, 0, 0},
+    {11098, 8, 1, 0, 0},
+    {956, 3, 1, 0, 0},
+    {11106, 8, 1, 0, 0},
+    {11114, 13, 1, 0, 0},
+    {974, 3, 1, 0, 0},
+    {11127, 8, 1, 0, 0},
+    {11135, 15, 1, 0, 0},
+    {11150, 14, 1, 0, 0},
+    {11164, 10, 1, 0, 0},
+    {11174, 17, 1, 0, 0},
+    {11191, 16, 1, 0, 0},
+    {11207, 13, 1, 0, 0},
+    {11220, 12, 1, 0, 0},
+    {11232, 7, 1, 0, 0},
+    {11239, 7, 1, 0, 0},
+    {11246, 9, 1, 0, 0},
+    {11255, 2, 1, 0, 0},
+    {11257, 2, 1, 0, 0},
+    {11259, 12, 1, 0, 0},
+    {11271, 11, 1, 0, 0},
+    {1130, 2, 1, 0, 0},
+    {11282, 6, 1, 0, 0},
+    {1194, 2, 1, 0, 0},
+    {1245, 2, 1, 0, 0},
+    {1306, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {11288, 4, 1, 0, 0},
+    {11292, 7, 1, 0, 0},
+    {1507, 2, 1, 0, 0},
+    {11299, 7, 1, 0, 0},
+    {11306, 7, 1, 0, 0},
+    {10601, 2, 1, 0, 0},
+    {11313, 2, 1, 0, 0},
+    {11315, 5, 1, 0, 0},
+    {1593, 2, 1, 0, 0},
+    {11320, 14, 1, 0, 0},
+    {11334, 13, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {11347, 14, 1, 0, 0},
+    {11361, 13, 1, 0, 0},
+    {11374, 3, 1, 0, 0},
+    {11377, 2, 1, 0, 0},
+    {11379, 4, 1, 0, 0},
+    {11383, 2, 1, 0, 0},
+    {11385, 2, 1, 0, 0},
+    {11387, 5, 1, 0, 0},
+    {11392, 7, 1, 0, 0},
+    {11399, 2, 1, 0, 0},
+    {2135, 2, 1, 0, 0},
+    {11401, 7, 1, 0, 0},
+    {11408, 8, 1, 0, 0},
+    {2258, 2, 1, 0, 0},
+    {11416, 6, 1, 0, 0},
+    {11422, 12, 1, 0, 0},
+    {11434, 11, 1, 0, 0},
+    {2322, 2, 1, 0, 0},
+    {11445, 15, 1, 0, 0},
+    {11460, 16, 1, 0, 0},
+    {11476, 15, 1, 0, 0},
+    {11491, 21, 1, 0, 0},
+    {11512, 20, 1, 0, 0},
+    {11532, 14, 1, 0, 0},
+    {11546, 14, 1, 0, 0},
+    {11560, 15, 1, 0, 0},
+    {11575, 14, 1, 0, 0},
+    {11589, 20, 1, 0, 0},
+    {11609, 19, 1, 0, 0},
+    {11628, 13, 1, 0, 0},
+    {11641, 9, 1, 0, 0},
+    {11650, 3, 1, 0, 0},
+    {2454, 2, 1, 0, 0},
+    {11653, 5, 1, 0, 0},
+    {11658, 6, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {11664, 7, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2606, 2, 1, 0, 0},
+    {11671, 8, 1, 0, 0},
+    {11679, 17, 1, 0, 0},
+    {11696, 16, 1, 0, 0},
+    {2980, 2, 1, 0, 0},
+    {11712, 7, 1, 0, 0},
+    {3115, 2, 1, 0, 0},
+    {11719, 7, 1, 0, 0},
+    {3359, 2, 1, 0, 0},
+    {11726, 9, 1, 0, 0},
+    {11735, 7, 1, 0, 0},
+    {11742, 8, 1, 0, 0},
+    {11750, 6, 1, 0, 0},
+    {11756, 3, 1, 0, 0},
+    {11759, 5, 1, 0, 0},
+    {3482, 2, 1, 0, 0},
+    {11764, 2, 1, 0, 0},
+    {11766, 5, 1, 0, 0},
+    {11771, 5, 1, 0, 0},
+    {3523, 2, 1, 0, 0},
+    {11776, 3, 1, 0, 0},
+    {11779, 7, 1, 0, 0},
+    {11786, 7, 1, 0, 0},
+    {11793, 2, 1, 0, 0},
+    {11795, 4, 1, 0, 0},
+    {11799, 3, 1, 0, 0},
+    {11802, 9, 1, 0, 0},
+    {11811, 8, 1, 0, 0},
+    {3684, 2, 1, 0, 0},
+    {3693, 2, 1, 0, 0},
+    {11819, 7, 1, 0, 0},
+    {11826, 5, 1, 0, 0},
+    {11831, 8, 1, 0, 0},
+    {11839, 7, 1, 0, 0},
+    {11846, 3, 1, 0, 0},
+    {11849, 6, 1, 0, 0},
+    {11855, 13, 1, 0, 0},
+    {11868, 12, 1, 0, 0},
+    {11880, 6, 1, 0, 0},
+    {10039, 2, 1, 0, 0},
+    {3823, 2, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {11886, 15, 1, 0, 0},
+    {11901, 14, 1, 0, 0},
+    {11915, 7, 1, 0, 0},
+    {11922, 2, 1, 0, 0},
+    {11924, 5, 1, 0, 0},
+    {11929, 6, 1, 0, 0},
+    {3942, 2, 1, 0, 0},
+    {3944, 2, 1, 0, 0},
+    {11935, 6, 1, 0, 0},
+    {11941, 3, 1, 0, 0},
+    {11944, 6, 1, 0, 0},
+    {11950, 5, 1, 0, 0},
+    {11955, 13, 1, 0, 0},
+    {11968, 21, 1, 0, 0},
+    {11989, 12, 1, 0, 0},
+    {12001, 13, 1, 0, 0},
+    {12014, 18, 1, 0, 0},
+    {4036, 2, 1, 0, 0},
+    {4041, 2, 1, 0, 0},
+    {4078, 2, 1, 0, 0},
+    {12032, 6, 1, 0, 0},
+    {12038, 6, 1, 0, 0},
+    {4217, 2, 1, 0, 0},
+    {12044, 6, 1, 0, 0},
+    {4275, 2, 1, 0, 0},
+    {12050, 5, 1, 0, 0},
+    {9146, 2, 1, 0, 0},
+    {12055, 9, 1, 0, 0},
+    {12064, 12, 1, 0, 0},
+    {12076, 11, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {12087, 8, 1, 0, 0},
+    {12095, 2, 1, 0, 0},
+    {4414, 2, 1, 0, 0},
+    {12097, 6, 1, 0, 0},
+    {12103, 5, 1, 0, 0},
+    {12108, 7, 1, 0, 0},
+    {12115, 5, 1, 0, 0},
+    {12120, 5, 1, 0, 0},
+    {12125, 2, 1, 0, 0},
+    {12127, 2, 1, 0, 0},
+    {4472, 2, 1, 0, 0},
+    {12129, 7, 1, 0, 0},
+    {12136, 13, 1, 0, 0},
+    {12149, 12, 1, 0, 0},
+    {12161, 7, 1, 0, 0},
+    {4485, 2, 1, 0, 0},
+    {12168, 2, 1, 0, 0},
+    {12170, 8, 1, 0, 0},
+    {12178, 8, 1, 0, 0},
+    {12186, 8, 1, 0, 0},
+    {12194, 4, 1, 0, 0},
+    {12198, 7, 1, 0, 0},
+    {12205, 3, 1, 0, 0},
+    {4622, 2, 1, 0, 0},
+    {12208, 2, 1, 0, 0},
+    {12210, 9, 1, 0, 0},
+    {12219, 7, 1, 0, 0},
+    {4651, 2, 1, 0, 0},
+    {12226, 5, 1, 0, 0},
+    {4758, 2, 1, 0, 0},
+    {12231, 2, 1, 0, 0},
+    {12233, 3, 1, 0, 0},
+    {12236, 6, 1, 0, 0},
+    {12242, 2, 1, 0, 0},
+    {12244, 2, 1, 0, 0},
+    {12246, 2, 1, 0, 0},
+    {12248, 6, 1, 0, 0},
+    {12254, 7, 1, 0, 0},
+    {12261, 2, 1, 0, 0},
+    {4798, 2, 1, 0, 0},
+    {12263, 15, 1, 0, 0},
+    {12278, 13, 1, 0, 0},
+    {12291, 14, 1, 0, 0},
+    {12305, 12, 1, 0, 0},
+    {12317, 2, 1, 0, 0},
+    {12319, 2, 1, 0, 0},
+    {12321, 5, 1, 0, 0},
+    {12326, 6, 1, 0, 0},
+    {12332, 2, 1, 0, 0},
+    {12334, 2, 1, 0, 0},
+    {4981, 2, 1, 0, 0},
+    {12336, 4, 1, 0, 0},
+    {12340, 4, 1, 0, 0},
+    {12344, 6, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {12350, 7, 1, 0, 0},
+    {12357, 3, 1, 0, 0},
+    {12360, 8, 1, 0, 0},
+    {12368, 8, 1, 0, 0},
+    {12376, 7, 1, 0, 0},
+    {12383, 6, 1, 0, 0},
+    {5353, 2, 1, 0, 0},
+    {12389, 3, 1, 0, 0},
+    {12392, 7, 1, 0, 0},
+    {12399, 6, 1, 0, 0},
+    {12405, 5, 1, 0, 0},
+    {12410, 8, 1, 0, 0},
+    {5418, 2, 1, 0, 0},
+    {12418, 7, 1, 0, 0},
+    {12425, 2, 1, 0, 0},
+    {5494, 2, 1, 0, 0},
+    {5499, 2, 1, 0, 0},
+    {12427, 9, 1, 0, 0},
+    {5636, 2, 1, 0, 0},
+    {12436, 2, 1, 0, 0},
+    {12438, 3, 1, 0, 0},
+    {12441, 7, 1, 0, 0},
+    {12448, 2, 1, 0, 0},
+    {12450, 12, 1, 0, 0},
+    {12462, 11, 1, 0, 0},
+    {12473, 6, 1, 0, 0},
+    {12479, 5, 1, 0, 0},
+    {5858, 2, 1, 0, 0},
+    {5860, 2, 1, 0, 0},
+    {12484, 6, 1, 0, 0},
+    {12490, 3, 1, 0, 0},
+    {12493, 7, 1, 0, 0},
+    {12500, 2, 1, 0, 0},
+    {5916, 2, 1, 0, 0},
+    {12502, 21, 1, 0, 0},
+    {12523, 21, 1, 0, 0},
+    {12544, 19, 1, 0, 0},
+    {12563, 19, 1, 0, 0},
+    {12582, 7, 1, 0, 0},
+    {12589, 17, 1, 0, 0},
+    {12606, 16, 1, 0, 0},
+    {12622, 18, 1, 0, 0},
+    {12640, 17, 1, 0, 0},
+    {12657, 8, 1, 0, 0},
+    {12665, 16, 1, 0, 0},
+    {12681, 15, 1, 0, 0},
+    {12696, 19, 1, 0, 0},
+    {12715, 18, 1, 0, 0},
+    {12733, 16, 1, 0, 0},
+    {12749, 15, 1, 0, 0},
+    {12764, 18, 1, 0, 0},
+    {12782, 17, 1, 0, 0},
+    {12799, 19, 1, 0, 0},
+    {12818, 18, 1, 0, 0},
+    {12836, 15, 1, 0, 0},
+    {12851, 14, 1, 0, 0},
+    {12865, 18, 1, 0, 0},
+    {12883, 17, 1, 0, 0},
+    {12900, 15, 1, 0, 0},
+    {12915, 14, 1, 0, 0},
+    {12929, 17, 1, 0, 0},
+    {12946, 16, 1, 0, 0},
+    {12962, 18, 1, 0, 0},
+    {12980, 17, 1, 0, 0},
+    {12997, 16, 1, 0, 0},
+    {13013, 15, 1, 0, 0},
+    {13028, 17, 1, 0, 0},
+    {13045, 16, 1, 0, 0},
+    {13061, 6, 1, 0, 0},
+    {13067, 7, 1, 0, 0},
+    {13074, 7, 1, 0, 0},
+    {13081, 2, 1, 0, 0},
+    {13083, 5, 1, 0, 0},
+    {13088, 7, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {13095, 2, 1, 0, 0},
+    {13097, 5, 1, 0, 0},
+    {13102, 3, 1, 0, 0},
+    {13105, 6, 1, 0, 0},
+    {13111, 13, 1, 0, 0},
+    {13124, 12, 1, 0, 0},
+    {6065, 2, 1, 0, 0},
+    {13136, 11, 1, 0, 0},
+    {13147, 10, 1, 0, 0},
+    {13157, 10, 1, 0, 0},
+    {13167, 9, 1, 0, 0},
+    {13176, 11, 1, 0, 0},
+    {13187, 13, 1, 0, 0},
+    {13200, 12, 1, 0, 0},
+    {13212, 10, 1, 0, 0},
+    {13222, 12, 1, 0, 0},
+    {13234, 11, 1, 0, 0},
+    {13245, 12, 1, 0, 0},
+    {13257, 14, 1, 0, 0},
+    {13271, 11, 1, 0, 0},
+    {13282, 12, 1, 0, 0},
+    {13294, 3, 1, 0, 0},
+    {13297, 6, 1, 0, 0},
+    {13303, 2, 1, 0, 0},
+    {6088, 2, 1, 0, 0},
+    {13305, 3, 1, 0, 0},
+    {6090, 2, 1, 0, 0},
+    {13308, 3, 1, 0, 0},
+    {13311, 6, 1, 0, 0},
+    {13317, 7, 1, 0, 0},
+    {13324, 6, 1, 0, 0},
+    {13330, 8, 1, 0, 0},
+    {13338, 8, 1, 0, 0},
+    {13346, 6, 1, 0, 0},
+    {6130, 2, 1, 0, 0},
+    {13352, 13, 1, 0, 0},
+    {13365, 12, 1, 0, 0},
+    {13377, 7, 1, 0, 0},
+    {13384, 7, 1, 0, 0},
+    {13391, 2, 1, 0, 0},
+    {13393, 2, 1, 0, 0},
+    {13395, 2, 1, 0, 0},
+    {13397, 2, 1, 0, 0},
+    {13399, 22, 1, 0, 0},
+    {13421, 21, 1, 0, 0},
+    {13442, 22, 1, 0, 0},
+    {13464, 19, 1, 0, 0},
+    {13483, 18, 1, 0, 0},
+    {13501, 19, 1, 0, 0},
+    {13520, 18, 1, 0, 0},
+    {13538, 15, 1, 0, 0},
+    {13553, 24, 1, 0, 0},
+    {13577, 23, 1, 0, 0},
+    {13600, 25, 1, 0, 0},
+    {13625, 24, 1, 0, 0},
+    {13649, 24, 1, 0, 0},
+    {13673, 23, 1, 0, 0},
+    {13696, 23, 1, 0, 0},
+    {13719, 22, 1, 0, 0},
+    {13741, 19, 1, 0, 0},
+    {13760, 21, 1, 0, 0},
+    {13781, 18, 1, 0, 0},
+    {13799, 19, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {97, 2, 1, 0, 0},
+    {13818, 5, 1, 52, 5455},
+    {13823, 5, 1, 28, 5507},
+    {13828, 6, 1, 22, 5535},
+    {13834, 5, 1, 58, 5557},
+    {1308, 2, 1, 0, 0},
+    {9142, 2, 1, 0, 0},
+    {13839, 5, 1, 22, 5615},
+    {13844, 5, 1, 15, 5637},
+    {13849, 7, 1, 63, 5652},
+    {13856, 9, 1, 51, 5715},
+    {13865, 4, 1, 38, 5766},
+    {10055, 2, 1, 0, 0},
+    {2606, 2, 1, 0, 0},
+    {13869, 5, 1, 36, 5804},
+    {13874, 9, 1, 25, 5840},
+    {13883, 8, 1, 142, 5865},
+    {13891, 5, 1, 46, 6007},
+    {13896, 7, 1, 51, 6053},
+    {13903, 8, 1, 19, 6104},
+    {13911, 5, 1, 34, 6123},
+    {13916, 6, 1, 15, 6157},
+    {13922, 9, 1, 20, 6172},
+    {13931, 8, 1, 30, 6192},
+    {13939, 8, 2, 1, 6222},
+    {13947, 10, 2, 1, 6223},
+    {13957, 4, 2, 1, 6224},
+    {13961, 5, 1, 31, 6225},
+    {13966, 8, 1, 23, 6256},
+    {3381, 5, 1, 31, 6279},
+    {13974, 2, 1, 0, 0},
+    {13976, 3, 1, 30, 6310},
+    {13979, 6, 1, 32, 6340},
+    {13985, 8, 1, 27, 6372},
+    {13993, 6, 1, 75, 6399},
+    {13999, 8, 1, 22, 6474},
+    {4083, 6, 2, 1, 6496},
+    {14007, 4, 1, 38, 6497},
+    {4108, 2, 1, 0, 0},
+    {14011, 7, 1, 34, 6535},
+    {14018, 4, 1, 19, 6569},
+    {14022, 7, 1, 26, 6588},
+    {4299, 7, 1, 42, 6614},
+    {9192, 2, 1, 0, 0},
+    {4397, 5, 1, 50, 6656},
+    {14029, 4, 1, 26, 6706},
+    {14033, 7, 1, 69, 6732},
+    {14040, 7, 2, 1, 6801},
+    {14047, 6, 2, 1, 6802},
+    {14053, 5, 1, 23, 6803},
+    {14058, 7, 1, 23, 6826},
+    {14065, 8, 1, 36, 6849},
+    {14073, 7, 1, 31, 6885},
+    {14080, 9, 1, 17, 6916},
+    {5867, 5, 1, 57, 6933},
+    {14089, 7, 1, 13, 6990},
+    {14096, 6, 1, 24, 7003},
+    {14102, 8, 1, 29, 7027},
+    {14110, 13, 1, 0, 0},
+    {14123, 9, 1, 0, 0},
+    {14132, 11, 1, 0, 0},
+    {14143, 11, 1, 0, 0},
+    {14154, 11, 1, 0, 0},
+    {14165, 11, 1, 0, 0},
+    {14176, 11, 1, 0, 0},
+    {14187, 11, 1, 0, 0},
+    {14198, 9, 1, 0, 0},
+    {14207, 11, 1, 0, 0},
+    {14218, 11, 1, 0, 0},
+    {14229, 11, 1, 0, 0},
+    {14240, 10, 1, 0, 0},
+    {14250, 10, 1, 0, 0},
+    {14260, 12, 1, 0, 0},
+    {14272, 11, 1, 0, 0},
+    {14283, 10, 1, 0, 0},
+    {14293, 10, 1, 0, 0},
+    {14303, 14, 1, 0, 0},
+    {14317, 14, 1, 0, 0},
+    {14331, 10, 1, 0, 0},
+    {14341, 10, 1, 0, 0},
+    {14351, 11, 1, 0, 0},
+    {14362, 11, 1, 0, 0},
+    {14373, 11, 1, 0, 0},
+    {14384, 11, 1, 0, 0},
+    {14395, 10, 1, 0, 0},
+    {14405, 11, 1, 0, 0},
+    {14416, 10, 1, 0, 0},
+    {14426, 10, 1, 0, 0},
+    {14436, 10, 1, 0, 0},
+    {14446, 11, 1, 0, 0},
+    {14457, 11, 1, 0, 0},
+    {14468, 14, 1, 0, 0},
+    {14482, 11, 1, 0, 0},
+    {14493, 11, 1, 0, 0},
+    {14504, 11, 1, 0, 0},
+    {14515, 10, 1, 0, 0},
+    {14525, 9, 1, 0, 0},
+    {14534, 10, 1, 0, 0},
+    {14544, 10, 1, 0, 0},
+    {14554, 11, 1, 0, 0},
+    {14565, 11, 1, 0, 0},
+    {14576, 10, 1, 0, 0},
+    {14586, 11, 1, 0, 0},
+    {14597, 11, 1, 0, 0},
+    {14608, 11, 1, 0, 0},
+    {14619, 8, 1, 34, 7056},
+    {14627, 9, 1, 16, 7090},
+    {14636, 9, 1, 28, 7106},
+    {8456, 8, 2, 1, 7134},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4108, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14645, 3, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10303, 7, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {10310, 8, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14648, 11, 1, 0, 0},
+    {10332, 3, 1, 0, 0},
+    {10061, 6, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {10335, 11, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9900, 3, 1, 0, 0},
+    {14659, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {14662, 5, 1, 0, 0},
+    {14667, 8, 1, 0, 0},
+    {14675, 8, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {14683, 5, 1, 0, 0},
+    {14688, 7, 1, 0, 0},
+    {1971, 2, 1, 0, 0},
+    {14695, 7, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {14702, 7, 1, 0, 0},
+    {14709, 9, 1, 0, 0},
+    {14718, 8, 1, 0, 0},
+    {14726, 9, 1, 0, 0},
+    {14735, 2, 1, 0, 0},
+    {14737, 7, 1, 0, 0},
+    {14744, 4, 1, 0, 0},
+    {14748, 7, 1, 0, 0},
+    {14755, 7, 1, 0, 0},
+    {3289, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4036, 2, 1, 0, 0},
+    {4108, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4472, 2, 1, 0, 0},
+    {4798, 2, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {14762, 5, 1, 0, 0},
+    {14767, 5, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {14772, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9754, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14775, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {14778, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {14782, 3, 1, 0, 0},
+    {10513, 5, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3686, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4177, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {10160, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9197, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {9200, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2962, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2962, 2, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14785, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {14788, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10545, 4, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10332, 3, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9757, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10061, 6, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {52, 7, 1, 0, 0},
+    {14791, 11, 1, 0, 0},
+    {14802, 3, 1, 0, 0},
+    {14805, 8, 1, 0, 0},
+    {14813, 7, 1, 0, 0},
+    {14820, 6, 1, 0, 0},
+    {14826, 5, 1, 0, 0},
+    {8659, 9, 1, 0, 0},
+    {14831, 8, 1, 0, 0},
+    {14839, 9, 1, 0, 0},
+    {14848, 16, 1, 0, 0},
+    {14864, 11, 1, 0, 0},
+    {284, 9, 1, 0, 0},
+    {14875, 3, 1, 0, 0},
+    {14878, 9, 1, 0, 0},
+    {14887, 6, 1, 0, 0},
+    {14893, 12, 1, 0, 0},
+    {14905, 8, 1, 0, 0},
+    {14913, 8, 1, 0, 0},
+    {14921, 9, 1, 0, 0},
+    {14930, 14, 1, 0, 0},
+    {14944, 11, 1, 0, 0},
+    {14955, 12, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {14967, 12, 1, 0, 0},
+    {14979, 9, 1, 0, 0},
+    {14988, 7, 1, 0, 0},
+    {14995, 12, 1, 0, 0},
+    {15007, 10, 1, 0, 0},
+    {10135, 4, 1, 0, 0},
+    {15017, 13, 1, 0, 0},
+    {15030, 8, 1, 0, 0},
+    {15038, 13, 1, 0, 0},
+    {15051, 6, 1, 0, 0},
+    {8677, 11, 1, 0, 0},
+    {15057, 9, 1, 0, 0},
+    {15066, 7, 1, 0, 0},
+    {15073, 6, 1, 0, 0},
+    {15079, 9, 1, 0, 0},
+    {15088, 10, 1, 0, 0},
+    {15098, 8, 1, 0, 0},
+    {15106, 4, 1, 0, 0},
+    {15110, 7, 1, 0, 0},
+    {15117, 7, 1, 0, 0},
+    {15124, 4, 1, 0, 0},
+    {15128, 4, 1, 0, 0},
+    {15132, 9, 1, 0, 0},
+    {535, 9, 1, 0, 0},
+    {579, 8, 1, 0, 0},
+    {15141, 5, 1, 0, 0},
+    {15146, 5, 1, 0, 0},
+    {15151, 6, 1, 0, 0},
+    {15157, 9, 1, 0, 0},
+    {15166, 13, 1, 0, 0},
+    {15179, 8, 1, 0, 0},
+    {15187, 7, 1, 0, 0},
+    {15194, 8, 1, 0, 0},
+    {654, 6, 1, 0, 0},
+    {15202, 4, 1, 0, 0},
+    {688, 5, 1, 0, 0},
+    {15206, 6, 1, 0, 0},
+    {15212, 4, 1, 0, 0},
+    {15216, 7, 1, 0, 0},
+    {15223, 10, 1, 0, 0},
+    {15233, 4, 1, 0, 0},
+    {834, 6, 1, 0, 0},
+    {15237, 9, 1, 0, 0},
+    {15246, 15, 1, 0, 0},
+    {15261, 13, 1, 0, 0},
+    {15274, 6, 1, 0, 0},
+    {15280, 16, 1, 0, 0},
+    {15296, 6, 1, 0, 0},
+    {15302, 7, 1, 0, 0},
+    {15309, 7, 1, 0, 0},
+    {15316, 15, 1, 0, 0},
+    {15331, 9, 1, 0, 0},
+    {15340, 6, 1, 0, 0},
+    {15346, 7, 1, 0, 0},
+    {896, 8, 1, 0, 0},
+    {15353, 9, 1, 0, 0},
+    {15362, 8, 1, 0, 0},
+    {15370, 7, 1, 0, 0},
+    {15377, 3, 1, 0, 0},
+    {15380, 6, 1, 0, 0},
+    {15386, 8, 1, 0, 0},
+    {15394, 10, 1, 0, 0},
+    {15404, 9, 1, 0, 0},
+    {15413, 3, 1, 0, 0},
+    {15416, 6, 1, 0, 0},
+    {15422, 10, 1, 0, 0},
+    {15432, 7, 1, 0, 0},
+    {15439, 10, 1, 0, 0},
+    {15449, 14, 1, 0, 0},
+    {15463, 6, 1, 0, 0},
+    {15469, 7, 1, 0, 0},
+    {15476, 6, 1, 0, 0},
+    {1107, 6, 1, 0, 0},
+    {15482, 11, 1, 0, 0},
+    {15493, 10, 1, 0, 0},
+    {15503, 13, 1, 0, 0},
+    {15516, 7, 1, 0, 0},
+    {15523, 8, 1, 0, 0},
+    {15531, 9, 1, 0, 0},
+    {15540, 15, 1, 0, 0},
+    {15555, 12, 1, 0, 0},
+    {15567, 9, 1, 0, 0},
+    {15576, 14, 1, 0, 0},
+    {15590, 10, 1, 0, 0},
+    {15600, 6, 1, 0, 0},
+    {15606, 6, 1, 0, 0},
+    {15612, 12, 1, 0, 0},
+    {15624, 12, 1, 0, 0},
+    {15636, 8, 1, 0, 0},
+    {15644, 7, 1, 0, 0},
+    {15651, 5, 1, 0, 0},
+    {15656, 4, 1, 0, 0},
+    {15660, 14, 1, 0, 0},
+    {15674, 4, 1, 0, 0},
+    {15678, 7, 1, 0, 0},
+    {15685, 10, 1, 0, 0},
+    {15695, 20, 1, 0, 0},
+    {15715, 15, 1, 0, 0},
+    {15730, 8, 1, 0, 0},
+    {15738, 8, 1, 0, 0},
+    {15746, 13, 1, 0, 0},
+    {15759, 14, 1, 0, 0},
+    {1358, 9, 1, 0, 0},
+    {1381, 8, 1, 0, 0},
+    {15773, 15, 1, 0, 0},
+    {15788, 12, 1, 0, 0},
+    {15800, 15, 1, 0, 0},
+    {15815, 7, 1, 0, 0},
+    {15822, 10, 1, 0, 0},
+    {15832, 11, 1, 0, 0},
+    {15843, 8, 1, 0, 0},
+    {15851, 7, 1, 0, 0},
+    {15858, 13, 1, 0, 0},
+    {15871, 6, 1, 0, 0},
+    {15877, 6, 1, 0, 0},
+    {15883, 9, 1, 0, 0},
+    {15892, 8, 1, 0, 0},
+    {15900, 8, 1, 0, 0},
+    {15908, 14, 1, 0, 0},
+    {15922, 7, 1, 0, 0},
+    {15929, 5, 1, 0, 0},
+    {1584, 5, 1, 0, 0},
+    {15934, 4, 1, 0, 0},
+    {15938, 6, 1, 0, 0},
+    {15944, 8, 1, 0, 0},
+    {15952, 3, 1, 0, 0},
+    {15955, 14, 1, 0, 0},
+    {15969, 8, 1, 0, 0},
+    {15977, 11, 1, 0, 0},
+    {15988, 7, 1, 0, 0},
+    {15995, 5, 1, 0, 0},
+    {1711, 6, 1, 0, 0},
+    {16000, 7, 1, 0, 0},
+    {16007, 8, 1, 0, 0},
+    {16015, 9, 1, 0, 0},
+    {16024, 5, 1, 0, 0},
+    {16029, 8, 1, 0, 0},
+    {16037, 6, 1, 0, 0},
+    {16043, 10, 1, 0, 0},
+    {16053, 9, 1, 0, 0},
+    {1883, 9, 1, 0, 0},
+    {16062, 11, 1, 0, 0},
+    {16073, 8, 1, 0, 0},
+    {16081, 9, 1, 0, 0},
+    {16090, 6, 1, 0, 0},
+    {16096, 10, 1, 0, 0},
+    {16106, 10, 1, 0, 0},
+    {16116, 12, 1, 0, 0},
+    {16128, 7, 1, 0, 0},
+    {16135, 10, 1, 0, 0},
+    {16145, 11, 1, 0, 0},
+    {16156, 25, 1, 0, 0},
+    {16181, 8, 1, 0, 0},
+    {16189, 5, 1, 0, 0},
+    {1976, 6, 1, 0, 0},
+    {16194, 9, 1, 0, 0},
+    {16203, 6, 1, 0, 0},
+    {16209, 10, 1, 0, 0},
+    {2073, 6, 1, 0, 0},
+    {2086, 4, 1, 0, 0},
+    {16219, 13, 1, 0, 0},
+    {2090, 7, 1, 0, 0},
+    {16232, 9, 1, 0, 0},
+    {16241, 5, 1, 0, 0},
+    {16246, 8, 1, 0, 0},
+    {16254, 9, 1, 0, 0},
+    {2153, 4, 1, 0, 0},
+    {16263, 7, 1, 0, 0},
+    {16270, 8, 1, 0, 0},
+    {16278, 7, 1, 0, 0},
+    {16285, 8, 1, 0, 0},
+    {16293, 7, 1, 0, 0},
+    {16300, 5, 1, 0, 0},
+    {16305, 12, 1, 0, 0},
+    {16317, 9, 1, 0, 0},
+    {2309, 10, 1, 0, 0},
+    {16326, 9, 1, 0, 0},
+    {16335, 9, 1, 0, 0},
+    {16344, 12, 1, 0, 0},
+    {16356, 11, 1, 0, 0},
+    {16367, 8, 1, 0, 0},
+    {16375, 8, 1, 0, 0},
+    {16383, 4, 1, 0, 0},
+    {16387, 8, 1, 0, 0},
+    {2381, 9, 1, 0, 0},
+    {2404, 7, 1, 0, 0},
+    {2434, 6, 1, 0, 0},
+    {16395, 7, 1, 0, 0},
+    {16402, 9, 1, 0, 0},
+    {16411, 11, 1, 0, 0},
+    {16422, 7, 1, 0, 0},
+    {16429, 7, 1, 0, 0},
+    {16436, 7, 1, 0, 0},
+    {16443, 4, 1, 0, 0},
+    {2510, 5, 1, 0, 0},
+    {16447, 5, 1, 0, 0},
+    {16452, 11, 1, 0, 0},
+    {16463, 4, 1, 0, 0},
+    {16467, 8, 1, 0, 0},
+    {16475, 10, 1, 0, 0},
+    {2699, 7, 1, 0, 0},
+    {16485, 7, 1, 0, 0},
+    {16492, 18, 1, 0, 0},
+    {16510, 6, 1, 0, 0},
+    {2732, 6, 1, 0, 0},
+    {16516, 14, 1, 0, 0},
+    {16530, 6, 1, 0, 0},
+    {2752, 8, 1, 0, 0},
+    {16536, 15, 1, 0, 0},
+    {16551, 8, 1, 0, 0},
+    {16559, 8, 1, 0, 0},
+    {16567, 10, 1, 0, 0},
+    {16577, 17, 1, 0, 0},
+    {16594, 14, 1, 0, 0},
+    {16608, 10, 1, 0, 0},
+    {16618, 12, 1, 0, 0},
+    {16630, 7, 1, 0, 0},
+    {16637, 16, 1, 0, 0},
+    {16653, 8, 1, 0, 0},
+    {2913, 5, 1, 0, 0},
+    {16661, 10, 1, 0, 0},
+    {16671, 12, 1, 0, 0},
+    {16683, 13, 1, 0, 0},
+    {16696, 6, 1, 0, 0},
+    {16702, 7, 1, 0, 0},
+    {16709, 12, 1, 0, 0},
+    {16721, 12, 1, 0, 0},
+    {16733, 12, 1, 0, 0},
+    {16745, 11, 1, 0, 0},
+    {16756, 4, 1, 0, 0},
+    {16760, 4, 1, 0, 0},
+    {16764, 9, 1, 0, 0},
+    {16773, 7, 1, 0, 0},
+    {16780, 9, 1, 0, 0},
+    {16789, 9, 1, 0, 0},
+    {3168, 7, 1, 0, 0},
+    {16798, 6, 1, 0, 0},
+    {16804, 9, 1, 0, 0},
+    {16813, 3, 1, 0, 0},
+    {16816, 10, 1, 0, 0},
+    {16826, 7, 1, 0, 0},
+    {16833, 11, 1, 0, 0},
+    {16844, 10, 1, 0, 0},
+    {16854, 4, 1, 0, 0},
+    {16858, 6, 1, 0, 0},
+    {16864, 9, 1, 0, 0},
+    {3298, 4, 1, 0, 0},
+    {16873, 10, 1, 0, 0},
+    {3332, 5, 1, 0, 0},
+    {16883, 5, 1, 0, 0},
+    {16888, 13, 1, 0, 0},
+    {16901, 14, 1, 0, 0},
+    {16915, 5, 1, 0, 0},
+    {16920, 6, 1, 0, 0},
+    {16926, 7, 1, 0, 0},
+    {16933, 10, 1, 0, 0},
+    {16943, 6, 1, 0, 0},
+    {16949, 4, 1, 0, 0},
+    {16953, 7, 1, 0, 0},
+    {16960, 11, 1, 0, 0},
+    {3583, 7, 1, 0, 0},
+    {16971, 4, 1, 0, 0},
+    {3608, 6, 1, 0, 0},
+    {16975, 13, 1, 0, 0},
+    {16988, 12, 1, 0, 0},
+    {3645, 6, 1, 0, 0},
+    {17000, 10, 1, 0, 0},
+    {17010, 6, 1, 0, 0},
+    {17016, 8, 1, 0, 0},
+    {17024, 7, 1, 0, 0},
+    {17031, 10, 1, 0, 0},
+    {17041, 6, 1, 0, 0},
+    {17047, 3, 1, 0, 0},
+    {3724, 6, 1, 0, 0},
+    {17050, 8, 1, 0, 0},
+    {17058, 10, 1, 0, 0},
+    {17068, 7, 1, 0, 0},
+    {17075, 8, 1, 0, 0},
+    {17083, 4, 1, 0, 0},
+    {17087, 7, 1, 0, 0},
+    {17094, 8, 1, 0, 0},
+    {17102, 8, 1, 0, 0},
+    {17110, 8, 1, 0, 0},
+    {17118, 10, 1, 0, 0},
+    {3840, 5, 1, 0, 0},
+    {17128, 7, 1, 0, 0},
+    {17135, 19, 1, 0, 0},
+    {17154, 6, 1, 0, 0},
+    {3862, 8, 1, 0, 0},
+    {17160, 9, 1, 0, 0},
+    {17169, 8, 1, 0, 0},
+    {17177, 11, 1, 0, 0},
+    {17188, 8, 1, 0, 0},
+    {17196, 4, 1, 0, 0},
+    {17200, 6, 1, 0, 0},
+    {17206, 6, 1, 0, 0},
+    {17212, 9, 1, 0, 0},
+    {17221, 7, 1, 0, 0},
+    {17228, 8, 1, 0, 0},
+    {17236, 6, 1, 0, 0},
+    {17242, 4, 1, 0, 0},
+    {3975, 5, 1, 0, 0},
+    {17246, 8, 1, 0, 0},
+    {17254, 10, 1, 0, 0},
+    {17264, 8, 1, 0, 0},
+    {4001, 6, 1, 0, 0},
+    {17272, 10, 1, 0, 0},
+    {17282, 8, 1, 0, 0},
+    {17290, 8, 1, 0, 0},
+    {17298, 8, 1, 0, 0},
+    {17306, 6, 1, 0, 0},
+    {17312, 6, 1, 0, 0},
+    {17318, 12, 1, 0, 0},
+    {17330, 16, 1, 0, 0},
+    {4057, 5, 1, 0, 0},
+    {17346, 8, 1, 0, 0},
+    {17354, 16, 1, 0, 0},
+    {17370, 16, 1, 0, 0},
+    {17386, 14, 1, 0, 0},
+    {17400, 14, 1, 0, 0},
+    {17414, 20, 1, 0, 0},
+    {17434, 15, 1, 0, 0},
+    {17449, 6, 1, 0, 0},
+    {17455, 17, 1, 0, 0},
+    {17472, 19, 1, 0, 0},
+    {17491, 8, 1, 0, 0},
+    {17499, 5, 1, 0, 0},
+    {17504, 8, 1, 0, 0},
+    {17512, 5, 1, 0, 0},
+    {17517, 12, 1, 0, 0},
+    {17529, 9, 1, 0, 0},
+    {17538, 9, 1, 0, 0},
+    {17547, 7, 1, 0, 0},
+    {17554, 9, 1, 0, 0},
+    {17563, 7, 1, 0, 0},
+    {17570, 6, 1, 0, 0},
+    {17576, 7, 1, 0, 0},
+    {17583, 5, 1, 0, 0},
+    {4269, 3, 1, 0, 0},
+    {4277, 3, 1, 0, 0},
+    {17588, 4, 1, 0, 0},
+    {17592, 13, 1, 0, 0},
+    {17605, 15, 1, 0, 0},
+    {17620, 5, 1, 0, 0},
+    {4355, 6, 1, 0, 0},
+    {17625, 7, 1, 0, 0},
+    {17632, 7, 1, 0, 0},
+    {17639, 6, 1, 0, 0},
+    {17645, 11, 1, 0, 0},
+    {17656, 5, 1, 0, 0},
+    {17661, 6, 1, 0, 0},
+    {17667, 7, 1, 0, 0},
+    {17674, 9, 1, 0, 0},
+    {17683, 6, 1, 0, 0},
+    {17689, 5, 1, 0, 0},
+    {17694, 11, 1, 0, 0},
+    {17705, 6, 1, 0, 0},
+    {4429, 5, 1, 0, 0},
+    {17711, 8, 1, 0, 0},
+    {4489, 8, 1, 0, 0},
+    {17719, 12, 1, 0, 0},
+    {17731, 16, 1, 0, 0},
+    {17747, 9, 1, 0, 0},
+    {17756, 7, 1, 0, 0},
+    {4517, 11, 1, 0, 0},
+    {17763, 6, 1, 0, 0},
+    {17769, 10, 1, 0, 0},
+    {17779, 11, 1, 0, 0},
+    {17790, 10, 1, 0, 0},
+    {17800, 6, 1, 0, 0},
+    {17806, 5, 1, 0, 0},
+    {17811, 6, 1, 0, 0},
+    {17817, 8, 1, 0, 0},
+    {17825, 10, 1, 0, 0},
+    {17835, 28, 1, 0, 0},
+    {17863, 12, 1, 0, 0},
+    {17875, 8, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {17883, 7, 1, 0, 0},
+    {17890, 6, 1, 0, 0},
+    {17896, 5, 1, 0, 0},
+    {4776, 6, 1, 0, 0},
+    {17901, 8, 1, 0, 0},
+    {17909, 7, 1, 0, 0},
+    {9059, 8, 1, 0, 0},
+    {17916, 10, 1, 0, 0},
+    {17926, 12, 1, 0, 0},
+    {17938, 9, 1, 0, 0},
+    {17947, 7, 1, 0, 0},
+    {12336, 4, 1, 0, 0},
+    {17954, 6, 1, 0, 0},
+    {17960, 10, 1, 0, 0},
+    {17970, 5, 1, 0, 0},
+    {17975, 12, 1, 0, 0},
+    {17987, 8, 1, 0, 0},
+    {17995, 8, 1, 0, 0},
+    {18003, 12, 1, 0, 0},
+    {18015, 12, 1, 0, 0},
+    {18027, 9, 1, 0, 0},
+    {18036, 7, 1, 0, 0},
+    {18043, 12, 1, 0, 0},
+    {18055, 4, 1, 0, 0},
+    {18059, 10, 1, 0, 0},
+    {18069, 12, 1, 0, 0},
+    {18081, 11, 1, 0, 0},
+    {18092, 11, 1, 0, 0},
+    {5181, 6, 1, 0, 0},
+    {18103, 7, 1, 0, 0},
+    {5200, 7, 1, 0, 0},
+    {18110, 15, 1, 0, 0},
+    {18125, 17, 1, 0, 0},
+    {18142, 18, 1, 0, 0},
+    {18160, 13, 1, 0, 0},
+    {18173, 14, 1, 0, 0},
+    {18187, 14, 1, 0, 0},
+    {18201, 8, 1, 0, 0},
+    {18209, 18, 1, 0, 0},
+    {18227, 8, 1, 0, 0},
+    {18235, 7, 1, 0, 0},
+    {18242, 10, 1, 0, 0},
+    {18252, 8, 1, 0, 0},
+    {5302, 5, 1, 0, 0},
+    {18260, 10, 1, 0, 0},
+    {18270, 7, 1, 0, 0},
+    {5355, 4, 1, 0, 0},
+    {5378, 3, 1, 0, 0},
+    {18277, 5, 1, 0, 0},
+    {18282, 7, 1, 0, 0},
+    {18289, 7, 1, 0, 0},
+    {18296, 14, 1, 0, 0},
+    {18310, 13, 1, 0, 0},
+    {18323, 9, 1, 0, 0},
+    {5480, 5, 1, 0, 0},
+    {18332, 3, 1, 0, 0},
+    {18335, 6, 1, 0, 0},
+    {18341, 5, 1, 0, 0},
+    {18346, 8, 1, 0, 0},
+    {18354, 9, 1, 0, 0},
+    {18363, 5, 1, 0, 0},
+    {18368, 15, 1, 0, 0},
+    {18383, 7, 1, 0, 0},
+    {18390, 5, 1, 0, 0},
+    {18395, 10, 1, 0, 0},
+    {18405, 6, 1, 0, 0},
+    {5548, 9, 1, 0, 0},
+    {18411, 12, 1, 0, 0},
+    {18423, 9, 1, 0, 0},
+    {18432, 6, 1, 0, 0},
+    {18438, 12, 1, 0, 0},
+    {18450, 6, 1, 0, 0},
+    {18456, 8, 1, 0, 0},
+    {18464, 6, 1, 0, 0},
+    {5653, 6, 1, 0, 0},
+    {18470, 4, 1, 0, 0},
+    {18474, 3, 1, 0, 0},
+    {5739, 10, 1, 0, 0},
+    {18477, 17, 1, 0, 0},
+    {18494, 10, 1, 0, 0},
+    {18504, 5, 1, 0, 0},
+    {18509, 7, 1, 0, 0},
+    {5778, 7, 1, 0, 0},
+    {18516, 4, 1, 0, 0},
+    {18520, 11, 1, 0, 0},
+    {18531, 8, 1, 0, 0},
+    {12484, 6, 1, 0, 0},
+    {18539, 5, 1, 0, 0},
+    {5902, 4, 1, 0, 0},
+    {18544, 9, 1, 0, 0},
+    {18553, 4, 1, 0, 0},
+    {18557, 7, 1, 0, 0},
+    {5984, 5, 1, 0, 0},
+    {18564, 7, 1, 0, 0},
+    {18571, 5, 1, 0, 0},
+    {18576, 3, 1, 0, 0},
+    {18579, 8, 1, 0, 0},
+    {6040, 10, 1, 0, 0},
+    {18587, 3, 1, 0, 0},
+    {18590, 10, 1, 0, 0},
+    {18600, 6, 1, 0, 0},
+    {18606, 15, 1, 0, 0},
+    {18621, 9, 1, 0, 0},
+    {18630, 16, 1, 0, 0},
+    {18646, 8, 1, 0, 0},
+    {18654, 9, 1, 0, 0},
+    {18663, 7, 1, 0, 0},
+    {18670, 15, 1, 0, 0},
+    {18685, 4, 1, 0, 0},
+    {18689, 4, 1, 0, 0},
+    {18693, 6, 1, 0, 0},
+    {18699, 6, 1, 0, 0},
+    {18705, 10, 1, 0, 0},
+    {6146, 6, 1, 0, 0},
+    {18715, 7, 1, 0, 0},
+    {18722, 8, 1, 0, 0},
+    {18730, 7, 1, 0, 0},
+    {18737, 7, 1, 0, 0},
+    {6188, 10, 1, 0, 0},
+    {18744, 11, 1, 0, 0},
+    {6248, 5, 1, 0, 0},
+    {18755, 8, 1, 0, 0},
+    {18763, 3, 1, 0, 0},
+    {18766, 12, 1, 0, 0},
+    {18778, 15, 1, 0, 0},
+    {18793, 13, 1, 0, 0},
+    {18806, 7, 1, 0, 0},
+    {18813, 9, 1, 0, 0},
+    {18822, 7, 1, 0, 0},
+    {18829, 8, 1, 0, 0},
+    {18837, 12, 1, 0, 0},
+    {18849, 8, 1, 0, 0},
+    {18857, 8, 1, 0, 0},
+    {18865, 14, 1, 0, 0},
+    {18879, 20, 1, 0, 0},
+    {18899, 36, 1, 0, 0},
+    {18935, 10, 1, 0, 0},
+    {18945, 11, 1, 0, 0},
+    {18956, 4, 1, 0, 0},
+    {18960, 9, 1, 0, 0},
+    {18969, 8, 1, 0, 0},
+    {18977, 5, 1, 0, 0},
+    {18982, 10, 1, 0, 0},
+    {18992, 7, 1, 0, 0},
+    {112, 4, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4051, 6, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {4051, 6, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {9540, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {947, 2, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10608, 2, 1, 0, 0},
+    {3006, 2, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4072, 2, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {5181, 6, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {6059, 2, 1, 0, 0},
+    {6434, 2, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {10135, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {18999, 5, 1, 0, 0},
+    {14775, 3, 1, 0, 0},
+    {9891, 3, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9242, 1, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {3006, 2, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {19004, 2, 1, 1, 7135},
+    {19006, 8, 1, 0, 0},
+    {19014, 6, 1, 0, 0},
+    {19020, 6, 1, 0, 0},
+    {19026, 7, 1, 0, 0},
+    {10085, 2, 1, 1, 7136},
+    {19033, 8, 0, 1, 7137},
+    {19041, 10, 1, 0, 0},
+    {19051, 8, 1, 0, 0},
+    {176, 2, 1, 0, 0},
+    {19059, 9, 1, 0, 0},
+    {19068, 7, 1, 0, 0},
+    {19075, 6, 1, 0, 0},
+    {19081, 9, 1, 0, 0},
+    {19090, 4, 1, 0, 0},
+    {19094, 6, 1, 0, 0},
+    {19100, 4, 1, 0, 0},
+    {19104, 4, 1, 0, 0},
+    {19108, 9, 1, 0, 0},
+    {19117, 6, 1, 0, 0},
+    {19123, 5, 1, 0, 0},
+    {19128, 5, 1, 0, 0},
+    {19133, 7, 1, 0, 0},
+    {19140, 7, 1, 0, 0},
+    {19147, 4, 1, 0, 0},
+    {19151, 6, 1, 0, 0},
+    {19157, 5, 1, 0, 0},
+    {19162, 5, 1, 0, 0},
+    {19167, 5, 1, 0, 0},
+    {19172, 7, 1, 0, 0},
+    {19179, 5, 1, 0, 0},
+    {19184, 9, 1, 0, 0},
+    {19193, 5, 1, 0, 0},
+    {19198, 4, 1, 0, 0},
+    {19202, 7, 1, 0, 0},
+    {19209, 14, 1, 0, 0},
+    {19223, 9, 1, 0, 0},
+    {19232, 9, 1, 0, 0},
+    {19241, 6, 1, 0, 0},
+    {19247, 8, 1, 0, 0},
+    {19255, 11, 1, 0, 0},
+    {19266, 12, 1, 0, 0},
+    {19278, 6, 1, 0, 0},
+    {19284, 7, 1, 0, 0},
+    {19291, 5, 1, 0, 0},
+    {19296, 10, 1, 0, 0},
+    {19306, 9, 1, 0, 0},
+    {19315, 9, 1, 0, 0},
+    {19324, 6, 1, 0, 0},
+    {19330, 5, 1, 0, 0},
+    {19335, 5, 1, 0, 0},
+    {19340, 9, 1, 0, 0},
+    {19349, 11, 1, 0, 0},
+    {19360, 6, 1, 0, 0},
+    {19366, 6, 1, 0, 0},
+    {19372, 4, 1, 0, 0},
+    {19376, 6, 1, 0, 0},
+    {19382, 8, 1, 0, 0},
+    {19390, 6, 1, 0, 0},
+    {19396, 6, 1, 0, 0},
+    {19402, 8, 1, 0, 0},
+    {19410, 7, 1, 0, 0},
+    {19417, 9, 1, 0, 0},
+    {19426, 5, 1, 0, 0},
+    {19431, 4, 1, 0, 0},
+    {19435, 4, 1, 0, 0},
+    {19439, 5, 1, 0, 0},
+    {19444, 9, 1, 0, 0},
+    {19453, 7, 1, 0, 0},
+    {19460, 11, 1, 0, 0},
+    {19471, 10, 1, 0, 0},
+    {19481, 5, 1, 0, 0},
+    {19486, 2, 1, 1, 7138},
+    {19488, 7, 1, 0, 0},
+    {19495, 8, 0, 1, 7139},
+    {19503, 7, 1, 0, 0},
+    {19510, 5, 1, 0, 0},
+    {19515, 10, 1, 0, 0},
+    {19525, 11, 1, 0, 0},
+    {19536, 10, 1, 0, 0},
+    {19546, 6, 1, 0, 0},
+    {19552, 3, 1, 0, 0},
+    {19555, 13, 1, 0, 0},
+    {19568, 12, 1, 0, 0},
+    {19580, 13, 1, 0, 0},
+    {19593, 5, 1, 0, 0},
+    {19598, 5, 1, 0, 0},
+    {19603, 7, 1, 0, 0},
+    {19610, 9, 1, 0, 0},
+    {19619, 6, 1, 0, 0},
+    {19625, 5, 1, 0, 0},
+    {19630, 8, 1, 0, 0},
+    {19638, 3, 1, 0, 0},
+    {19641, 8, 1, 0, 0},
+    {19649, 8, 1, 0, 0},
+    {19657, 7, 1, 0, 0},
+    {19664, 8, 1, 0, 0},
+    {19672, 9, 1, 0, 0},
+    {19681, 7, 1, 0, 0},
+    {19688, 7, 1, 0, 0},
+    {19695, 8, 1, 0, 0},
+    {19703, 4, 1, 0, 0},
+    {19707, 7, 1, 0, 0},
+    {19714, 8, 1, 0, 0},
+    {19722, 6, 1, 0, 0},
+    {19728, 15, 1, 0, 0},
+    {19743, 7, 1, 0, 0},
+    {19750, 6, 1, 0, 0},
+    {19756, 5, 1, 0, 0},
+    {19761, 3, 1, 0, 0},
+    {19764, 7, 1, 0, 0},
+    {19771, 3, 1, 0, 0},
+    {19774, 6, 1, 0, 0},
+    {19780, 6, 1, 0, 0},
+    {19786, 6, 1, 0, 0},
+    {19792, 5, 1, 0, 0},
+    {19797, 3, 1, 0, 0},
+    {19800, 8, 1, 0, 0},
+    {19808, 9, 1, 0, 0},
+    {19817, 11, 1, 0, 0},
+    {19828, 8, 1, 0, 0},
+    {19836, 5, 1, 0, 0},
+    {19841, 5, 1, 0, 0},
+    {2258, 2, 1, 1, 7140},
+    {19846, 9, 1, 0, 0},
+    {19855, 7, 1, 0, 0},
+    {19862, 5, 1, 0, 0},
+    {19867, 7, 1, 0, 0},
+    {19874, 6, 1, 0, 0},
+    {19880, 5, 1, 0, 0},
+    {19885, 11, 1, 0, 0},
+    {19896, 4, 1, 0, 0},
+    {19900, 5, 1, 0, 0},
+    {19905, 7, 1, 0, 0},
+    {19912, 6, 1, 0, 0},
+    {19918, 5, 1, 0, 0},
+    {19923, 7, 1, 0, 0},
+    {19930, 7, 1, 0, 0},
+    {19937, 4, 1, 0, 0},
+    {19941, 10, 1, 0, 0},
+    {19951, 8, 1, 0, 0},
+    {19959, 9, 1, 0, 0},
+    {19968, 5, 1, 0, 0},
+    {19973, 6, 1, 0, 0},
+    {19979, 10, 1, 0, 0},
+    {19989, 6, 1, 0, 0},
+    {19995, 7, 1, 0, 0},
+    {20002, 13, 1, 0, 0},
+    {20015, 9, 1, 0, 0},
+    {20024, 5, 1, 0, 0},
+    {20029, 7, 1, 0, 0},
+    {20036, 8, 1, 0, 0},
+    {20044, 8, 1, 0, 0},
+    {20052, 7, 1, 0, 0},
+    {20059, 6, 1, 0, 0},
+    {20065, 7, 1, 0, 0},
+    {20072, 3, 1, 0, 0},
+    {20075, 4, 1, 0, 0},
+    {20079, 5, 1, 0, 0},
+    {20084, 7, 1, 0, 0},
+    {20091, 9, 1, 0, 0},
+    {20100, 8, 1, 0, 0},
+    {20108, 5, 1, 0, 0},
+    {20113, 4, 1, 0, 0},
+    {20117, 5, 1, 0, 0},
+    {20122, 13, 1, 0, 0},
+    {10093, 2, 1, 0, 0},
+    {20135, 6, 1, 0, 0},
+    {20141, 6, 1, 0, 0},
+    {20147, 10, 1, 0, 0},
+    {20157, 6, 1, 0, 0},
+    {20163, 5, 1, 0, 0},
+    {20168, 5, 1, 0, 0},
+    {20173, 7, 1, 0, 0},
+    {20180, 12, 1, 0, 0},
+    {20192, 10, 1, 0, 0},
+    {20202, 6, 1, 0, 0},
+    {20208, 5, 1, 0, 0},
+    {20213, 6, 1, 0, 0},
+    {20219, 7, 1, 0, 0},
+    {20226, 6, 1, 0, 0},
+    {20232, 12, 1, 0, 0},
+    {20244, 9, 1, 0, 0},
+    {20253, 7, 0, 3, 7141},
+    {20260, 5, 1, 0, 0},
+    {20265, 6, 1, 0, 0},
+    {20271, 8, 1, 0, 0},
+    {20279, 5, 1, 0, 0},
+    {20284, 5, 1, 0, 0},
+    {20289, 8, 1, 0, 0},
+    {20297, 10, 1, 0, 0},
+    {10101, 2, 1, 1, 7144},
+    {2804, 2, 1, 1, 7145},
+    {20307, 5, 1, 0, 0},
+    {20312, 3, 1, 0, 0},
+    {20315, 8, 1, 0, 0},
+    {20323, 3, 1, 0, 0},
+    {20326, 4, 1, 0, 0},
+    {20330, 11, 1, 0, 0},
+    {20341, 8, 1, 0, 0},
+    {20349, 8, 1, 0, 0},
+    {20357, 9, 0, 1, 7146},
+    {20366, 9, 1, 0, 0},
+    {20375, 6, 1, 0, 0},
+    {20381, 8, 1, 0, 0},
+    {20389, 9, 1, 0, 0},
+    {20398, 6, 1, 0, 0},
+    {20404, 5, 1, 0, 0},
+    {20409, 6, 1, 0, 0},
+    {20415, 9, 1, 0, 0},
+    {20424, 7, 1, 0, 0},
+    {20431, 6, 1, 0, 0},
+    {20437, 7, 1, 0, 0},
+    {20444, 7, 1, 0, 0},
+    {20451, 4, 1, 0, 0},
+    {20455, 9, 1, 1, 7147},
+    {20464, 8, 1, 0, 0},
+    {20472, 8, 1, 0, 0},
+    {20480, 7, 1, 0, 0},
+    {20487, 6, 1, 0, 0},
+    {20493, 9, 1, 0, 0},
+    {20502, 7, 1, 0, 0},
+    {20509, 10, 1, 0, 0},
+    {20519, 8, 1, 0, 0},
+    {20527, 7, 1, 0, 0},
+    {20534, 6, 1, 0, 0},
+    {20540, 10, 1, 0, 0},
+    {20550, 8, 1, 0, 0},
+    {20558, 5, 1, 0, 0},
+    {20563, 5, 1, 0, 0},
+    {20568, 7, 1, 0, 0},
+    {20575, 9, 1, 0, 0},
+    {20584, 11, 1, 0, 0},
+    {20595, 8, 1, 0, 0},
+    {20603, 9, 1, 0, 0},
+    {20612, 7, 1, 0, 0},
+    {20619, 12, 1, 0, 0},
+    {20631, 12, 1, 0, 0},
+    {20643, 10, 1, 0, 0},
+    {20653, 12, 1, 0, 0},
+    {20665, 8, 1, 0, 0},
+    {20673, 8, 1, 0, 0},
+    {20681, 4, 1, 0, 0},
+    {20685, 9, 1, 0, 0},
+    {20694, 9, 1, 0, 0},
+    {20703, 10, 1, 0, 0},
+    {20713, 9, 1, 0, 0},
+    {20722, 7, 1, 0, 0},
+    {20729, 12, 1, 0, 0},
+    {20741, 6, 1, 0, 0},
+    {20747, 8, 1, 0, 0},
+    {20755, 6, 1, 0, 0},
+    {20761, 6, 1, 0, 0},
+    {20767, 7, 1, 0, 0},
+    {20774, 8, 1, 0, 0},
+    {20782, 11, 1, 0, 0},
+    {20793, 7, 1, 0, 0},
+    {20800, 9, 1, 0, 0},
+    {20809, 9, 1, 0, 0},
+    {20818, 7, 1, 0, 0},
+    {20825, 4, 1, 0, 0},
+    {20829, 7, 1, 0, 0},
+    {20836, 6, 1, 0, 0},
+    {20842, 6, 1, 0, 0},
+    {20848, 5, 1, 0, 0},
+    {20853, 8, 1, 0, 0},
+    {20861, 4, 1, 0, 0},
+    {20865, 6, 1, 0, 0},
+    {20871, 11, 1, 0, 0},
+    {20882, 9, 1, 0, 0},
+    {20891, 6, 1, 0, 0},
+    {20897, 9, 1, 0, 0},
+    {20906, 6, 1, 0, 0},
+    {20912, 8, 1, 0, 0},
+    {11799, 3, 1, 0, 0},
+    {20920, 5, 1, 0, 0},
+    {20925, 9, 1, 0, 0},
+    {20934, 5, 1, 0, 0},
+    {20939, 4, 1, 0, 0},
+    {20943, 6, 1, 0, 0},
+    {20949, 5, 1, 0, 0},
+    {20954, 6, 1, 0, 0},
+    {20960, 7, 1, 0, 0},
+    {20967, 6, 1, 0, 0},
+    {20973, 11, 1, 0, 0},
+    {20984, 7, 1, 0, 0},
+    {20991, 6, 1, 0, 0},
+    {20997, 6, 1, 0, 0},
+    {21003, 6, 1, 0, 0},
+    {21009, 9, 1, 0, 0},
+    {21018, 10, 1, 0, 0},
+    {21028, 5, 1, 0, 0},
+    {21033, 13, 1, 0, 0},
+    {21046, 6, 1, 0, 0},
+    {21052, 6, 1, 0, 0},
+    {21058, 6, 1, 0, 0},
+    {21064, 5, 1, 0, 0},
+    {21069, 7, 1, 0, 0},
+    {21076, 7, 1, 0, 0},
+    {21083, 14, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {21097, 9, 1, 0, 0},
+    {21106, 9, 1, 0, 0},
+    {21115, 7, 1, 0, 0},
+    {21122, 7, 1, 0, 0},
+    {21129, 5, 1, 0, 0},
+    {21134, 5, 1, 0, 0},
+    {21139, 15, 0, 2, 7148},
+    {21154, 7, 1, 0, 0},
+    {21161, 8, 1, 0, 0},
+    {21169, 4, 1, 0, 0},
+    {21173, 6, 1, 0, 0},
+    {4034, 2, 1, 1, 7150},
+    {21179, 6, 1, 0, 0},
+    {4051, 6, 1, 0, 0},
+    {21185, 14, 1, 0, 0},
+    {21199, 10, 1, 0, 0},
+    {21209, 6, 1, 0, 0},
+    {21215, 10, 1, 0, 0},
+    {21225, 9, 1, 0, 0},
+    {21234, 5, 1, 0, 0},
+    {21239, 8, 1, 0, 0},
+    {21247, 6, 1, 0, 0},
+    {21253, 8, 1, 0, 0},
+    {21261, 8, 1, 0, 0},
+    {21269, 11, 1, 0, 0},
+    {21280, 5, 1, 0, 0},
+    {21285, 8, 1, 0, 0},
+    {21293, 12, 1, 0, 0},
+    {21305, 7, 1, 0, 0},
+    {21312, 6, 1, 0, 0},
+    {21318, 8, 1, 0, 0},
+    {21326, 8, 1, 0, 0},
+    {4215, 2, 1, 1, 7151},
+    {21334, 11, 1, 0, 0},
+    {21345, 9, 1, 0, 0},
+    {21354, 9, 1, 0, 0},
+    {21363, 7, 1, 0, 0},
+    {21370, 8, 1, 0, 0},
+    {21378, 8, 0, 4, 7152},
+    {21386, 11, 1, 0, 0},
+    {21397, 9, 1, 0, 0},
+    {21406, 13, 1, 0, 0},
+    {21419, 8, 1, 0, 0},
+    {21427, 8, 1, 0, 0},
+    {9207, 2, 1, 1, 7156},
+    {21435, 4, 1, 0, 0},
+    {10031, 2, 1, 1, 7157},
+    {21439, 6, 1, 0, 0},
+    {21445, 2, 1, 1, 7158},
+    {21447, 10, 1, 0, 0},
+    {21457, 6, 1, 0, 0},
+    {21463, 8, 1, 0, 0},
+    {21471, 8, 1, 0, 0},
+    {21479, 6, 1, 0, 0},
+    {21485, 6, 1, 0, 0},
+    {21491, 6, 1, 0, 0},
+    {21497, 5, 1, 0, 0},
+    {21502, 4, 1, 0, 0},
+    {21506, 4, 1, 1, 7159},
+    {21510, 6, 1, 0, 0},
+    {21516, 7, 1, 0, 0},
+    {21523, 7, 0, 1, 7160},
+    {21530, 11, 1, 0, 0},
+    {21541, 9, 1, 0, 0},
+    {21550, 10, 1, 0, 0},
+    {21560, 4, 1, 0, 0},
+    {21564, 8, 1, 0, 0},
+    {21572, 13, 1, 0, 0},
+    {21585, 9, 1, 0, 0},
+    {21594, 8, 1, 0, 0},
+    {21602, 9, 1, 0, 0},
+    {10545, 4, 1, 0, 0},
+    {21611, 4, 1, 0, 0},
+    {21615, 5, 1, 0, 0},
+    {21620, 11, 1, 0, 0},
+    {21631, 6, 1, 0, 0},
+    {21637, 5, 1, 0, 0},
+    {21642, 9, 1, 0, 0},
+    {21651, 8, 1, 0, 0},
+    {21659, 4, 1, 0, 0},
+    {21663, 9, 1, 0, 0},
+    {21672, 5, 1, 0, 0},
+    {21677, 8, 1, 0, 0},
+    {21685, 7, 1, 0, 0},
+    {21692, 8, 1, 0, 0},
+    {21700, 6, 1, 0, 0},
+    {21706, 7, 1, 0, 0},
+    {21713, 9, 1, 0, 0},
+    {21722, 9, 1, 0, 0},
+    {21731, 5, 1, 0, 0},
+    {21736, 5, 1, 0, 0},
+    {21741, 2, 1, 1, 7161},
+    {21743, 4, 1, 0, 0},
+    {21747, 5, 1, 0, 0},
+    {21752, 6, 1, 0, 0},
+    {21758, 5, 1, 0, 0},
+    {21763, 7, 1, 0, 0},
+    {21770, 5, 1, 0, 0},
+    {21775, 4, 1, 0, 0},
+    {21779, 6, 1, 0, 0},
+    {21785, 7, 1, 0, 0},
+    {21792, 6, 1, 0, 0},
+    {21798, 5, 1, 0, 0},
+    {21803, 8, 1, 0, 0},
+    {21811, 5, 1, 0, 0},
+    {21816, 7, 1, 0, 0},
+    {21823, 9, 1, 0, 0},
+    {21832, 10, 1, 0, 0},
+    {21842, 7, 1, 0, 0},
+    {21849, 12, 1, 0, 0},
+    {21861, 6, 1, 0, 0},
+    {21867, 9, 1, 0, 0},
+    {21876, 5, 1, 0, 0},
+    {21881, 8, 1, 0, 0},
+    {21889, 3, 1, 0, 0},
+    {21892, 5, 1, 0, 0},
+    {21897, 5, 1, 0, 0},
+    {21902, 7, 1, 0, 0},
+    {21909, 2, 1, 1, 7162},
+    {21911, 7, 1, 0, 0},
+    {21918, 6, 1, 0, 0},
+    {21924, 6, 1, 0, 0},
+    {21930, 6, 1, 0, 0},
+    {21936, 6, 1, 0, 0},
+    {21942, 8, 1, 0, 0},
+    {21950, 5, 1, 0, 0},
+    {21955, 7, 1, 0, 0},
+    {21962, 13, 1, 0, 0},
+    {5378, 3, 1, 0, 0},
+    {21975, 5, 1, 0, 0},
+    {21980, 7, 1, 0, 0},
+    {21987, 8, 1, 0, 0},
+    {21995, 5, 1, 0, 0},
+    {22000, 8, 1, 0, 0},
+    {22008, 6, 1, 0, 0},
+    {22014, 7, 1, 0, 0},
+    {22021, 5, 1, 0, 0},
+    {22026, 6, 1, 0, 0},
+    {22032, 5, 1, 0, 0},
+    {22037, 10, 1, 0, 0},
+    {22047, 6, 1, 0, 0},
+    {22053, 7, 1, 0, 0},
+    {22060, 5, 1, 0, 0},
+    {22065, 7, 1, 0, 0},
+    {22072, 4, 1, 0, 0},
+    {22076, 6, 1, 0, 0},
+    {22082, 5, 1, 0, 0},
+    {22087, 11, 1, 0, 0},
+    {22098, 9, 1, 0, 0},
+    {22107, 10, 1, 0, 0},
+    {22117, 8, 1, 0, 0},
+    {22125, 8, 1, 0, 0},
+    {22133, 12, 1, 0, 0},
+    {22145, 7, 1, 0, 0},
+    {22152, 8, 1, 0, 0},
+    {22160, 8, 1, 0, 0},
+    {22168, 5, 1, 0, 0},
+    {22173, 10, 1, 0, 0},
+    {22183, 9, 1, 0, 0},
+    {5501, 2, 1, 1, 7163},
+    {22192, 6, 1, 0, 0},
+    {22198, 4, 1, 0, 0},
+    {22202, 9, 1, 0, 0},
+    {22211, 9, 1, 0, 0},
+    {22220, 7, 1, 0, 0},
+    {22227, 7, 1, 0, 0},
+    {22234, 9, 1, 0, 0},
+    {22243, 8, 1, 0, 0},
+    {22251, 15, 1, 0, 0},
+    {22266, 6, 1, 0, 0},
+    {22272, 11, 1, 0, 0},
+    {22283, 5, 1, 0, 0},
+    {22288, 7, 1, 0, 0},
+    {22295, 9, 1, 0, 0},
+    {22304, 6, 1, 0, 0},
+    {22310, 7, 1, 0, 0},
+    {22317, 5, 1, 0, 0},
+    {22322, 4, 1, 0, 0},
+    {22326, 6, 1, 0, 0},
+    {22332, 4, 1, 0, 0},
+    {22336, 7, 1, 0, 0},
+    {22343, 8, 1, 0, 0},
+    {22351, 8, 1, 1, 7164},
+    {22359, 5, 1, 0, 0},
+    {22364, 7, 1, 0, 0},
+    {22371, 9, 1, 0, 0},
+    {22380, 4, 1, 0, 0},
+    {22384, 8, 1, 0, 0},
+    {22392, 8, 0, 2, 7165},
+    {18516, 4, 1, 0, 0},
+    {22400, 8, 1, 0, 0},
+    {22408, 4, 1, 0, 0},
+    {22412, 9, 1, 0, 0},
+    {22421, 5, 1, 0, 0},
+    {5851, 2, 1, 1, 7167},
+    {22426, 5, 1, 0, 0},
+    {22431, 5, 1, 0, 0},
+    {22436, 8, 1, 0, 0},
+    {22444, 7, 1, 0, 0},
+    {5916, 2, 1, 1, 7168},
+    {22451, 5, 1, 0, 0},
+    {22456, 6, 1, 0, 0},
+    {22462, 6, 1, 0, 0},
+    {22468, 8, 1, 0, 0},
+    {22476, 8, 1, 0, 0},
+    {22484, 6, 1, 0, 0},
+    {22490, 6, 1, 0, 0},
+    {22496, 9, 1, 0, 0},
+    {22505, 6, 1, 0, 0},
+    {22511, 11, 1, 0, 0},
+    {22522, 5, 1, 0, 0},
+    {22527, 6, 1, 0, 0},
+    {22533, 8, 1, 0, 0},
+    {22541, 6, 1, 0, 0},
+    {22547, 6, 1, 0, 0},
+    {22553, 10, 1, 0, 0},
+    {22563, 10, 1, 0, 0},
+    {22573, 5, 1, 0, 0},
+    {22578, 7, 1, 0, 0},
+    {22585, 6, 1, 0, 0},
+    {6065, 2, 1, 1, 7169},
+    {22591, 7, 1, 0, 0},
+    {22598, 5, 1, 0, 0},
+    {22603, 4, 1, 0, 0},
+    {22607, 5, 1, 0, 0},
+    {22612, 6, 1, 0, 0},
+    {22618, 7, 1, 0, 0},
+    {22625, 5, 1, 0, 0},
+    {22630, 4, 1, 0, 0},
+    {22634, 8, 1, 0, 0},
+    {22642, 5, 1, 0, 0},
+    {22647, 7, 1, 0, 0},
+    {22654, 5, 1, 0, 0},
+    {22659, 5, 1, 0, 0},
+    {22664, 4, 1, 0, 0},
+    {22668, 9, 1, 0, 0},
+    {22677, 8, 1, 0, 0},
+    {22685, 6, 1, 0, 0},
+    {22691, 6, 1, 0, 0},
+    {22697, 6, 1, 0, 0},
+    {22703, 8, 0, 1, 7170},
+    {22711, 7, 1, 0, 0},
+    {22718, 13, 1, 0, 0},
+    {22731, 12, 1, 0, 0},
+    {22743, 9, 1, 0, 0},
+    {22752, 9, 1, 0, 0},
+    {22761, 2, 1, 1, 7171},
+    {22763, 3, 1, 0, 0},
+    {22766, 3, 1, 0, 0},
+    {22769, 5, 1, 0, 0},
+    {22774, 10, 1, 0, 0},
+    {22784, 6, 1, 0, 0},
+    {22790, 5, 1, 0, 0},
+    {22795, 4, 1, 0, 0},
+    {22799, 11, 1, 0, 0},
+    {22810, 12, 1, 0, 0},
+    {22822, 12, 1, 0, 0},
+    {22834, 21, 1, 0, 0},
+    {22855, 13, 1, 0, 0},
+    {22868, 15, 1, 0, 0},
+    {22883, 18, 1, 0, 0},
+    {22901, 15, 1, 0, 0},
+    {22916, 18, 1, 0, 0},
+    {22934, 19, 1, 0, 0},
+    {22953, 13, 1, 0, 0},
+    {22966, 13, 1, 0, 0},
+    {22979, 14, 1, 0, 0},
+    {22993, 14, 1, 0, 0},
+    {23007, 12, 1, 0, 0},
+    {23019, 12, 1, 0, 0},
+    {23031, 11, 1, 0, 0},
+    {23042, 14, 1, 0, 0},
+    {23056, 18, 1, 0, 0},
+    {23074, 12, 1, 0, 0},
+    {23086, 16, 1, 0, 0},
+    {23102, 18, 1, 0, 0},
+    {23120, 12, 1, 0, 0},
+    {23132, 13, 1, 0, 0},
+    {23145, 12, 1, 0, 0},
+    {23157, 17, 1, 0, 0},
+    {23174, 13, 1, 0, 0},
+    {23187, 13, 1, 0, 0},
+    {23200, 10, 1, 0, 0},
+    {23210, 12, 1, 0, 0},
+    {23222, 12, 1, 0, 0},
+    {23234, 12, 1, 0, 0},
+    {23246, 12, 1, 0, 0},
+    {23258, 19, 1, 0, 0},
+    {23277, 16, 1, 0, 0},
+    {23293, 16, 1, 0, 0},
+    {23309, 13, 1, 0, 0},
+    {23322, 12, 1, 0, 0},
+    {23334, 9, 1, 0, 0},
+    {23343, 13, 1, 0, 0},
+    {23356, 19, 1, 0, 0},
+    {23375, 17, 1, 0, 0},
+    {23392, 19, 1, 0, 0},
+    {23411, 15, 1, 0, 0},
+    {23426, 12, 1, 0, 0},
+    {23438, 15, 1, 0, 0},
+    {23453, 13, 1, 0, 0},
+    {23466, 15, 1, 0, 0},
+    {23481, 16, 1, 0, 0},
+    {23497, 14, 1, 0, 0},
+    {23511, 14, 1, 0, 0},
+    {23525, 16, 1, 0, 0},
+    {23541, 13, 1, 0, 0},
+    {23554, 14, 1, 0, 0},
+    {23568, 12, 1, 0, 0},
+    {23580, 19, 1, 0, 0},
+    {23599, 14, 1, 0, 0},
+    {23613, 16, 1, 0, 0},
+    {23629, 17, 1, 0, 0},
+    {23646, 15, 1, 0, 0},
+    {23661, 19, 1, 0, 0},
+    {23680, 13, 1, 0, 0},
+    {23693, 15, 1, 0, 0},
+    {23708, 14, 1, 0, 0},
+    {23722, 16, 1, 0, 0},
+    {23738, 9, 1, 0, 0},
+    {23747, 16, 1, 0, 0},
+    {23763, 15, 1, 0, 0},
+    {23778, 15, 1, 0, 0},
+    {23793, 18, 1, 0, 0},
+    {23811, 14, 1, 0, 0},
+    {23825, 13, 1, 0, 0},
+    {23838, 13, 1, 0, 0},
+    {23851, 13, 1, 0, 0},
+    {23864, 13, 1, 0, 0},
+    {23877, 13, 1, 0, 0},
+    {23890, 16, 1, 0, 0},
+    {23906, 11, 1, 0, 0},
+    {23917, 12, 1, 0, 0},
+    {23929, 12, 1, 0, 0},
+    {23941, 12, 1, 0, 0},
+    {23953, 14, 1, 0, 0},
+    {23967, 16, 1, 0, 0},
+    {23983, 18, 1, 0, 0},
+    {24001, 11, 1, 0, 0},
+    {24012, 14, 1, 0, 0},
+    {24026, 14, 1, 0, 0},
+    {24040, 14, 1, 0, 0},
+    {24054, 11, 1, 0, 0},
+    {24065, 22, 0, 2, 7172},
+    {24087, 13, 1, 0, 0},
+    {24100, 20, 1, 0, 0},
+    {24120, 13, 1, 0, 0},
+    {24133, 21, 1, 0, 0},
+    {24154, 13, 1, 0, 0},
+    {24167, 15, 1, 0, 0},
+    {24182, 15, 1, 0, 0},
+    {24197, 15, 1, 0, 0},
+    {24212, 14, 1, 0, 0},
+    {24226, 13, 1, 0, 0},
+    {24239, 17, 1, 0, 0},
+    {24256, 12, 1, 0, 0},
+    {24268, 12, 1, 0, 0},
+    {24280, 11, 1, 0, 0},
+    {24291, 12, 1, 0, 0},
+    {24303, 15, 1, 0, 0},
+    {24318, 18, 1, 0, 0},
+    {24336, 13, 1, 0, 0},
+    {24349, 12, 1, 0, 0},
+    {24361, 12, 1, 0, 0},
+    {24373, 13, 1, 0, 0},
+    {24386, 15, 1, 0, 0},
+    {24401, 14, 1, 0, 0},
+    {24415, 12, 1, 0, 0},
+    {24427, 13, 1, 0, 0},
+    {24440, 11, 1, 0, 0},
+    {24451, 12, 1, 0, 0},
+    {24463, 13, 1, 0, 0},
+    {24476, 14, 1, 0, 0},
+    {24490, 9, 1, 0, 0},
+    {24499, 19, 1, 0, 0},
+    {24518, 13, 1, 0, 0},
+    {24531, 13, 1, 0, 0},
+    {24544, 12, 1, 0, 0},
+    {24556, 14, 1, 0, 0},
+    {24570, 15, 1, 0, 0},
+    {24585, 12, 1, 0, 0},
+    {24597, 13, 1, 0, 0},
+    {24610, 15, 1, 0, 0},
+    {24625, 12, 1, 0, 0},
+    {24637, 12, 1, 0, 0},
+    {24649, 12, 1, 0, 0},
+    {24661, 12, 1, 0, 0},
+    {24673, 13, 1, 0, 0},
+    {24686, 18, 1, 0, 0},
+    {24704, 12, 1, 0, 0},
+    {24716, 12, 1, 0, 0},
+    {24728, 17, 1, 0, 0},
+    {24745, 15, 1, 0, 0},
+    {24760, 15, 1, 0, 0},
+    {24775, 19, 1, 0, 0},
+    {24794, 14, 1, 0, 0},
+    {24808, 15, 1, 0, 0},
+    {24823, 12, 1, 0, 0},
+    {24835, 14, 0, 1, 7174},
+    {24849, 15, 1, 0, 0},
+    {24864, 22, 1, 0, 0},
+    {24886, 18, 1, 0, 0},
+    {24904, 12, 1, 0, 0},
+    {24916, 15, 1, 0, 0},
+    {24931, 13, 1, 0, 0},
+    {24944, 15, 1, 0, 0},
+    {24959, 12, 1, 0, 0},
+    {24971, 13, 1, 0, 0},
+    {24984, 13, 1, 0, 0},
+    {24997, 14, 1, 0, 0},
+    {25011, 12, 1, 0, 0},
+    {25023, 12, 1, 0, 0},
+    {25035, 16, 1, 0, 0},
+    {25051, 17, 1, 0, 0},
+    {25068, 11, 1, 0, 0},
+    {25079, 12, 1, 0, 0},
+    {25091, 14, 1, 0, 0},
+    {25105, 17, 1, 0, 0},
+    {25122, 14, 1, 0, 0},
+    {25136, 13, 1, 0, 0},
+    {25149, 11, 1, 0, 0},
+    {25160, 15, 1, 0, 0},
+    {25175, 20, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {9648, 3, 1, 0, 0},
+    {25195, 4, 1, 0, 0},
+    {10610, 3, 1, 0, 0},
+    {25199, 4, 1, 0, 0},
+    {2732, 6, 1, 0, 0},
+    {25203, 3, 1, 0, 0},
+    {3324, 4, 1, 0, 0},
+    {25206, 5, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {25211, 10, 1, 0, 0},
+    {5181, 6, 1, 0, 0},
+    {25221, 12, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4051, 6, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {25233, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {3033, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10154, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9242, 1, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4177, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {25236, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {25239, 3, 1, 0, 0},
+    {25242, 3, 1, 0, 0},
+    {2593, 3, 1, 0, 0},
+    {25245, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {9260, 4, 1, 0, 0},
+    {25248, 3, 1, 0, 0},
+    {25251, 3, 1, 0, 0},
+    {25254, 8, 1, 0, 0},
+    {459, 4, 1, 0, 0},
+    {25262, 10, 1, 0, 0},
+    {25272, 6, 1, 0, 0},
+    {25278, 7, 1, 0, 0},
+    {25285, 10, 1, 0, 0},
+    {25295, 9, 1, 0, 0},
+    {25304, 7, 1, 0, 0},
+    {25311, 10, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {25321, 11, 1, 0, 0},
+    {25332, 9, 1, 0, 0},
+    {25341, 5, 1, 0, 0},
+    {25346, 7, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {25353, 7, 1, 0, 0},
+    {25360, 5, 1, 0, 0},
+    {25365, 9, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {25374, 6, 1, 0, 0},
+    {25380, 3, 1, 0, 0},
+    {25383, 6, 1, 0, 0},
+    {25389, 5, 1, 0, 0},
+    {25394, 7, 1, 0, 0},
+    {25401, 7, 1, 0, 0},
+    {2599, 3, 1, 47, 7175},
+    {25408, 7, 1, 0, 0},
+    {25415, 3, 1, 0, 0},
+    {25418, 5, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {25423, 8, 1, 0, 0},
+    {25431, 12, 1, 0, 0},
+    {25443, 5, 1, 0, 0},
+    {25448, 6, 1, 0, 0},
+    {25454, 7, 1, 0, 0},
+    {25461, 7, 1, 0, 0},
+    {25468, 7, 1, 0, 0},
+    {25475, 8, 1, 0, 0},
+    {25483, 15, 1, 0, 0},
+    {25498, 5, 1, 0, 0},
+    {25503, 7, 1, 0, 0},
+    {25510, 7, 1, 0, 0},
+    {25517, 10, 1, 0, 0},
+    {25527, 9, 1, 0, 0},
+    {25536, 5, 1, 0, 0},
+    {25541, 10, 1, 0, 0},
+    {25551, 5, 1, 0, 0},
+    {25556, 4, 1, 0, 0},
+    {25560, 6, 1, 0, 0},
+    {25566, 7, 1, 0, 0},
+    {25573, 7, 1, 0, 0},
+    {25580, 8, 1, 0, 0},
+    {25588, 5, 1, 0, 0},
+    {25593, 6, 1, 0, 0},
+    {25599, 5, 1, 0, 0},
+    {25604, 5, 1, 0, 0},
+    {25609, 4, 1, 0, 0},
+    {25613, 7, 1, 0, 0},
+    {25620, 10, 1, 0, 0},
+    {25630, 8, 1, 0, 0},
+    {25638, 6, 1, 0, 0},
+    {3840, 5, 1, 0, 0},
+    {25644, 6, 1, 0, 0},
+    {25650, 6, 1, 0, 0},
+    {25656, 6, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {25662, 7, 1, 0, 0},
+    {25669, 5, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {25674, 13, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {25687, 8, 1, 0, 0},
+    {25695, 4, 1, 0, 0},
+    {25699, 5, 1, 0, 0},
+    {25704, 6, 1, 0, 0},
+    {25710, 6, 1, 0, 0},
+    {25716, 7, 1, 0, 0},
+    {25723, 7, 1, 0, 0},
+    {25730, 5, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {25735, 7, 1, 0, 0},
+    {25742, 9, 1, 0, 0},
+    {25751, 9, 1, 0, 0},
+    {25760, 10, 1, 0, 0},
+    {12125, 2, 1, 0, 0},
+    {25770, 4, 1, 0, 0},
+    {25774, 4, 1, 0, 0},
+    {25778, 7, 1, 0, 0},
+    {25785, 8, 1, 0, 0},
+    {25793, 9, 1, 0, 0},
+    {25802, 9, 1, 0, 0},
+    {25811, 7, 1, 0, 0},
+    {25818, 6, 1, 0, 0},
+    {10545, 4, 1, 0, 0},
+    {25824, 10, 1, 0, 0},
+    {25834, 8, 1, 0, 0},
+    {25842, 9, 1, 0, 0},
+    {25851, 6, 1, 0, 0},
+    {25857, 5, 1, 0, 0},
+    {25862, 8, 1, 0, 0},
+    {4804, 10, 1, 0, 0},
+    {10483, 3, 1, 0, 0},
+    {25870, 6, 1, 0, 0},
+    {25876, 7, 1, 0, 0},
+    {25883, 5, 1, 0, 0},
+    {25888, 5, 1, 0, 0},
+    {5270, 3, 1, 0, 0},
+    {5323, 4, 1, 0, 0},
+    {25893, 5, 1, 0, 0},
+    {25898, 7, 1, 0, 0},
+    {25905, 5, 1, 0, 0},
+    {25910, 6, 1, 0, 0},
+    {25916, 3, 1, 0, 0},
+    {25919, 9, 1, 0, 0},
+    {25928, 12, 1, 0, 0},
+    {25940, 12, 1, 0, 0},
+    {25952, 8, 1, 0, 0},
+    {25960, 7, 1, 0, 0},
+    {25967, 8, 1, 0, 0},
+    {25975, 10, 1, 0, 0},
+    {25985, 11, 1, 0, 0},
+    {25996, 8, 1, 0, 0},
+    {26004, 8, 1, 0, 0},
+    {26012, 6, 1, 0, 0},
+    {26018, 5, 1, 0, 0},
+    {26023, 10, 1, 0, 0},
+    {26033, 5, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {9307, 7, 1, 0, 0},
+    {5938, 6, 1, 0, 0},
+    {26038, 5, 1, 0, 0},
+    {26043, 9, 1, 0, 0},
+    {26052, 5, 1, 0, 0},
+    {26057, 5, 1, 0, 0},
+    {26062, 9, 1, 0, 0},
+    {26071, 6, 1, 0, 0},
+    {26077, 8, 1, 0, 0},
+    {26085, 3, 1, 0, 0},
+    {26088, 6, 1, 0, 0},
+    {26094, 6, 1, 0, 0},
+    {26100, 5, 1, 0, 0},
+    {26105, 9, 1, 0, 0},
+    {26114, 9, 1, 0, 0},
+    {26123, 7, 1, 0, 0},
+    {26130, 7, 1, 0, 0},
+    {26137, 9, 1, 0, 0},
+    {26146, 5, 1, 0, 0},
+    {26151, 5, 1, 0, 0},
+    {26156, 5, 1, 0, 0},
+    {26161, 9, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {26170, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {26173, 4, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {4695, 4, 1, 0, 0},
+    {0, 3, 1, 0, 0},
+    {26177, 3, 1, 0, 0},
+    {26180, 4, 1, 0, 0},
+    {10204, 6, 1, 0, 0},
+    {532, 3, 1, 0, 0},
+    {1504, 3, 1, 0, 0},
+    {9683, 3, 1, 0, 0},
+    {26184, 3, 1, 0, 0},
+    {3471, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {26187, 5, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26192, 3, 1, 0, 0},
+    {26195, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {10143, 4, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26198, 4, 1, 0, 0},
+    {26202, 5, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {9142, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {4108, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {10051, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {10135, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {9207, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9891, 3, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {10082, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3006, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4760, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3837, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {9234, 1, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {9235, 1, 1, 0, 0},
+    {628, 2, 1, 0, 0},
+    {26207, 5, 1, 0, 0},
+    {9236, 1, 1, 0, 0},
+    {9237, 1, 1, 0, 0},
+    {9238, 1, 1, 0, 0},
+    {9239, 1, 1, 0, 0},
+    {26212, 2, 1, 0, 0},
+    {26214, 4, 1, 0, 0},
+    {26218, 3, 1, 0, 0},
+    {9240, 1, 1, 0, 0},
+    {9241, 1, 1, 0, 0},
+    {9242, 1, 1, 0, 0},
+    {9244, 1, 1, 0, 0},
+    {26221, 7, 1, 0, 0},
+    {26228, 15, 1, 0, 0},
+    {26243, 6, 1, 0, 0},
+    {9245, 1, 1, 0, 0},
+    {26249, 6, 1, 0, 0},
+    {9246, 1, 1, 0, 0},
+    {9247, 1, 1, 0, 0},
+    {26255, 14, 1, 0, 0},
+    {9248, 1, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {9249, 1, 1, 0, 0},
+    {26269, 5, 1, 0, 0},
+    {9222, 2, 1, 0, 0},
+    {4667, 5, 1, 0, 0},
+    {9251, 1, 1, 0, 0},
+    {9252, 1, 1, 0, 0},
+    {9253, 1, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {9254, 1, 1, 0, 0},
+    {9256, 1, 1, 0, 0},
+    {9257, 1, 1, 0, 0},
+    {9258, 1, 1, 0, 0},
+    {9259, 1, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14775, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {377, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10057, 4, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10478, 5, 1, 0, 0},
+    {9314, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {26274, 9, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {26283, 9, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26292, 8, 1, 0, 0},
+    {26300, 7, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4834, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {3006, 2, 1, 0, 0},
+    {11922, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {10628, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26307, 4, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {26311, 3, 1, 0, 0},
+    {10163, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {9754, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {26314, 4, 1, 0, 0},
+    {26318, 6, 1, 0, 0},
+    {26324, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10478, 5, 1, 0, 0},
+    {9307, 7, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10846, 2, 1, 0, 0},
+    {26327, 3, 1, 0, 0},
+    {26330, 3, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10608, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10610, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {26333, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4106, 2, 1, 1, 7222},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10157, 3, 1, 0, 0},
+    {5749, 3, 1, 0, 0},
+    {26336, 3, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {112, 4, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1466, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3191, 4, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4051, 6, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {5938, 6, 1, 0, 0},
+    {1293, 4, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {26339, 4, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2422, 4, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {10356, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26343, 11, 1, 0, 0},
+    {10430, 10, 1, 0, 0},
+    {26354, 12, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {10513, 5, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {3946, 4, 1, 0, 0},
+    {4108, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {6011, 2, 1, 0, 0},
+    {26366, 9, 1, 0, 0},
+    {26375, 8, 1, 0, 0},
+    {26383, 9, 1, 0, 0},
+    {26392, 9, 1, 0, 0},
+    {26401, 10, 1, 0, 0},
+    {26411, 10, 1, 0, 0},
+    {1243, 2, 1, 0, 0},
+    {1306, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1507, 2, 1, 0, 0},
+    {26421, 6, 1, 0, 0},
+    {1576, 2, 1, 0, 0},
+    {26427, 2, 1, 0, 0},
+    {26429, 14, 1, 0, 0},
+    {26443, 14, 1, 0, 0},
+    {26457, 7, 1, 0, 0},
+    {26464, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {26466, 2, 1, 0, 0},
+    {3006, 2, 1, 0, 0},
+    {26468, 15, 1, 0, 0},
+    {3291, 2, 1, 0, 0},
+    {26483, 7, 1, 0, 0},
+    {26490, 7, 1, 0, 0},
+    {26497, 7, 1, 0, 0},
+    {26504, 12, 1, 0, 0},
+    {26516, 12, 1, 0, 0},
+    {26528, 4, 1, 0, 0},
+    {26532, 10, 1, 0, 0},
+    {3328, 2, 1, 0, 0},
+    {3359, 2, 1, 0, 0},
+    {26542, 4, 1, 0, 0},
+    {26546, 2, 1, 0, 0},
+    {26548, 2, 1, 0, 0},
+    {26550, 4, 1, 0, 0},
+    {13974, 2, 1, 0, 0},
+    {3684, 2, 1, 0, 0},
+    {26554, 7, 1, 0, 0},
+    {26561, 5, 1, 0, 0},
+    {3713, 2, 1, 0, 0},
+    {26566, 4, 1, 0, 0},
+    {3927, 2, 1, 0, 0},
+    {26570, 8, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {26578, 8, 1, 0, 0},
+    {26586, 2, 1, 0, 0},
+    {26588, 5, 1, 0, 0},
+    {26593, 6, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4586, 2, 1, 0, 0},
+    {26599, 7, 1, 0, 0},
+    {26606, 5, 1, 0, 0},
+    {26611, 5, 1, 0, 0},
+    {26616, 2, 1, 0, 0},
+    {5136, 2, 1, 0, 0},
+    {26618, 10, 1, 0, 0},
+    {26628, 10, 1, 0, 0},
+    {5400, 2, 1, 0, 0},
+    {26638, 4, 1, 0, 0},
+    {12448, 2, 1, 0, 0},
+    {26642, 8, 1, 0, 0},
+    {6063, 2, 1, 0, 0},
+    {26650, 8, 1, 0, 0},
+    {26658, 7, 1, 0, 0},
+    {26665, 9, 1, 0, 0},
+    {6198, 2, 1, 0, 0},
+    {26674, 5, 1, 0, 0},
+    {26679, 5, 1, 0, 0},
+    {26684, 11, 1, 0, 0},
+    {26695, 12, 1, 0, 0},
+    {26707, 8, 1, 0, 0},
+    {26715, 8, 1, 0, 0},
+    {26723, 2, 1, 0, 0},
+    {26725, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {4108, 2, 1, 0, 0},
+    {9192, 2, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3686, 3, 1, 0, 0},
+    {3835, 2, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {26727, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {14785, 3, 1, 0, 0},
+    {26730, 6, 1, 0, 0},
+    {8516, 3, 2, 0, 0},
+    {26736, 2, 1, 3, 7223},
+    {176, 2, 1, 3, 7226},
+    {352, 2, 1, 3, 7229},
+    {384, 2, 1, 3, 7232},
+    {485, 2, 1, 3, 7235},
+    {947, 2, 1, 3, 7238},
+    {1308, 2, 1, 3, 7241},
+    {11313, 2, 1, 3, 7244},
+    {26738, 2, 1, 3, 7247},
+    {1638, 2, 1, 2, 7250},
+    {26740, 3, 1, 0, 0},
+    {26743, 3, 1, 0, 0},
+    {26746, 2, 1, 3, 7252},
+    {2399, 2, 1, 3, 7255},
+    {2656, 2, 1, 3, 7258},
+    {10099, 2, 1, 2, 7261},
+    {26748, 2, 1, 3, 7263},
+    {2962, 2, 1, 3, 7266},
+    {2978, 2, 1, 3, 7269},
+    {3006, 2, 1, 3, 7272},
+    {26750, 3, 1, 0, 0},
+    {3298, 4, 1, 0, 0},
+    {26546, 2, 1, 3, 7275},
+    {3379, 2, 1, 3, 7278},
+    {3388, 2, 1, 3, 7281},
+    {3717, 2, 1, 3, 7284},
+    {3833, 2, 1, 3, 7287},
+    {3835, 2, 1, 3, 7290},
+    {11922, 2, 1, 11, 7293},
+    {3942, 2, 1, 3, 7304},
+    {3944, 2, 1, 3, 7307},
+    {4036, 2, 1, 3, 7310},
+    {4041, 2, 1, 3, 7313},
+    {4106, 2, 1, 3, 7316},
+    {26753, 2, 1, 2, 7319},
+    {4108, 2, 1, 3, 7321},
+    {26755, 2, 1, 3, 7324},
+    {26757, 2, 1, 3, 7327},
+    {10111, 2, 1, 3, 7330},
+    {26759, 3, 1, 0, 0},
+    {26762, 2, 1, 3, 7333},
+    {26764, 2, 1, 3, 7336},
+    {26766, 2, 1, 3, 7339},
+    {26768, 2, 1, 3, 7342},
+    {9192, 2, 1, 3, 7345},
+    {4414, 2, 1, 3, 7348},
+    {4651, 2, 1, 3, 7351},
+    {12319, 2, 1, 2, 7354},
+    {5144, 2, 1, 3, 7356},
+    {5211, 2, 1, 2, 7359},
+    {5858, 2, 1, 3, 7361},
+    {26770, 2, 1, 3, 7364},
+    {26772, 2, 1, 3, 7367},
+    {6065, 2, 1, 3, 7370},
+    {6130, 2, 1, 3, 7373},
+    {13395, 2, 1, 3, 7376},
+    {9220, 2, 1, 3, 7379},
+    {26774, 2, 1, 3, 7382},
+    {26776, 2, 1, 1, 7385},
+    {26778, 2, 1, 3, 7386},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {26780, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {10135, 4, 1, 0, 0},
+    {9584, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {26783, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {10139, 4, 1, 0, 0},
+    {9150, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26786, 3, 1, 0, 0},
+    {9891, 3, 1, 0, 0},
+    {5564, 5, 1, 0, 0},
+    {10003, 3, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {2732, 6, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3063, 3, 1, 0, 0},
+    {4089, 4, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {4677, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26789, 13, 1, 0, 0},
+    {26802, 11, 1, 0, 0},
+    {26813, 10, 1, 0, 0},
+    {26823, 11, 1, 0, 0},
+    {26834, 8, 1, 0, 0},
+    {26842, 9, 1, 0, 0},
+    {6889, 9, 1, 0, 0},
+    {26851, 8, 1, 0, 0},
+    {26859, 8, 1, 0, 0},
+    {26867, 9, 1, 0, 0},
+    {6667, 10, 1, 0, 0},
+    {10379, 10, 1, 0, 0},
+    {7883, 10, 1, 0, 0},
+    {10119, 10, 1, 0, 0},
+    {10430, 10, 1, 0, 0},
+    {10451, 11, 1, 0, 0},
+    {26876, 13, 1, 0, 0},
+    {26889, 15, 1, 0, 0},
+    {26904, 16, 1, 0, 0},
+    {26920, 13, 1, 0, 0},
+    {26933, 12, 1, 0, 0},
+    {26945, 11, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {26956, 5, 1, 0, 0},
+    {26961, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {26964, 7, 1, 0, 0},
+    {3471, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4177, 3, 1, 0, 0},
+    {10628, 3, 1, 0, 0},
+    {26971, 3, 1, 0, 0},
+    {8513, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {5181, 6, 1, 0, 0},
+    {5851, 2, 1, 0, 0},
+    {9528, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {712, 3, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {1340, 3, 1, 0, 0},
+    {1880, 3, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3029, 4, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4113, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {8516, 3, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {1308, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {3903, 3, 1, 0, 0},
+    {4380, 3, 1, 0, 0},
+    {26974, 3, 1, 0, 0},
+    {9194, 3, 1, 0, 0},
+    {1082, 8, 1, 0, 0},
+    {9204, 3, 1, 1, 7389},
+    {9207, 2, 1, 0, 0},
+    {9211, 3, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {9214, 3, 1, 0, 0},
+    {9217, 3, 1, 0, 0},
+    {9220, 2, 1, 0, 0},
+    {9211, 3, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {9214, 3, 1, 0, 0},
+    {9217, 3, 1, 0, 0},
+    {9220, 2, 1, 0, 0},
+    {50, 2, 1, 0, 0},
+    {176, 2, 1, 0, 0},
+    {233, 2, 1, 0, 0},
+    {10803, 2, 1, 0, 0},
+    {492, 2, 1, 0, 0},
+    {11257, 2, 1, 0, 0},
+    {26977, 2, 1, 0, 0},
+    {1971, 2, 1, 0, 0},
+    {10055, 2, 1, 0, 0},
+    {3717, 2, 1, 0, 0},
+    {3885, 2, 1, 0, 0},
+    {4036, 2, 1, 0, 0},
+    {4041, 2, 1, 0, 0},
+    {4414, 2, 1, 0, 0},
+    {9148, 2, 1, 0, 0},
+    {4472, 2, 1, 0, 0},
+    {12168, 2, 1, 0, 0},
+    {4651, 2, 1, 0, 0},
+    {26979, 2, 1, 0, 0},
+    {12334, 2, 1, 0, 0},
+    {4981, 2, 1, 0, 0},
+    {26981, 2, 1, 0, 0},
+    {5009, 2, 1, 0, 0},
+    {5144, 2, 1, 0, 0},
+    {5213, 2, 1, 0, 0},
+    {12425, 2, 1, 0, 0},
+    {5860, 2, 1, 0, 0},
+    {3686, 3, 1, 0, 0},
+    {14785, 3, 1, 0, 0},
+    {26983, 5, 1, 0, 0},
+    {26988, 3, 1, 0, 0},
+    {26991, 4, 1, 0, 0},
+    {26995, 5, 1, 0, 0},
+    {27000, 6, 1, 0, 0},
+    {27006, 5, 1, 0, 0},
+    {27011, 4, 1, 0, 0},
+    {27015, 8, 1, 0, 0},
+    {27023, 5, 1, 0, 0},
+    {27028, 4, 1, 0, 0},
+    {27032, 7, 1, 0, 0},
+    {27039, 10, 1, 0, 0},
+    {27049, 10, 1, 0, 0},
+    {27059, 7, 1, 0, 0},
+    {27066, 7, 1, 0, 0},
+    {27073, 7, 1, 0, 0},
+    {27080, 7, 1, 0, 0},
+    {27087, 5, 1, 0, 0},
+    {27092, 6, 1, 0, 0},
+    {27098, 7, 1, 0, 0},
+    {27105, 4, 1, 0, 0},
+    {27109, 6, 1, 0, 0},
+    {27115, 6, 1, 0, 0},
+    {27121, 5, 1, 0, 0},
+    {27126, 4, 1, 0, 0},
+    {27130, 6, 1, 0, 0},
+    {27136, 7, 1, 0, 0},
+    {27143, 6, 1, 0, 0},
+    {27149, 7, 1, 0, 0},
+    {27156, 3, 1, 0, 0},
+    {27159, 6, 1, 0, 0},
+    {27165, 5, 1, 0, 0},
+    {27170, 7, 1, 0, 0},
+    {27177, 10, 1, 0, 0},
+    {27187, 4, 1, 0, 0},
+    {27191, 8, 1, 0, 0},
+    {27199, 9, 1, 0, 0},
+    {27208, 7, 1, 0, 0},
+    {27215, 6, 1, 0, 0},
+    {27221, 8, 1, 0, 0},
+    {27229, 9, 1, 0, 0},
+    {27238, 4, 1, 0, 0},
+    {27242, 4, 1, 0, 0},
+    {27246, 5, 1, 0, 0},
+    {27251, 8, 1, 0, 0},
+    {27259, 7, 1, 0, 0},
+    {27266, 9, 1, 0, 0},
+    {27275, 8, 1, 0, 0},
+    {27283, 6, 1, 0, 0},
+    {5906, 6, 1, 0, 0},
+    {27289, 8, 1, 0, 0},
+    {27297, 6, 1, 0, 0},
+    {13823, 5, 1, 0, 0},
+    {27303, 6, 1, 0, 0},
+    {27309, 8, 1, 0, 0},
+    {27317, 6, 1, 0, 0},
+    {27323, 11, 1, 0, 0},
+    {27334, 6, 1, 0, 0},
+    {27340, 13, 1, 0, 0},
+    {27353, 5, 1, 0, 0},
+    {27358, 6, 1, 0, 0},
+    {27364, 5, 1, 0, 0},
+    {27369, 9, 1, 0, 0},
+    {27378, 7, 1, 0, 0},
+    {27385, 8, 1, 0, 0},
+    {27393, 6, 1, 0, 0},
+    {27399, 9, 1, 0, 0},
+    {27408, 6, 1, 0, 0},
+    {27414, 5, 1, 0, 0},
+    {27419, 6, 1, 0, 0},
+    {27425, 6, 1, 0, 0},
+    {27431, 9, 1, 0, 0},
+    {27440, 6, 1, 0, 0},
+    {27446, 7, 1, 0, 0},
+    {27453, 5, 1, 0, 0},
+    {27458, 3, 1, 0, 0},
+    {27461, 5, 1, 0, 0},
+    {27466, 7, 1, 0, 0},
+    {27473, 6, 1, 0, 0},
+    {27479, 9, 1, 0, 0},
+    {13828, 6, 1, 0, 0},
+    {27488, 6, 1, 0, 0},
+    {27494, 9, 1, 0, 0},
+    {27503, 9, 1, 0, 0},
+    {27512, 7, 1, 0, 0},
+    {27519, 8, 1, 0, 0},
+    {27527, 9, 1, 0, 0},
+    {27536, 8, 1, 0, 0},
+    {27544, 6, 1, 0, 0},
+    {27550, 5, 1, 0, 0},
+    {27555, 10, 1, 0, 0},
+    {27565, 6, 1, 0, 0},
+    {27571, 6, 1, 0, 0},
+    {27577, 5, 1, 0, 0},
+    {27582, 8, 1, 0, 0},
+    {27590, 7, 1, 0, 0},
+    {27597, 10, 1, 0, 0},
+    {27607, 6, 1, 0, 0},
+    {27613, 5, 1, 0, 0},
+    {27618, 6, 1, 0, 0},
+    {27624, 7, 1, 0, 0},
+    {27631, 7, 1, 0, 0},
+    {27638, 5, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {27648, 6, 1, 0, 0},
+    {27654, 6, 1, 0, 0},
+    {27660, 6, 1, 0, 0},
+    {27666, 4, 1, 0, 0},
+    {27670, 9, 1, 0, 0},
+    {27679, 6, 1, 0, 0},
+    {27685, 10, 1, 0, 0},
+    {27695, 8, 1, 0, 0},
+    {27703, 8, 1, 0, 0},
+    {27049, 10, 1, 0, 0},
+    {27711, 5, 1, 0, 0},
+    {27716, 5, 1, 0, 0},
+    {27721, 8, 1, 0, 0},
+    {27729, 8, 1, 0, 0},
+    {27737, 7, 1, 0, 0},
+    {27744, 6, 1, 0, 0},
+    {27750, 8, 1, 0, 0},
+    {27758, 7, 1, 0, 0},
+    {27765, 8, 1, 0, 0},
+    {27773, 6, 1, 0, 0},
+    {27779, 8, 1, 0, 0},
+    {27787, 6, 1, 0, 0},
+    {27793, 7, 1, 0, 0},
+    {27800, 6, 1, 0, 0},
+    {27130, 6, 1, 0, 0},
+    {27806, 10, 1, 0, 0},
+    {27816, 6, 1, 0, 0},
+    {27822, 9, 1, 0, 0},
+    {27831, 6, 1, 0, 0},
+    {27837, 10, 1, 0, 0},
+    {27847, 9, 1, 0, 0},
+    {27856, 6, 1, 0, 0},
+    {27862, 4, 1, 0, 0},
+    {27866, 13, 1, 0, 0},
+    {27879, 7, 1, 0, 0},
+    {27886, 6, 1, 0, 0},
+    {27892, 5, 1, 0, 0},
+    {27897, 5, 1, 0, 0},
+    {5060, 6, 1, 0, 0},
+    {27902, 9, 1, 0, 0},
+    {27911, 7, 1, 0, 0},
+    {27918, 6, 1, 0, 0},
+    {27924, 6, 1, 0, 0},
+    {27930, 9, 1, 0, 0},
+    {27939, 4, 1, 0, 0},
+    {27943, 4, 1, 0, 0},
+    {27947, 8, 1, 0, 0},
+    {27955, 6, 1, 0, 0},
+    {27961, 8, 1, 0, 0},
+    {27969, 8, 1, 0, 0},
+    {27977, 7, 1, 0, 0},
+    {27984, 9, 1, 0, 0},
+    {27993, 7, 1, 0, 0},
+    {28000, 10, 1, 0, 0},
+    {28010, 15, 1, 0, 0},
+    {28025, 10, 1, 0, 0},
+    {28035, 5, 1, 0, 0},
+    {28040, 5, 1, 0, 0},
+    {28045, 5, 1, 0, 0},
+    {28050, 7, 1, 0, 0},
+    {28057, 3, 1, 0, 0},
+    {28060, 8, 1, 0, 0},
+    {28068, 6, 1, 0, 0},
+    {28074, 9, 1, 0, 0},
+    {28083, 6, 1, 0, 0},
+    {28089, 7, 1, 0, 0},
+    {28096, 9, 1, 0, 0},
+    {28105, 8, 1, 0, 0},
+    {28113, 7, 1, 0, 0},
+    {28120, 3, 1, 0, 0},
+    {28123, 5, 1, 0, 0},
+    {28128, 5, 1, 0, 0},
+    {28133, 11, 1, 0, 0},
+    {28144, 4, 1, 0, 0},
+    {28148, 4, 1, 0, 0},
+    {28152, 6, 1, 0, 0},
+    {28158, 7, 1, 0, 0},
+    {28165, 10, 1, 0, 0},
+    {28175, 7, 1, 0, 0},
+    {28182, 7, 1, 0, 0},
+    {13844, 5, 1, 0, 0},
+    {28189, 5, 1, 0, 0},
+    {28194, 9, 1, 0, 0},
+    {27130, 6, 1, 0, 0},
+    {28203, 13, 1, 0, 0},
+    {28216, 5, 1, 0, 0},
+    {28221, 3, 1, 0, 0},
+    {28224, 3, 1, 0, 0},
+    {28227, 5, 1, 0, 0},
+    {28232, 5, 1, 0, 0},
+    {27221, 8, 1, 0, 0},
+    {28237, 7, 1, 0, 0},
+    {28244, 6, 1, 0, 0},
+    {28250, 6, 1, 0, 0},
+    {28256, 5, 1, 0, 0},
+    {28261, 7, 1, 0, 0},
+    {28268, 7, 1, 0, 0},
+    {28275, 7, 1, 0, 0},
+    {28282, 10, 1, 0, 0},
+    {28292, 8, 1, 0, 0},
+    {27666, 4, 1, 0, 0},
+    {28300, 7, 1, 0, 0},
+    {28307, 7, 1, 0, 0},
+    {28314, 6, 1, 0, 0},
+    {28320, 7, 1, 0, 0},
+    {28327, 8, 1, 0, 0},
+    {28335, 8, 1, 0, 0},
+    {28343, 6, 1, 0, 0},
+    {28349, 8, 1, 0, 0},
+    {28357, 4, 1, 0, 0},
+    {28361, 6, 1, 0, 0},
+    {28367, 6, 1, 0, 0},
+    {28373, 6, 1, 0, 0},
+    {28379, 6, 1, 0, 0},
+    {28385, 4, 1, 0, 0},
+    {28389, 6, 1, 0, 0},
+    {28395, 6, 1, 0, 0},
+    {28401, 6, 1, 0, 0},
+    {28407, 6, 1, 0, 0},
+    {28413, 6, 1, 0, 0},
+    {28419, 6, 1, 0, 0},
+    {28425, 8, 1, 0, 0},
+    {28433, 8, 1, 0, 0},
+    {28441, 8, 1, 0, 0},
+    {28449, 8, 1, 0, 0},
+    {28457, 6, 1, 0, 0},
+    {28463, 5, 1, 0, 0},
+    {28468, 6, 1, 0, 0},
+    {28474, 5, 1, 0, 0},
+    {28479, 7, 1, 0, 0},
+    {28486, 5, 1, 0, 0},
+    {28491, 3, 1, 0, 0},
+    {28494, 5, 1, 0, 0},
+    {28499, 4, 1, 0, 0},
+    {28503, 5, 1, 0, 0},
+    {28508, 3, 1, 0, 0},
+    {28511, 7, 1, 0, 0},
+    {28518, 8, 1, 0, 0},
+    {28526, 6, 1, 0, 0},
+    {28532, 13, 1, 0, 0},
+    {28545, 6, 1, 0, 0},
+    {28551, 5, 1, 0, 0},
+    {28556, 3, 1, 0, 0},
+    {28559, 9, 1, 0, 0},
+    {28568, 6, 1, 0, 0},
+    {28574, 6, 1, 0, 0},
+    {28580, 4, 1, 0, 0},
+    {28584, 7, 1, 0, 0},
+    {28591, 6, 1, 0, 0},
+    {28597, 5, 1, 0, 0},
+    {28602, 3, 1, 0, 0},
+    {28605, 4, 1, 0, 0},
+    {28609, 6, 1, 0, 0},
+    {28615, 4, 1, 0, 0},
+    {28619, 8, 1, 0, 0},
+    {28627, 9, 1, 0, 0},
+    {28636, 9, 1, 0, 0},
+    {28645, 10, 1, 0, 0},
+    {28655, 13, 1, 0, 0},
+    {28668, 7, 1, 0, 0},
+    {28675, 6, 1, 0, 0},
+    {1612, 4, 1, 0, 0},
+    {13856, 9, 1, 0, 0},
+    {28681, 8, 1, 0, 0},
+    {28689, 6, 1, 0, 0},
+    {28695, 6, 1, 0, 0},
+    {28320, 7, 1, 0, 0},
+    {28701, 6, 1, 0, 0},
+    {28707, 6, 1, 0, 0},
+    {28713, 6, 1, 0, 0},
+    {28719, 10, 1, 0, 0},
+    {13903, 8, 1, 0, 0},
+    {28729, 5, 1, 0, 0},
+    {28734, 9, 1, 0, 0},
+    {28743, 10, 1, 0, 0},
+    {28753, 8, 1, 0, 0},
+    {28761, 8, 1, 0, 0},
+    {28769, 8, 1, 0, 0},
+    {28777, 12, 1, 0, 0},
+    {28789, 5, 1, 0, 0},
+    {28794, 8, 1, 0, 0},
+    {28802, 6, 1, 0, 0},
+    {28808, 6, 1, 0, 0},
+    {28814, 7, 1, 0, 0},
+    {28821, 5, 1, 0, 0},
+    {28826, 5, 1, 0, 0},
+    {28831, 9, 1, 0, 0},
+    {28840, 7, 1, 0, 0},
+    {28847, 5, 1, 0, 0},
+    {28852, 7, 1, 0, 0},
+    {28224, 3, 1, 0, 0},
+    {28859, 5, 1, 0, 0},
+    {28864, 8, 1, 0, 0},
+    {28872, 7, 1, 0, 0},
+    {28879, 9, 1, 0, 0},
+    {28888, 5, 1, 0, 0},
+    {28893, 4, 1, 0, 0},
+    {28897, 8, 1, 0, 0},
+    {28905, 7, 1, 0, 0},
+    {28912, 8, 1, 0, 0},
+    {28920, 8, 1, 0, 0},
+    {28928, 5, 1, 0, 0},
+    {28933, 6, 1, 0, 0},
+    {28939, 6, 1, 0, 0},
+    {28945, 9, 1, 0, 0},
+    {28954, 7, 1, 0, 0},
+    {28961, 6, 1, 0, 0},
+    {28967, 7, 1, 0, 0},
+    {28974, 3, 1, 0, 0},
+    {13865, 4, 1, 0, 0},
+    {28977, 5, 1, 0, 0},
+    {28982, 4, 1, 0, 0},
+    {28986, 4, 1, 0, 0},
+    {28990, 7, 1, 0, 0},
+    {28997, 7, 1, 0, 0},
+    {29004, 4, 1, 0, 0},
+    {29008, 16, 1, 0, 0},
+    {29024, 7, 1, 0, 0},
+    {28189, 5, 1, 0, 0},
+    {29031, 12, 1, 0, 0},
+    {29043, 4, 1, 0, 0},
+    {29047, 8, 1, 0, 0},
+    {29055, 9, 1, 0, 0},
+    {29064, 6, 1, 0, 0},
+    {29070, 8, 1, 0, 0},
+    {29078, 4, 1, 0, 0},
+    {29082, 8, 1, 0, 0},
+    {29090, 6, 1, 0, 0},
+    {29096, 8, 1, 0, 0},
+    {29104, 6, 1, 0, 0},
+    {29110, 11, 1, 0, 0},
+    {29121, 5, 1, 0, 0},
+    {29126, 8, 1, 0, 0},
+    {29134, 4, 1, 0, 0},
+    {29138, 10, 1, 0, 0},
+    {28879, 9, 1, 0, 0},
+    {29148, 6, 1, 0, 0},
+    {29154, 8, 1, 0, 0},
+    {29162, 5, 1, 0, 0},
+    {29167, 4, 1, 0, 0},
+    {29171, 6, 1, 0, 0},
+    {29177, 8, 1, 0, 0},
+    {14619, 8, 1, 0, 0},
+    {29185, 6, 1, 0, 0},
+    {29191, 4, 1, 0, 0},
+    {29195, 6, 1, 0, 0},
+    {29201, 7, 1, 0, 0},
+    {29208, 7, 1, 0, 0},
+    {29215, 15, 1, 0, 0},
+    {29230, 7, 1, 0, 0},
+    {29237, 7, 1, 0, 0},
+    {29244, 5, 1, 0, 0},
+    {29249, 5, 1, 0, 0},
+    {29254, 9, 1, 0, 0},
+    {29263, 6, 1, 0, 0},
+    {29269, 5, 1, 0, 0},
+    {29274, 7, 1, 0, 0},
+    {29281, 8, 1, 0, 0},
+    {29289, 5, 1, 0, 0},
+    {27800, 6, 1, 0, 0},
+    {29294, 8, 1, 0, 0},
+    {29302, 10, 1, 0, 0},
+    {29312, 8, 1, 0, 0},
+    {29320, 7, 1, 0, 0},
+    {29327, 6, 1, 0, 0},
+    {29333, 6, 1, 0, 0},
+    {29339, 3, 1, 0, 0},
+    {29342, 3, 1, 0, 0},
+    {29345, 9, 1, 0, 0},
+    {29354, 9, 1, 0, 0},
+    {29363, 6, 1, 0, 0},
+    {28888, 5, 1, 0, 0},
+    {29369, 8, 1, 0, 0},
+    {29154, 8, 1, 0, 0},
+    {29377, 8, 1, 0, 0},
+    {29385, 11, 1, 0, 0},
+    {29396, 7, 1, 0, 0},
+    {29403, 9, 1, 0, 0},
+    {29412, 8, 1, 0, 0},
+    {29420, 4, 1, 0, 0},
+    {29424, 8, 1, 0, 0},
+    {29432, 9, 1, 0, 0},
+    {29441, 5, 1, 0, 0},
+    {29446, 7, 1, 0, 0},
+    {29453, 5, 1, 0, 0},
+    {29458, 8, 1, 0, 0},
+    {29466, 11, 1, 0, 0},
+    {29477, 16, 1, 0, 0},
+    {29493, 5, 1, 0, 0},
+    {29498, 12, 1, 0, 0},
+    {29510, 5, 1, 0, 0},
+    {29515, 3, 1, 0, 0},
+    {29518, 6, 1, 0, 0},
+    {29524, 4, 1, 0, 0},
+    {29528, 6, 1, 0, 0},
+    {27136, 7, 1, 0, 0},
+    {29534, 4, 1, 0, 0},
+    {29538, 8, 1, 0, 0},
+    {29546, 13, 1, 0, 0},
+    {29559, 5, 1, 0, 0},
+    {29564, 4, 1, 0, 0},
+    {29568, 4, 1, 0, 0},
+    {29572, 9, 1, 0, 0},
+    {29581, 8, 1, 0, 0},
+    {29589, 7, 1, 0, 0},
+    {29596, 8, 1, 0, 0},
+    {29604, 8, 1, 0, 0},
+    {29612, 5, 1, 0, 0},
+    {29617, 7, 1, 0, 0},
+    {29624, 7, 1, 0, 0},
+    {29631, 7, 1, 0, 0},
+    {29638, 9, 1, 0, 0},
+    {29647, 9, 1, 0, 0},
+    {29656, 6, 1, 0, 0},
+    {29662, 6, 1, 0, 0},
+    {29668, 6, 1, 0, 0},
+    {29674, 5, 1, 0, 0},
+    {29679, 4, 1, 0, 0},
+    {29683, 6, 1, 0, 0},
+    {29689, 6, 1, 0, 0},
+    {29695, 8, 1, 0, 0},
+    {29703, 11, 1, 0, 0},
+    {29714, 7, 1, 0, 0},
+    {1612, 4, 1, 0, 0},
+    {29721, 6, 1, 0, 0},
+    {29727, 7, 1, 0, 0},
+    {29734, 5, 1, 0, 0},
+    {29739, 5, 1, 0, 0},
+    {29744, 4, 1, 0, 0},
+    {29748, 6, 1, 0, 0},
+    {29754, 8, 1, 0, 0},
+    {13856, 9, 1, 0, 0},
+    {29762, 6, 1, 0, 0},
+    {29768, 8, 1, 0, 0},
+    {29776, 6, 1, 0, 0},
+    {29782, 8, 1, 0, 0},
+    {29790, 12, 1, 0, 0},
+    {29802, 6, 1, 0, 0},
+    {29808, 13, 1, 0, 0},
+    {29821, 11, 1, 0, 0},
+    {29832, 5, 1, 0, 0},
+    {29837, 7, 1, 0, 0},
+    {29844, 6, 1, 0, 0},
+    {29850, 8, 1, 0, 0},
+    {29858, 9, 1, 0, 0},
+    {29867, 8, 1, 0, 0},
+    {28189, 5, 1, 0, 0},
+    {29875, 7, 1, 0, 0},
+    {29882, 8, 1, 0, 0},
+    {29890, 9, 1, 0, 0},
+    {29899, 6, 1, 0, 0},
+    {29905, 10, 1, 0, 0},
+    {29915, 8, 1, 0, 0},
+    {29923, 11, 1, 0, 0},
+    {29934, 12, 1, 0, 0},
+    {29946, 8, 1, 0, 0},
+    {29954, 6, 1, 0, 0},
+    {29960, 8, 1, 0, 0},
+    {29968, 7, 1, 0, 0},
+    {29975, 9, 1, 0, 0},
+    {29984, 13, 1, 0, 0},
+    {29997, 6, 1, 0, 0},
+    {30003, 8, 1, 0, 0},
+    {30011, 9, 1, 0, 0},
+    {30020, 8, 1, 0, 0},
+    {30028, 8, 1, 0, 0},
+    {30036, 12, 1, 0, 0},
+    {30048, 7, 1, 0, 0},
+    {30055, 7, 1, 0, 0},
+    {27414, 5, 1, 0, 0},
+    {30062, 7, 1, 0, 0},
+    {30069, 8, 1, 0, 0},
+    {30077, 6, 1, 0, 0},
+    {30083, 12, 1, 0, 0},
+    {30095, 8, 1, 0, 0},
+    {30103, 8, 1, 0, 0},
+    {30111, 6, 1, 0, 0},
+    {30117, 7, 1, 0, 0},
+    {30124, 4, 1, 0, 0},
+    {28449, 8, 1, 0, 0},
+    {30128, 12, 1, 0, 0},
+    {30140, 12, 1, 0, 0},
+    {30152, 5, 1, 0, 0},
+    {30157, 7, 1, 0, 0},
+    {30164, 6, 1, 0, 0},
+    {30170, 6, 1, 0, 0},
+    {30176, 8, 1, 0, 0},
+    {30184, 4, 1, 0, 0},
+    {30188, 11, 1, 0, 0},
+    {30199, 11, 1, 0, 0},
+    {29327, 6, 1, 0, 0},
+    {30210, 7, 1, 0, 0},
+    {30217, 5, 1, 0, 0},
+    {30222, 5, 1, 0, 0},
+    {30227, 6, 1, 0, 0},
+    {30233, 5, 1, 0, 0},
+    {30238, 5, 1, 0, 0},
+    {30243, 7, 1, 0, 0},
+    {30250, 9, 1, 0, 0},
+    {30259, 4, 1, 0, 0},
+    {30263, 5, 1, 0, 0},
+    {30268, 5, 1, 0, 0},
+    {30273, 8, 1, 0, 0},
+    {30281, 5, 1, 0, 0},
+    {30286, 9, 1, 0, 0},
+    {30295, 7, 1, 0, 0},
+    {30302, 11, 1, 0, 0},
+    {30313, 6, 1, 0, 0},
+    {30319, 9, 1, 0, 0},
+    {30328, 8, 1, 0, 0},
+    {30336, 5, 1, 0, 0},
+    {30341, 8, 1, 0, 0},
+    {30349, 8, 1, 0, 0},
+    {30357, 7, 1, 0, 0},
+    {30364, 7, 1, 0, 0},
+    {30371, 9, 1, 0, 0},
+    {30380, 7, 1, 0, 0},
+    {30387, 9, 1, 0, 0},
+    {30396, 12, 1, 0, 0},
+    {30408, 8, 1, 0, 0},
+    {30416, 9, 1, 0, 0},
+    {30425, 7, 1, 0, 0},
+    {30432, 9, 1, 0, 0},
+    {30441, 7, 1, 0, 0},
+    {30448, 8, 1, 0, 0},
+    {30456, 5, 1, 0, 0},
+    {30461, 6, 1, 0, 0},
+    {30467, 8, 1, 0, 0},
+    {30475, 8, 1, 0, 0},
+    {30483, 9, 1, 0, 0},
+    {30492, 7, 1, 0, 0},
+    {30499, 5, 1, 0, 0},
+    {30504, 9, 1, 0, 0},
+    {30513, 6, 1, 0, 0},
+    {30519, 4, 1, 0, 0},
+    {30523, 6, 1, 0, 0},
+    {30529, 8, 1, 0, 0},
+    {30537, 7, 1, 0, 0},
+    {30544, 8, 1, 0, 0},
+    {30552, 9, 1, 0, 0},
+    {30561, 7, 1, 0, 0},
+    {30568, 6, 1, 0, 0},
+    {30574, 4, 1, 0, 0},
+    {30578, 9, 1, 0, 0},
+    {30587, 8, 1, 0, 0},
+    {30595, 7, 1, 0, 0},
+    {30602, 6, 1, 0, 0},
+    {30608, 6, 1, 0, 0},
+    {30614, 4, 1, 0, 0},
+    {30618, 6, 1, 0, 0},
+    {30624, 3, 1, 0, 0},
+    {30627, 9, 1, 0, 0},
+    {30636, 6, 1, 0, 0},
+    {30642, 5, 1, 0, 0},
+    {28250, 6, 1, 0, 0},
+    {30647, 5, 1, 0, 0},
+    {30652, 8, 1, 0, 0},
+    {30660, 7, 1, 0, 0},
+    {30667, 6, 1, 0, 0},
+    {30673, 6, 1, 0, 0},
+    {27703, 8, 1, 0, 0},
+    {30679, 7, 1, 0, 0},
+    {30686, 5, 1, 0, 0},
+    {30691, 8, 1, 0, 0},
+    {30699, 8, 1, 0, 0},
+    {29915, 8, 1, 0, 0},
+    {30707, 5, 1, 0, 0},
+    {28361, 6, 1, 0, 0},
+    {30712, 9, 1, 0, 0},
+    {30721, 4, 1, 0, 0},
+    {30725, 11, 1, 0, 0},
+    {30736, 11, 1, 0, 0},
+    {30747, 9, 1, 0, 0},
+    {28224, 3, 1, 0, 0},
+    {30756, 5, 1, 0, 0},
+    {30761, 6, 1, 0, 0},
+    {30767, 8, 1, 0, 0},
+    {30775, 4, 1, 0, 0},
+    {28526, 6, 1, 0, 0},
+    {30779, 9, 1, 0, 0},
+    {30788, 5, 1, 0, 0},
+    {30793, 6, 1, 0, 0},
+    {30799, 6, 1, 0, 0},
+    {30805, 4, 1, 0, 0},
+    {30809, 10, 1, 0, 0},
+    {30819, 8, 1, 0, 0},
+    {30827, 6, 1, 0, 0},
+    {30833, 5, 1, 0, 0},
+    {30838, 7, 1, 0, 0},
+    {30845, 7, 1, 0, 0},
+    {30852, 4, 1, 0, 0},
+    {30856, 7, 1, 0, 0},
+    {30863, 4, 1, 0, 0},
+    {30867, 6, 1, 0, 0},
+    {30873, 3, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {30876, 5, 1, 0, 0},
+    {30881, 8, 1, 0, 0},
+    {30889, 5, 1, 0, 0},
+    {30894, 9, 1, 0, 0},
+    {2789, 7, 1, 0, 0},
+    {30903, 11, 1, 0, 0},
+    {30914, 12, 1, 0, 0},
+    {30926, 10, 1, 0, 0},
+    {13896, 7, 1, 0, 0},
+    {30936, 3, 1, 0, 0},
+    {30939, 8, 1, 0, 0},
+    {30947, 5, 1, 0, 0},
+    {30952, 5, 1, 0, 0},
+    {30957, 4, 1, 0, 0},
+    {30961, 6, 1, 0, 0},
+    {30967, 6, 1, 0, 0},
+    {30973, 7, 1, 0, 0},
+    {30980, 11, 1, 0, 0},
+    {28385, 4, 1, 0, 0},
+    {30991, 4, 1, 0, 0},
+    {30995, 4, 1, 0, 0},
+    {30999, 6, 1, 0, 0},
+    {29534, 4, 1, 0, 0},
+    {31005, 8, 1, 0, 0},
+    {31013, 5, 1, 0, 0},
+    {31018, 5, 1, 0, 0},
+    {31023, 7, 1, 0, 0},
+    {31030, 9, 1, 0, 0},
+    {28232, 5, 1, 0, 0},
+    {31039, 10, 1, 0, 0},
+    {31049, 9, 1, 0, 0},
+    {31058, 10, 1, 0, 0},
+    {31068, 9, 1, 0, 0},
+    {31077, 4, 1, 0, 0},
+    {31081, 5, 1, 0, 0},
+    {31086, 8, 1, 0, 0},
+    {31094, 11, 1, 0, 0},
+    {27246, 5, 1, 0, 0},
+    {31105, 6, 1, 0, 0},
+    {31111, 4, 1, 0, 0},
+    {31115, 6, 1, 0, 0},
+    {31121, 9, 1, 0, 0},
+    {31130, 7, 1, 0, 0},
+    {31137, 8, 1, 0, 0},
+    {31145, 6, 1, 0, 0},
+    {27993, 7, 1, 0, 0},
+    {14619, 8, 1, 0, 0},
+    {31151, 6, 1, 0, 0},
+    {31157, 4, 1, 0, 0},
+    {31161, 7, 1, 0, 0},
+    {31168, 5, 1, 0, 0},
+    {31173, 7, 1, 0, 0},
+    {31180, 4, 1, 0, 0},
+    {31184, 6, 1, 0, 0},
+    {31190, 8, 1, 0, 0},
+    {31198, 8, 1, 0, 0},
+    {3337, 7, 1, 0, 0},
+    {31206, 8, 1, 0, 0},
+    {31214, 5, 1, 0, 0},
+    {31219, 4, 1, 0, 0},
+    {31223, 8, 1, 0, 0},
+    {31231, 4, 1, 0, 0},
+    {31235, 5, 1, 0, 0},
+    {31240, 4, 1, 0, 0},
+    {31244, 7, 1, 0, 0},
+    {31251, 7, 1, 0, 0},
+    {31258, 8, 1, 0, 0},
+    {31266, 6, 1, 0, 0},
+    {31272, 5, 1, 0, 0},
+    {31277, 8, 1, 0, 0},
+    {31285, 8, 1, 0, 0},
+    {31293, 9, 1, 0, 0},
+    {28707, 6, 1, 0, 0},
+    {31302, 8, 1, 0, 0},
+    {31310, 10, 1, 0, 0},
+    {31320, 8, 1, 0, 0},
+    {13911, 5, 1, 0, 0},
+    {31328, 6, 1, 0, 0},
+    {31334, 8, 1, 0, 0},
+    {31342, 10, 1, 0, 0},
+    {31352, 7, 1, 0, 0},
+    {31359, 5, 1, 0, 0},
+    {31364, 8, 1, 0, 0},
+    {31372, 4, 1, 0, 0},
+    {31376, 6, 1, 0, 0},
+    {31382, 8, 1, 0, 0},
+    {28413, 6, 1, 0, 0},
+    {31390, 8, 1, 0, 0},
+    {31398, 7, 1, 0, 0},
+    {31405, 6, 1, 0, 0},
+    {27862, 4, 1, 0, 0},
+    {31411, 7, 1, 0, 0},
+    {31418, 4, 1, 0, 0},
+    {31422, 7, 1, 0, 0},
+    {31429, 13, 1, 0, 0},
+    {31442, 5, 1, 0, 0},
+    {31447, 11, 1, 0, 0},
+    {31458, 6, 1, 0, 0},
+    {31464, 8, 1, 0, 0},
+    {31472, 4, 1, 0, 0},
+    {31476, 6, 1, 0, 0},
+    {28609, 6, 1, 0, 0},
+    {31482, 7, 1, 0, 0},
+    {31489, 13, 1, 0, 0},
+    {31502, 7, 1, 0, 0},
+    {31509, 8, 1, 0, 0},
+    {31517, 5, 1, 0, 0},
+    {31522, 8, 1, 0, 0},
+    {31530, 6, 1, 0, 0},
+    {31536, 8, 1, 0, 0},
+    {31544, 6, 1, 0, 0},
+    {31550, 7, 1, 0, 0},
+    {31557, 9, 1, 0, 0},
+    {31566, 7, 1, 0, 0},
+    {31573, 8, 1, 0, 0},
+    {31581, 5, 1, 0, 0},
+    {31586, 8, 1, 0, 0},
+    {31594, 5, 1, 0, 0},
+    {31599, 5, 1, 0, 0},
+    {31604, 5, 1, 0, 0},
+    {26750, 3, 1, 0, 0},
+    {31609, 4, 1, 0, 0},
+    {31613, 5, 1, 0, 0},
+    {13922, 9, 1, 0, 0},
+    {31618, 6, 1, 0, 0},
+    {31624, 8, 1, 0, 0},
+    {31632, 5, 1, 0, 0},
+    {31637, 7, 1, 0, 0},
+    {31644, 10, 1, 0, 0},
+    {31654, 9, 1, 0, 0},
+    {31663, 10, 1, 0, 0},
+    {31673, 8, 1, 0, 0},
+    {31681, 12, 1, 0, 0},
+    {31693, 13, 1, 0, 0},
+    {31706, 3, 1, 0, 0},
+    {31709, 8, 1, 0, 0},
+    {31717, 5, 1, 0, 0},
+    {31722, 6, 1, 0, 0},
+    {31728, 6, 1, 0, 0},
+    {31734, 5, 1, 0, 0},
+    {31739, 9, 1, 0, 0},
+    {31748, 5, 1, 0, 0},
+    {31277, 8, 1, 0, 0},
+    {31753, 6, 1, 0, 0},
+    {31759, 6, 1, 0, 0},
+    {31765, 9, 1, 0, 0},
+    {31774, 7, 1, 0, 0},
+    {31781, 6, 1, 0, 0},
+    {31787, 8, 1, 0, 0},
+    {31795, 8, 1, 0, 0},
+    {31803, 7, 1, 0, 0},
+    {31810, 14, 1, 0, 0},
+    {31824, 5, 1, 0, 0},
+    {31829, 5, 1, 0, 0},
+    {31834, 8, 1, 0, 0},
+    {31842, 7, 1, 0, 0},
+    {31849, 2, 1, 0, 0},
+    {31851, 4, 1, 0, 0},
+    {31855, 10, 1, 0, 0},
+    {31865, 8, 1, 0, 0},
+    {31873, 6, 1, 0, 0},
+    {31879, 8, 1, 0, 0},
+    {28939, 6, 1, 0, 0},
+    {31887, 8, 1, 0, 0},
+    {31895, 8, 1, 0, 0},
+    {31903, 4, 1, 0, 0},
+    {31907, 5, 1, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {31912, 3, 1, 0, 0},
+    {31915, 6, 1, 0, 0},
+    {29802, 6, 1, 0, 0},
+    {31921, 12, 1, 0, 0},
+    {31933, 3, 1, 0, 0},
+    {31936, 6, 1, 0, 0},
+    {31942, 4, 1, 0, 0},
+    {31946, 8, 1, 0, 0},
+    {13961, 5, 1, 0, 0},
+    {29528, 6, 1, 0, 0},
+    {31954, 8, 1, 0, 0},
+    {31962, 6, 1, 0, 0},
+    {31968, 6, 1, 0, 0},
+    {31974, 8, 1, 0, 0},
+    {31982, 7, 1, 0, 0},
+    {31989, 9, 1, 0, 0},
+    {31998, 10, 1, 0, 0},
+    {32008, 4, 1, 0, 0},
+    {28486, 5, 1, 0, 0},
+    {32012, 5, 1, 0, 0},
+    {32017, 6, 1, 0, 0},
+    {32023, 6, 1, 0, 0},
+    {32029, 6, 1, 0, 0},
+    {32035, 6, 1, 0, 0},
+    {32041, 4, 1, 0, 0},
+    {32045, 11, 1, 0, 0},
+    {32056, 4, 1, 0, 0},
+    {32060, 5, 1, 0, 0},
+    {32065, 5, 1, 0, 0},
+    {32070, 6, 1, 0, 0},
+    {32076, 8, 1, 0, 0},
+    {32084, 7, 1, 0, 0},
+    {32091, 4, 1, 0, 0},
+    {32095, 3, 1, 0, 0},
+    {32098, 5, 1, 0, 0},
+    {32103, 7, 1, 0, 0},
+    {32110, 11, 1, 0, 0},
+    {32121, 7, 1, 0, 0},
+    {13966, 8, 1, 0, 0},
+    {32128, 7, 1, 0, 0},
+    {32135, 6, 1, 0, 0},
+    {32141, 8, 1, 0, 0},
+    {32149, 11, 1, 0, 0},
+    {32160, 6, 1, 0, 0},
+    {32166, 9, 1, 0, 0},
+    {32175, 5, 1, 0, 0},
+    {28120, 3, 1, 0, 0},
+    {30793, 6, 1, 0, 0},
+    {32180, 8, 1, 0, 0},
+    {32188, 3, 1, 0, 0},
+    {32191, 3, 1, 0, 0},
+    {32194, 6, 1, 0, 0},
+    {28939, 6, 1, 0, 0},
+    {32200, 10, 1, 0, 0},
+    {32210, 5, 1, 0, 0},
+    {32215, 11, 1, 0, 0},
+    {32226, 11, 1, 0, 0},
+    {32237, 3, 1, 0, 0},
+    {32240, 3, 1, 0, 0},
+    {32243, 4, 1, 0, 0},
+    {32247, 7, 1, 0, 0},
+    {32254, 4, 1, 0, 0},
+    {32258, 4, 1, 0, 0},
+    {32262, 4, 1, 0, 0},
+    {32266, 8, 1, 0, 0},
+    {32274, 8, 1, 0, 0},
+    {32282, 9, 1, 0, 0},
+    {32291, 8, 1, 0, 0},
+    {32299, 7, 1, 0, 0},
+    {28407, 6, 1, 0, 0},
+    {32306, 15, 1, 0, 0},
+    {32321, 6, 1, 0, 0},
+    {32327, 4, 1, 0, 0},
+    {32331, 10, 1, 0, 0},
+    {32341, 7, 1, 0, 0},
+    {32348, 6, 1, 0, 0},
+    {32354, 9, 1, 0, 0},
+    {32363, 5, 1, 0, 0},
+    {32368, 5, 1, 0, 0},
+    {32373, 6, 1, 0, 0},
+    {32379, 3, 1, 0, 0},
+    {32382, 9, 1, 0, 0},
+    {32391, 6, 1, 0, 0},
+    {32397, 9, 1, 0, 0},
+    {32406, 6, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {32412, 5, 1, 0, 0},
+    {32417, 3, 1, 0, 0},
+    {32420, 8, 1, 0, 0},
+    {32428, 7, 1, 0, 0},
+    {32435, 4, 1, 0, 0},
+    {32439, 8, 1, 0, 0},
+    {32447, 4, 1, 0, 0},
+    {32451, 6, 1, 0, 0},
+    {29518, 6, 1, 0, 0},
+    {32457, 6, 1, 0, 0},
+    {32463, 9, 1, 0, 0},
+    {29289, 5, 1, 0, 0},
+    {27130, 6, 1, 0, 0},
+    {32472, 9, 1, 0, 0},
+    {32481, 6, 1, 0, 0},
+    {28419, 6, 1, 0, 0},
+    {32487, 6, 1, 0, 0},
+    {32493, 5, 1, 0, 0},
+    {32498, 6, 1, 0, 0},
+    {32504, 4, 1, 0, 0},
+    {30456, 5, 1, 0, 0},
+    {32508, 4, 1, 0, 0},
+    {32512, 6, 1, 0, 0},
+    {32518, 4, 1, 0, 0},
+    {32522, 3, 1, 0, 0},
+    {32525, 5, 1, 0, 0},
+    {32530, 8, 1, 0, 0},
+    {32538, 7, 1, 0, 0},
+    {32545, 9, 1, 0, 0},
+    {32554, 8, 1, 0, 0},
+    {32562, 17, 1, 0, 0},
+    {32579, 10, 1, 0, 0},
+    {32589, 7, 1, 0, 0},
+    {32596, 6, 1, 0, 0},
+    {31942, 4, 1, 0, 0},
+    {13939, 8, 1, 0, 0},
+    {32602, 8, 1, 0, 0},
+    {32610, 10, 1, 0, 0},
+    {32620, 13, 1, 0, 0},
+    {27419, 6, 1, 0, 0},
+    {32633, 6, 1, 0, 0},
+    {32639, 6, 1, 0, 0},
+    {32645, 7, 1, 0, 0},
+    {32652, 5, 1, 0, 0},
+    {32657, 7, 1, 0, 0},
+    {32664, 5, 1, 0, 0},
+    {32669, 4, 1, 0, 0},
+    {32673, 6, 1, 0, 0},
+    {32679, 7, 1, 0, 0},
+    {32686, 13, 1, 0, 0},
+    {32699, 7, 1, 0, 0},
+    {32706, 8, 1, 0, 0},
+    {32714, 9, 1, 0, 0},
+    {32723, 6, 1, 0, 0},
+    {32729, 5, 1, 0, 0},
+    {32734, 4, 1, 0, 0},
+    {32738, 6, 1, 0, 0},
+    {32744, 6, 1, 0, 0},
+    {32750, 6, 1, 0, 0},
+    {32756, 8, 1, 0, 0},
+    {32764, 3, 1, 0, 0},
+    {32767, 3, 1, 0, 0},
+    {32770, 5, 1, 0, 0},
+    {32775, 6, 1, 0, 0},
+    {32781, 5, 1, 0, 0},
+    {32786, 8, 1, 0, 0},
+    {32794, 10, 1, 0, 0},
+    {32804, 4, 1, 0, 0},
+    {31946, 8, 1, 0, 0},
+    {28769, 8, 1, 0, 0},
+    {32808, 7, 1, 0, 0},
+    {32815, 9, 1, 0, 0},
+    {32824, 8, 1, 0, 0},
+    {32832, 7, 1, 0, 0},
+    {32839, 6, 1, 0, 0},
+    {32845, 10, 1, 0, 0},
+    {13985, 8, 1, 0, 0},
+    {32855, 9, 1, 0, 0},
+    {32864, 8, 1, 0, 0},
+    {32872, 9, 1, 0, 0},
+    {32881, 7, 1, 0, 0},
+    {32888, 5, 1, 0, 0},
+    {32893, 6, 1, 0, 0},
+    {32899, 8, 1, 0, 0},
+    {32907, 8, 1, 0, 0},
+    {32915, 8, 1, 0, 0},
+    {32923, 8, 1, 0, 0},
+    {32060, 5, 1, 0, 0},
+    {32931, 4, 1, 0, 0},
+    {32935, 8, 1, 0, 0},
+    {32943, 4, 1, 0, 0},
+    {32947, 4, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {32951, 7, 1, 0, 0},
+    {32958, 9, 1, 0, 0},
+    {32967, 7, 1, 0, 0},
+    {32974, 5, 1, 0, 0},
+    {32979, 6, 1, 0, 0},
+    {32985, 6, 1, 0, 0},
+    {32991, 4, 1, 0, 0},
+    {32995, 6, 1, 0, 0},
+    {33001, 4, 1, 0, 0},
+    {33005, 6, 1, 0, 0},
+    {33011, 6, 1, 0, 0},
+    {33017, 6, 1, 0, 0},
+    {28189, 5, 1, 0, 0},
+    {33023, 7, 1, 0, 0},
+    {30936, 3, 1, 0, 0},
+    {33030, 9, 1, 0, 0},
+    {33039, 8, 1, 0, 0},
+    {33047, 4, 1, 0, 0},
+    {33051, 13, 1, 0, 0},
+    {33064, 8, 1, 0, 0},
+    {33072, 8, 1, 0, 0},
+    {33080, 6, 1, 0, 0},
+    {33086, 9, 1, 0, 0},
+    {31654, 9, 1, 0, 0},
+    {33095, 5, 1, 0, 0},
+    {33100, 10, 1, 0, 0},
+    {33110, 10, 1, 0, 0},
+    {33120, 12, 1, 0, 0},
+    {33132, 6, 1, 0, 0},
+    {33138, 6, 1, 0, 0},
+    {33144, 6, 1, 0, 0},
+    {33150, 9, 1, 0, 0},
+    {13993, 6, 1, 0, 0},
+    {33159, 6, 1, 0, 0},
+    {33165, 6, 1, 0, 0},
+    {28449, 8, 1, 0, 0},
+    {33171, 6, 1, 0, 0},
+    {33177, 11, 1, 0, 0},
+    {33188, 5, 1, 0, 0},
+    {31018, 5, 1, 0, 0},
+    {33193, 5, 1, 0, 0},
+    {33198, 6, 1, 0, 0},
+    {33204, 3, 1, 0, 0},
+    {33207, 6, 1, 0, 0},
+    {33213, 7, 1, 0, 0},
+    {27892, 5, 1, 0, 0},
+    {33220, 5, 1, 0, 0},
+    {27897, 5, 1, 0, 0},
+    {33225, 6, 1, 0, 0},
+    {33231, 4, 1, 0, 0},
+    {33235, 6, 1, 0, 0},
+    {33241, 9, 1, 0, 0},
+    {33250, 12, 1, 0, 0},
+    {33262, 8, 1, 0, 0},
+    {33270, 4, 1, 0, 0},
+    {33274, 6, 1, 0, 0},
+    {33280, 6, 1, 0, 0},
+    {32180, 8, 1, 0, 0},
+    {29154, 8, 1, 0, 0},
+    {33286, 9, 1, 0, 0},
+    {30838, 7, 1, 0, 0},
+    {33295, 9, 1, 0, 0},
+    {33304, 6, 1, 0, 0},
+    {33310, 4, 1, 0, 0},
+    {33314, 4, 1, 0, 0},
+    {33318, 4, 1, 0, 0},
+    {14619, 8, 1, 0, 0},
+    {33322, 10, 1, 0, 0},
+    {33332, 6, 1, 0, 0},
+    {33338, 7, 1, 0, 0},
+    {33345, 7, 1, 0, 0},
+    {33352, 5, 1, 0, 0},
+    {33357, 4, 1, 0, 0},
+    {33361, 6, 1, 0, 0},
+    {33367, 6, 1, 0, 0},
+    {33373, 3, 1, 0, 0},
+    {33376, 7, 1, 0, 0},
+    {33383, 8, 1, 0, 0},
+    {33391, 10, 1, 0, 0},
+    {33401, 8, 1, 0, 0},
+    {13999, 8, 1, 0, 0},
+    {28216, 5, 1, 0, 0},
+    {33409, 5, 1, 0, 0},
+    {33414, 5, 1, 0, 0},
+    {33419, 6, 1, 0, 0},
+    {33425, 6, 1, 0, 0},
+    {33431, 5, 1, 0, 0},
+    {33436, 9, 1, 0, 0},
+    {33445, 12, 1, 0, 0},
+    {33457, 7, 1, 0, 0},
+    {27289, 8, 1, 0, 0},
+    {33464, 5, 1, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {33469, 4, 1, 0, 0},
+    {33473, 4, 1, 0, 0},
+    {33477, 6, 1, 0, 0},
+    {33483, 14, 1, 0, 0},
+    {33497, 7, 1, 0, 0},
+    {33504, 5, 1, 0, 0},
+    {33509, 12, 1, 0, 0},
+    {33521, 7, 1, 0, 0},
+    {33528, 7, 1, 0, 0},
+    {33535, 9, 1, 0, 0},
+    {33544, 9, 1, 0, 0},
+    {31359, 5, 1, 0, 0},
+    {33039, 8, 1, 0, 0},
+    {30712, 9, 1, 0, 0},
+    {33553, 5, 1, 0, 0},
+    {33558, 8, 1, 0, 0},
+    {33566, 6, 1, 0, 0},
+    {33572, 6, 1, 0, 0},
+    {14007, 4, 1, 0, 0},
+    {33578, 8, 1, 0, 0},
+    {33586, 3, 1, 0, 0},
+    {33589, 4, 1, 0, 0},
+    {33593, 5, 1, 0, 0},
+    {33598, 7, 1, 0, 0},
+    {33605, 5, 1, 0, 0},
+    {33610, 9, 1, 0, 0},
+    {33619, 13, 1, 0, 0},
+    {33632, 6, 1, 0, 0},
+    {33638, 4, 1, 0, 0},
+    {33642, 8, 1, 0, 0},
+    {33650, 10, 1, 0, 0},
+    {33660, 7, 1, 0, 0},
+    {33667, 5, 1, 0, 0},
+    {33672, 3, 1, 0, 0},
+    {33675, 14, 1, 0, 0},
+    {33689, 12, 1, 0, 0},
+    {33701, 7, 1, 0, 0},
+    {33708, 7, 1, 0, 0},
+    {33715, 3, 1, 0, 0},
+    {33718, 5, 1, 0, 0},
+    {33723, 5, 1, 0, 0},
+    {33728, 8, 1, 0, 0},
+    {33736, 9, 1, 0, 0},
+    {33745, 6, 1, 0, 0},
+    {32254, 4, 1, 0, 0},
+    {33751, 6, 1, 0, 0},
+    {33757, 11, 1, 0, 0},
+    {33768, 12, 1, 0, 0},
+    {33780, 7, 1, 0, 0},
+    {33787, 5, 1, 0, 0},
+    {33792, 8, 1, 0, 0},
+    {33800, 5, 1, 0, 0},
+    {33805, 7, 1, 0, 0},
+    {14011, 7, 1, 0, 0},
+    {33812, 5, 1, 0, 0},
+    {33204, 3, 1, 0, 0},
+    {33817, 4, 1, 0, 0},
+    {33821, 5, 1, 0, 0},
+    {33826, 5, 1, 0, 0},
+    {33831, 6, 1, 0, 0},
+    {33837, 8, 1, 0, 0},
+    {32679, 7, 1, 0, 0},
+    {33845, 6, 1, 0, 0},
+    {33851, 6, 1, 0, 0},
+    {33857, 6, 1, 0, 0},
+    {33863, 9, 1, 0, 0},
+    {33872, 7, 1, 0, 0},
+    {33879, 6, 1, 0, 0},
+    {33885, 6, 1, 0, 0},
+    {33891, 6, 1, 0, 0},
+    {33897, 5, 1, 0, 0},
+    {33902, 6, 1, 0, 0},
+    {33908, 5, 1, 0, 0},
+    {33913, 8, 1, 0, 0},
+    {33921, 11, 1, 0, 0},
+    {33932, 6, 1, 0, 0},
+    {33938, 4, 1, 0, 0},
+    {33942, 9, 1, 0, 0},
+    {33951, 4, 1, 0, 0},
+    {33955, 8, 1, 0, 0},
+    {33963, 7, 1, 0, 0},
+    {33970, 4, 1, 0, 0},
+    {33974, 8, 1, 0, 0},
+    {33982, 4, 1, 0, 0},
+    {14018, 4, 1, 0, 0},
+    {33986, 5, 1, 0, 0},
+    {33991, 6, 1, 0, 0},
+    {33997, 7, 1, 0, 0},
+    {18587, 3, 1, 0, 0},
+    {34004, 5, 1, 0, 0},
+    {34009, 4, 1, 0, 0},
+    {34013, 6, 1, 0, 0},
+    {34019, 8, 1, 0, 0},
+    {34027, 5, 1, 0, 0},
+    {34032, 9, 1, 0, 0},
+    {34041, 5, 1, 0, 0},
+    {34046, 8, 1, 0, 0},
+    {34054, 7, 1, 0, 0},
+    {34061, 8, 1, 0, 0},
+    {34069, 7, 1, 0, 0},
+    {34076, 9, 1, 0, 0},
+    {34085, 6, 1, 0, 0},
+    {34091, 6, 1, 0, 0},
+    {34097, 4, 1, 0, 0},
+    {34101, 5, 1, 0, 0},
+    {34106, 12, 1, 0, 0},
+    {14022, 7, 1, 0, 0},
+    {34118, 7, 1, 0, 0},
+    {34125, 8, 1, 0, 0},
+    {33632, 6, 1, 0, 0},
+    {34133, 4, 1, 0, 0},
+    {34137, 4, 1, 0, 0},
+    {34141, 9, 1, 0, 0},
+    {34150, 6, 1, 0, 0},
+    {34156, 7, 1, 0, 0},
+    {34163, 4, 1, 0, 0},
+    {34167, 6, 1, 0, 0},
+    {34173, 5, 1, 0, 0},
+    {34178, 7, 1, 0, 0},
+    {34185, 6, 1, 0, 0},
+    {34191, 9, 1, 0, 0},
+    {34200, 7, 1, 0, 0},
+    {28320, 7, 1, 0, 0},
+    {34207, 6, 1, 0, 0},
+    {34213, 5, 1, 0, 0},
+    {34218, 8, 1, 0, 0},
+    {13903, 8, 1, 0, 0},
+    {34226, 6, 1, 0, 0},
+    {34232, 5, 1, 0, 0},
+    {34237, 6, 1, 0, 0},
+    {34243, 3, 1, 0, 0},
+    {34246, 9, 1, 0, 0},
+    {34255, 14, 1, 0, 0},
+    {34269, 8, 1, 0, 0},
+    {34277, 8, 1, 0, 0},
+    {34285, 11, 1, 0, 0},
+    {34296, 6, 1, 0, 0},
+    {34302, 4, 1, 0, 0},
+    {34306, 4, 1, 0, 0},
+    {34310, 10, 1, 0, 0},
+    {34320, 7, 1, 0, 0},
+    {34327, 5, 1, 0, 0},
+    {32166, 9, 1, 0, 0},
+    {34332, 5, 1, 0, 0},
+    {4299, 7, 1, 0, 0},
+    {34337, 4, 1, 0, 0},
+    {34341, 7, 1, 0, 0},
+    {34348, 8, 1, 0, 0},
+    {34356, 6, 1, 0, 0},
+    {34362, 9, 1, 0, 0},
+    {34371, 10, 1, 0, 0},
+    {34381, 6, 1, 0, 0},
+    {34387, 6, 1, 0, 0},
+    {34393, 5, 1, 0, 0},
+    {34398, 5, 1, 0, 0},
+    {34403, 7, 1, 0, 0},
+    {34410, 8, 1, 0, 0},
+    {34418, 8, 1, 0, 0},
+    {34426, 6, 1, 0, 0},
+    {34432, 5, 1, 0, 0},
+    {34437, 14, 1, 0, 0},
+    {27666, 4, 1, 0, 0},
+    {34451, 5, 1, 0, 0},
+    {34456, 9, 1, 0, 0},
+    {34465, 8, 1, 0, 0},
+    {34473, 6, 1, 0, 0},
+    {34479, 12, 1, 0, 0},
+    {34491, 16, 1, 0, 0},
+    {34507, 15, 1, 0, 0},
+    {34522, 8, 1, 0, 0},
+    {13896, 7, 1, 0, 0},
+    {28189, 5, 1, 0, 0},
+    {31613, 5, 1, 0, 0},
+    {34530, 9, 1, 0, 0},
+    {34539, 9, 1, 0, 0},
+    {34548, 6, 1, 0, 0},
+    {34554, 7, 1, 0, 0},
+    {34561, 5, 1, 0, 0},
+    {34566, 9, 1, 0, 0},
+    {34575, 6, 1, 0, 0},
+    {34581, 13, 1, 0, 0},
+    {34594, 9, 1, 0, 0},
+    {32258, 4, 1, 0, 0},
+    {34603, 8, 1, 0, 0},
+    {34611, 9, 1, 0, 0},
+    {34620, 6, 1, 0, 0},
+    {34626, 5, 1, 0, 0},
+    {34091, 6, 1, 0, 0},
+    {34631, 9, 1, 0, 0},
+    {34640, 8, 1, 0, 0},
+    {28463, 5, 1, 0, 0},
+    {34648, 4, 1, 0, 0},
+    {34652, 11, 1, 0, 0},
+    {28232, 5, 1, 0, 0},
+    {34663, 6, 1, 0, 0},
+    {34669, 6, 1, 0, 0},
+    {34675, 6, 1, 0, 0},
+    {34681, 11, 1, 0, 0},
+    {34692, 9, 1, 0, 0},
+    {34701, 5, 1, 0, 0},
+    {34706, 7, 1, 0, 0},
+    {30799, 6, 1, 0, 0},
+    {34713, 6, 1, 0, 0},
+    {34719, 8, 1, 0, 0},
+    {34727, 9, 1, 0, 0},
+    {34736, 12, 1, 0, 0},
+    {34748, 8, 1, 0, 0},
+    {34756, 6, 1, 0, 0},
+    {34762, 3, 1, 0, 0},
+    {34765, 6, 1, 0, 0},
+    {34771, 5, 1, 0, 0},
+    {34776, 8, 1, 0, 0},
+    {34784, 6, 1, 0, 0},
+    {34790, 8, 1, 0, 0},
+    {34798, 5, 1, 0, 0},
+    {34803, 5, 1, 0, 0},
+    {34808, 8, 1, 0, 0},
+    {34816, 7, 1, 0, 0},
+    {34823, 7, 1, 0, 0},
+    {30973, 7, 1, 0, 0},
+    {29070, 8, 1, 0, 0},
+    {34830, 8, 1, 0, 0},
+    {34838, 6, 1, 0, 0},
+    {34844, 7, 1, 0, 0},
+    {34851, 7, 1, 0, 0},
+    {34858, 10, 1, 0, 0},
+    {34868, 3, 1, 0, 0},
+    {33198, 6, 1, 0, 0},
+    {34871, 5, 1, 0, 0},
+    {14029, 4, 1, 0, 0},
+    {32714, 9, 1, 0, 0},
+    {34876, 4, 1, 0, 0},
+    {34880, 4, 1, 0, 0},
+    {34884, 4, 1, 0, 0},
+    {34888, 11, 1, 0, 0},
+    {34899, 7, 1, 0, 0},
+    {34906, 5, 1, 0, 0},
+    {34911, 8, 1, 0, 0},
+    {32979, 6, 1, 0, 0},
+    {34919, 8, 1, 0, 0},
+    {34927, 6, 1, 0, 0},
+    {34933, 5, 1, 0, 0},
+    {34938, 5, 1, 0, 0},
+    {34943, 6, 1, 0, 0},
+    {34949, 8, 1, 0, 0},
+    {34957, 8, 1, 0, 0},
+    {29802, 6, 1, 0, 0},
+    {34965, 15, 1, 0, 0},
+    {34980, 16, 1, 0, 0},
+    {27353, 5, 1, 0, 0},
+    {30936, 3, 1, 0, 0},
+    {34996, 5, 1, 0, 0},
+    {35001, 8, 1, 0, 0},
+    {35009, 9, 1, 0, 0},
+    {29915, 8, 1, 0, 0},
+    {35018, 8, 1, 0, 0},
+    {35026, 8, 1, 0, 0},
+    {32428, 7, 1, 0, 0},
+    {35034, 9, 1, 0, 0},
+    {35043, 8, 1, 0, 0},
+    {35051, 4, 1, 0, 0},
+    {35055, 8, 1, 0, 0},
+    {35063, 9, 1, 0, 0},
+    {35072, 7, 1, 0, 0},
+    {35079, 4, 1, 0, 0},
+    {35083, 8, 1, 0, 0},
+    {35091, 10, 1, 0, 0},
+    {35101, 6, 1, 0, 0},
+    {27419, 6, 1, 0, 0},
+    {35107, 9, 1, 0, 0},
+    {27136, 7, 1, 0, 0},
+    {35116, 8, 1, 0, 0},
+    {35124, 8, 1, 0, 0},
+    {35132, 8, 1, 0, 0},
+    {35140, 5, 1, 0, 0},
+    {35145, 5, 1, 0, 0},
+    {31018, 5, 1, 0, 0},
+    {35150, 5, 1, 0, 0},
+    {35155, 7, 1, 0, 0},
+    {35162, 5, 1, 0, 0},
+    {27892, 5, 1, 0, 0},
+    {35167, 6, 1, 0, 0},
+    {35173, 7, 1, 0, 0},
+    {14033, 7, 1, 0, 0},
+    {35180, 6, 1, 0, 0},
+    {35186, 5, 1, 0, 0},
+    {34663, 6, 1, 0, 0},
+    {35191, 5, 1, 0, 0},
+    {35196, 8, 1, 0, 0},
+    {35204, 4, 1, 0, 0},
+    {35208, 6, 1, 0, 0},
+    {35214, 4, 1, 0, 0},
+    {35218, 8, 1, 0, 0},
+    {35226, 10, 1, 0, 0},
+    {35236, 12, 1, 0, 0},
+    {35248, 5, 1, 0, 0},
+    {35253, 6, 1, 0, 0},
+    {35259, 6, 1, 0, 0},
+    {35265, 6, 1, 0, 0},
+    {35271, 4, 1, 0, 0},
+    {35275, 5, 1, 0, 0},
+    {35280, 7, 1, 0, 0},
+    {35287, 9, 1, 0, 0},
+    {35296, 7, 1, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {35303, 5, 1, 0, 0},
+    {35308, 4, 1, 0, 0},
+    {35312, 10, 1, 0, 0},
+    {35322, 6, 1, 0, 0},
+    {35328, 4, 1, 0, 0},
+    {27121, 5, 1, 0, 0},
+    {35332, 5, 1, 0, 0},
+    {35337, 4, 1, 0, 0},
+    {29274, 7, 1, 0, 0},
+    {35341, 7, 1, 0, 0},
+    {35348, 8, 1, 0, 0},
+    {35356, 8, 1, 0, 0},
+    {35364, 9, 1, 0, 0},
+    {35373, 8, 1, 0, 0},
+    {35381, 11, 1, 0, 0},
+    {35392, 4, 1, 0, 0},
+    {35396, 5, 1, 0, 0},
+    {35401, 5, 1, 0, 0},
+    {35406, 9, 1, 0, 0},
+    {34727, 9, 1, 0, 0},
+    {35415, 8, 1, 0, 0},
+    {35423, 8, 1, 0, 0},
+    {35431, 4, 1, 0, 0},
+    {35435, 5, 1, 0, 0},
+    {26988, 3, 1, 0, 0},
+    {35440, 5, 1, 0, 0},
+    {35445, 6, 1, 0, 0},
+    {35451, 12, 1, 0, 0},
+    {35463, 6, 1, 0, 0},
+    {35469, 6, 1, 0, 0},
+    {35475, 5, 1, 0, 0},
+    {35480, 8, 1, 0, 0},
+    {35488, 6, 1, 0, 0},
+    {35494, 6, 1, 0, 0},
+    {27419, 6, 1, 0, 0},
+    {35500, 12, 1, 0, 0},
+    {35512, 4, 1, 0, 0},
+    {35516, 10, 1, 0, 0},
+    {35526, 8, 1, 0, 0},
+    {14058, 7, 1, 0, 0},
+    {35534, 6, 1, 0, 0},
+    {35540, 7, 1, 0, 0},
+    {35547, 5, 1, 0, 0},
+    {30602, 6, 1, 0, 0},
+    {35552, 6, 1, 0, 0},
+    {35558, 7, 1, 0, 0},
+    {35565, 4, 1, 0, 0},
+    {35569, 5, 1, 0, 0},
+    {35574, 4, 1, 0, 0},
+    {35578, 7, 1, 0, 0},
+    {35585, 8, 1, 0, 0},
+    {35593, 10, 1, 0, 0},
+    {35603, 7, 1, 0, 0},
+    {35610, 7, 1, 0, 0},
+    {35617, 7, 1, 0, 0},
+    {35624, 9, 1, 0, 0},
+    {35633, 10, 1, 0, 0},
+    {35643, 3, 1, 0, 0},
+    {35646, 5, 1, 0, 0},
+    {35651, 3, 1, 0, 0},
+    {35654, 9, 1, 0, 0},
+    {35663, 8, 1, 0, 0},
+    {35671, 7, 1, 0, 0},
+    {35678, 9, 1, 0, 0},
+    {35687, 6, 1, 0, 0},
+    {35693, 8, 1, 0, 0},
+    {35701, 5, 1, 0, 0},
+    {35706, 10, 1, 0, 0},
+    {35716, 9, 1, 0, 0},
+    {35725, 9, 1, 0, 0},
+    {28814, 7, 1, 0, 0},
+    {35734, 9, 1, 0, 0},
+    {35743, 8, 1, 0, 0},
+    {35751, 6, 1, 0, 0},
+    {35757, 8, 1, 0, 0},
+    {35765, 7, 1, 0, 0},
+    {30380, 7, 1, 0, 0},
+    {35772, 7, 1, 0, 0},
+    {14065, 8, 1, 0, 0},
+    {35779, 6, 1, 0, 0},
+    {35785, 5, 1, 0, 0},
+    {35280, 7, 1, 0, 0},
+    {35790, 8, 1, 0, 0},
+    {35798, 4, 1, 0, 0},
+    {35802, 4, 1, 0, 0},
+    {35806, 7, 1, 0, 0},
+    {35813, 7, 1, 0, 0},
+    {35820, 10, 1, 0, 0},
+    {35830, 6, 1, 0, 0},
+    {35836, 10, 1, 0, 0},
+    {35846, 7, 1, 0, 0},
+    {35853, 7, 1, 0, 0},
+    {35860, 4, 1, 0, 0},
+    {35864, 4, 1, 0, 0},
+    {35868, 6, 1, 0, 0},
+    {35874, 4, 1, 0, 0},
+    {35878, 12, 1, 0, 0},
+    {35890, 5, 1, 0, 0},
+    {35895, 9, 1, 0, 0},
+    {35904, 4, 1, 0, 0},
+    {32652, 5, 1, 0, 0},
+    {35908, 8, 1, 0, 0},
+    {35916, 5, 1, 0, 0},
+    {5060, 6, 1, 0, 0},
+    {35921, 4, 1, 0, 0},
+    {35925, 10, 1, 0, 0},
+    {35935, 6, 1, 0, 0},
+    {35941, 10, 1, 0, 0},
+    {14073, 7, 1, 0, 0},
+    {35951, 5, 1, 0, 0},
+    {35956, 5, 1, 0, 0},
+    {35961, 10, 1, 0, 0},
+    {35971, 5, 1, 0, 0},
+    {35976, 6, 1, 0, 0},
+    {32943, 4, 1, 0, 0},
+    {35982, 6, 1, 0, 0},
+    {35988, 5, 1, 0, 0},
+    {35993, 6, 1, 0, 0},
+    {35999, 12, 1, 0, 0},
+    {36011, 10, 1, 0, 0},
+    {36021, 4, 1, 0, 0},
+    {28407, 6, 1, 0, 0},
+    {27136, 7, 1, 0, 0},
+    {36025, 4, 1, 0, 0},
+    {28449, 8, 1, 0, 0},
+    {36029, 6, 1, 0, 0},
+    {36035, 9, 1, 0, 0},
+    {36044, 9, 1, 0, 0},
+    {14080, 9, 1, 0, 0},
+    {36053, 6, 1, 0, 0},
+    {36059, 6, 1, 0, 0},
+    {36065, 7, 1, 0, 0},
+    {36072, 8, 1, 0, 0},
+    {36080, 9, 1, 0, 0},
+    {34899, 7, 1, 0, 0},
+    {36089, 6, 1, 0, 0},
+    {29201, 7, 1, 0, 0},
+    {36095, 5, 1, 0, 0},
+    {27666, 4, 1, 0, 0},
+    {36100, 7, 1, 0, 0},
+    {29453, 5, 1, 0, 0},
+    {36107, 5, 1, 0, 0},
+    {36112, 7, 1, 0, 0},
+    {36119, 8, 1, 0, 0},
+    {36127, 6, 1, 0, 0},
+    {36133, 13, 1, 0, 0},
+    {36146, 15, 1, 0, 0},
+    {36161, 13, 1, 0, 0},
+    {36174, 4, 1, 0, 0},
+    {36178, 6, 1, 0, 0},
+    {36184, 8, 1, 0, 0},
+    {36192, 5, 1, 0, 0},
+    {36197, 8, 1, 0, 0},
+    {36205, 10, 1, 0, 0},
+    {32258, 4, 1, 0, 0},
+    {36215, 6, 1, 0, 0},
+    {36221, 7, 1, 0, 0},
+    {36228, 7, 1, 0, 0},
+    {36235, 9, 1, 0, 0},
+    {36244, 5, 1, 0, 0},
+    {35337, 4, 1, 0, 0},
+    {36249, 10, 1, 0, 0},
+    {36259, 9, 1, 0, 0},
+    {36268, 7, 1, 0, 0},
+    {36275, 6, 1, 0, 0},
+    {34620, 6, 1, 0, 0},
+    {36281, 6, 1, 0, 0},
+    {36287, 6, 1, 0, 0},
+    {36293, 15, 1, 0, 0},
+    {36308, 9, 1, 0, 0},
+    {33171, 6, 1, 0, 0},
+    {36317, 6, 1, 0, 0},
+    {36323, 9, 1, 0, 0},
+    {36332, 7, 1, 0, 0},
+    {36339, 3, 1, 0, 0},
+    {36342, 6, 1, 0, 0},
+    {29342, 3, 1, 0, 0},
+    {36348, 8, 1, 0, 0},
+    {36356, 7, 1, 0, 0},
+    {36363, 9, 1, 0, 0},
+    {36372, 8, 1, 0, 0},
+    {36380, 8, 1, 0, 0},
+    {36388, 6, 1, 0, 0},
+    {36394, 9, 1, 0, 0},
+    {36403, 5, 1, 0, 0},
+    {36408, 4, 1, 0, 0},
+    {36412, 7, 1, 0, 0},
+    {36419, 5, 1, 0, 0},
+    {36174, 4, 1, 0, 0},
+    {36424, 8, 1, 0, 0},
+    {36432, 4, 1, 0, 0},
+    {36436, 7, 1, 0, 0},
+    {36443, 6, 1, 0, 0},
+    {36449, 5, 1, 0, 0},
+    {32864, 8, 1, 0, 0},
+    {36454, 11, 1, 0, 0},
+    {14089, 7, 1, 0, 0},
+    {28244, 6, 1, 0, 0},
+    {36465, 4, 1, 0, 0},
+    {36469, 6, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {29453, 5, 1, 0, 0},
+    {36475, 9, 1, 0, 0},
+    {36484, 9, 1, 0, 0},
+    {36493, 4, 1, 0, 0},
+    {36497, 5, 1, 0, 0},
+    {36502, 5, 1, 0, 0},
+    {36507, 6, 1, 0, 0},
+    {36513, 8, 1, 0, 0},
+    {36521, 6, 1, 0, 0},
+    {36527, 11, 1, 0, 0},
+    {36538, 10, 1, 0, 0},
+    {36548, 5, 1, 0, 0},
+    {36553, 6, 1, 0, 0},
+    {36559, 5, 1, 0, 0},
+    {36564, 5, 1, 0, 0},
+    {36569, 7, 1, 0, 0},
+    {27947, 8, 1, 0, 0},
+    {36576, 4, 1, 0, 0},
+    {36580, 6, 1, 0, 0},
+    {14096, 6, 1, 0, 0},
+    {36586, 7, 1, 0, 0},
+    {36593, 4, 1, 0, 0},
+    {28609, 6, 1, 0, 0},
+    {36597, 5, 1, 0, 0},
+    {36602, 9, 1, 0, 0},
+    {36611, 4, 1, 0, 0},
+    {36615, 9, 1, 0, 0},
+    {29802, 6, 1, 0, 0},
+    {36624, 8, 1, 0, 0},
+    {36502, 5, 1, 0, 0},
+    {36632, 5, 1, 0, 0},
+    {35993, 6, 1, 0, 0},
+    {36637, 9, 1, 0, 0},
+    {33544, 9, 1, 0, 0},
+    {36646, 6, 1, 0, 0},
+    {36652, 8, 1, 0, 0},
+    {36660, 8, 1, 0, 0},
+    {36668, 4, 1, 0, 0},
+    {36672, 4, 1, 0, 0},
+    {36676, 8, 1, 0, 0},
+    {36684, 8, 1, 0, 0},
+    {36692, 9, 1, 0, 0},
+    {27130, 6, 1, 0, 0},
+    {27419, 6, 1, 0, 0},
+    {36701, 13, 1, 0, 0},
+    {28526, 6, 1, 0, 0},
+    {36714, 9, 1, 0, 0},
+    {36723, 5, 1, 0, 0},
+    {32373, 6, 1, 0, 0},
+    {14102, 8, 1, 0, 0},
+    {36728, 5, 1, 0, 0},
+    {36733, 4, 1, 0, 0},
+    {27643, 5, 1, 0, 0},
+    {36737, 8, 1, 0, 0},
+    {36745, 9, 1, 0, 0},
+    {36754, 4, 1, 0, 0},
+    {31184, 6, 1, 0, 0},
+    {36758, 10, 1, 0, 0},
+    {28753, 8, 1, 0, 0},
+    {30712, 9, 1, 0, 0},
+    {36768, 10, 1, 0, 0},
+    {36778, 6, 1, 0, 0},
+    {36784, 8, 1, 0, 0},
+    {36792, 5, 1, 0, 0},
+    {36797, 8, 1, 0, 0},
+    {36805, 5, 1, 0, 0},
+    {36810, 9, 1, 0, 0},
+    {36819, 9, 1, 0, 0},
+    {36828, 2, 1, 0, 0},
+    {32175, 5, 1, 0, 0},
+    {36830, 6, 1, 0, 0},
+    {36836, 7, 1, 0, 0},
+    {36843, 5, 1, 0, 0},
+    {36848, 6, 1, 0, 0},
+    {36854, 8, 1, 0, 0},
+    {33632, 6, 1, 0, 0},
+    {36862, 9, 1, 0, 0},
+    {28545, 6, 1, 0, 0},
+    {36871, 8, 1, 0, 0},
+    {36879, 5, 1, 0, 0},
+    {36884, 6, 1, 0, 0},
+    {36890, 8, 1, 0, 0},
+    {14619, 8, 1, 0, 0},
+    {36898, 8, 1, 0, 0},
+    {36906, 8, 1, 0, 0},
+    {36914, 4, 1, 0, 0},
+    {36918, 3, 1, 0, 0},
+    {36921, 4, 1, 0, 0},
+    {36925, 6, 1, 0, 0},
+    {36931, 4, 1, 0, 0},
+    {36935, 7, 1, 0, 0},
+    {36942, 9, 1, 0, 0},
+    {36951, 5, 1, 0, 0},
+    {36956, 6, 1, 0, 0},
+    {36342, 6, 1, 0, 0},
+    {36962, 11, 1, 0, 0},
+    {36973, 6, 1, 0, 0},
+    {36979, 6, 1, 0, 0},
+    {36985, 8, 1, 0, 0},
+    {5906, 6, 1, 0, 0},
+    {36993, 3, 1, 0, 0},
+    {36996, 3, 1, 0, 0},
+    {27666, 4, 1, 0, 0},
+    {36999, 5, 1, 0, 0},
+    {37004, 7, 1, 0, 0},
+    {35585, 8, 1, 0, 0},
+    {37011, 15, 1, 0, 0},
+    {37026, 11, 1, 0, 0},
+    {37037, 8, 1, 0, 0},
+    {29844, 6, 1, 0, 0},
+    {37045, 14, 1, 0, 0},
+    {37059, 3, 1, 0, 0},
+    {37062, 4, 1, 0, 0},
+    {37066, 5, 1, 0, 0},
+    {37071, 6, 1, 0, 0},
+    {37077, 11, 1, 0, 0},
+    {37088, 6, 1, 0, 0},
+    {37094, 9, 1, 0, 0},
+    {36449, 5, 1, 0, 0},
+    {37103, 8, 1, 0, 0},
+    {37111, 8, 1, 0, 0},
+    {37119, 12, 1, 0, 0},
+    {37131, 6, 1, 0, 0},
+    {32017, 6, 1, 0, 0},
+    {28888, 5, 1, 0, 0},
+    {37137, 8, 1, 0, 0},
+    {37145, 5, 1, 0, 0},
+    {37150, 8, 1, 0, 0},
+    {37158, 10, 1, 0, 0},
+    {14636, 9, 1, 0, 0},
+    {1231, 4, 4, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37168, 3, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37168, 3, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37171, 2, 1, 0, 0},
+    {37173, 5, 1, 0, 0},
+    {37178, 12, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37171, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37190, 5, 1, 0, 0},
+    {37195, 5, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {781, 2, 1, 0, 0},
+    {37190, 5, 1, 0, 0},
+    {37200, 9, 1, 0, 0},
+    {37209, 12, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37173, 5, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {781, 2, 1, 0, 0},
+    {37200, 9, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37195, 5, 1, 0, 0},
+    {2652, 2, 1, 0, 0},
+    {37195, 5, 1, 0, 0},
+    {37209, 12, 1, 0, 0},
+    {37178, 12, 1, 0, 0},
+    {10803, 2, 1, 0, 0},
+    {37221, 4, 1, 0, 0},
+    {37225, 2, 1, 0, 0},
+    {3115, 2, 1, 0, 0},
+    {37227, 5, 1, 0, 0},
+    {37232, 8, 1, 0, 0},
+    {37240, 5, 1, 0, 0},
+    {37245, 3, 1, 0, 0},
+    {37248, 5, 1, 0, 0},
+    {37253, 3, 1, 0, 0},
+    {4070, 2, 1, 0, 0},
+    {37256, 4, 1, 0, 0},
+    {37260, 3, 1, 0, 0},
+    {4414, 2, 1, 0, 0},
+    {37263, 4, 1, 0, 0},
+    {37267, 3, 1, 0, 0},
+    {12208, 2, 1, 0, 0},
+    {37270, 3, 1, 0, 0},
+    {37273, 4, 1, 0, 0},
+    {37277, 3, 1, 0, 0},
+    {37280, 4, 1, 0, 0},
+    {5040, 2, 1, 0, 0},
+    {37284, 3, 1, 0, 0},
+    {37287, 3, 1, 0, 0},
+    {5418, 2, 1, 0, 0},
+    {5494, 2, 1, 0, 0},
+    {37290, 9, 1, 0, 0},
+    {6030, 2, 1, 0, 0},
+    {37299, 4, 1, 0, 0},
+    {37303, 2, 1, 0, 0},
+    {37305, 4, 1, 0, 0},
+    {37309, 4, 1, 0, 0},
+    {37313, 4, 1, 0, 0},
+    {6059, 2, 1, 0, 0},
+    {37317, 2, 1, 0, 0},
+    {37319, 3, 1, 0, 0},
+    {37322, 3, 1, 0, 0},
+    {37325, 4, 1, 0, 0},
+    {37329, 4, 1, 0, 0},
+    {37333, 4, 1, 0, 0},
+    {37337, 4, 1, 0, 0},
+    {37341, 3, 1, 0, 0},
+    {37344, 3, 1, 0, 0},
+    {37347, 4, 1, 0, 0},
+    {37351, 4, 1, 0, 0},
+    {37355, 6, 1, 0, 0},
+    {26723, 2, 1, 0, 0},
+    {2599, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 3, 7390},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {37361, 9, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {37370, 3, 1, 0, 0},
+    {37373, 3, 1, 0, 0},
+    {37376, 5, 1, 0, 0},
+    {10610, 3, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {9837, 3, 1, 0, 0},
+    {10003, 3, 1, 0, 0},
+    {37381, 9, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {1103, 2, 1, 0, 0},
+    {10166, 3, 1, 0, 0},
+    {10175, 3, 1, 0, 0},
+    {37390, 7, 1, 0, 0},
+    {37397, 4, 1, 0, 0},
+    {37401, 6, 1, 0, 0},
+    {10346, 3, 1, 0, 0},
+};
+
+#endif // ASK_PUBLIC_SUFFIX_H
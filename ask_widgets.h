@@ -0,0 +1,394 @@
+/**
+ * ASK BROWSER - Glass widgets
+ *
+ * The styled frame, button and search bar the browser chrome is built
+ * from, the theme that styles them, and the frame timer that measures
+ * how smoothly they animate.
+ */
+
+#ifndef ASK_WIDGETS_H
+#define ASK_WIDGETS_H
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QFrame>
+#include <QHash>
+#include <QLineEdit>
+#include <QPointer>
+#include <QPushButton>
+#include <QRegularExpression>
+#include <QVector>
+#include <algorithm>
+#include <vector>
+
+// ============================================================================
+// THEME
+// ============================================================================
+
+/**
+ * The colors of one look. Everything else (radii, padding, sizes) is the
+ * same in every theme and lives in the stylesheet template below.
+ */
+struct ThemePalette {
+    const char *name;
+    const char *base;          // Window gradient ends, tab pane, dialogs
+    const char *baseMid;       // Window gradient middle
+    const char *panel;         // Sidebar, tooltips, popups, tables
+    const char *frame;         // Glass frames (top bar, status bar)
+    const char *control;       // Buttons, fields and tabs at rest
+    const char *controlHover;
+    const char *border;
+    const char *accent;
+    const char *accentTint;    // Sidebar hover, workspace badge
+    const char *accentSoft;    // Hover, selected tab, popup selection
+    const char *accentStrong;  // Pressed
+    const char *text;
+    const char *textSoft;      // Sidebar buttons, inactive tabs
+    const char *textMuted;     // Status text
+    const char *textFaint;     // Resource readout
+    const char *success;
+    const char *danger;        // Close button hover
+};
+
+// Every color is a $name from ThemePalette
+static const char themeSheetTemplate[] = R"(
+    QMainWindow {
+        background: qlineargradient(x1:0, y1:0, x2:1, y2:1,
+                                    stop:0 $base, stop:0.5 $baseMid, stop:1 $base);
+    }
+    QToolTip {
+        background: $panel;
+        color: $text;
+        border: 1px solid $accent;
+        border-radius: 6px;
+        padding: 8px;
+        font-size: 12px;
+    }
+    
+    QFrame[glass="frame"] {
+        background: $frame;
+        border: 1px solid $border;
+        border-radius: 12px;
+    }
+    QPushButton[glass="button"] {
+        background: $control;
+        border: 1px solid $border;
+        border-radius: 8px;
+        color: $text;
+        padding: 10px 20px;
+        font-weight: 600;
+        font-size: 14px;
+    }
+    QPushButton[glass="button"]:hover {
+        background: $accentSoft;
+        border-color: $accent;
+    }
+    QPushButton[glass="button"]:pressed {
+        background: $accentStrong;
+    }
+    QLineEdit[glass="search"] {
+        background: $control;
+        border: 1px solid $border;
+        border-radius: 12px;
+        color: $text;
+        padding: 12px 20px;
+        font-size: 14px;
+    }
+    QLineEdit[glass="search"]:focus {
+        background: $controlHover;
+        border-color: $accent;
+    }
+    
+    QFrame#sidebar {
+        background: $panel;
+        border: none;
+        border-right: 1px solid $border;
+    }
+    QPushButton[glass="sidebar"] {
+        background: transparent;
+        border: none;
+        color: $textSoft;
+        font-size: 24px;
+        text-align: left;
+        padding-left: 15px;
+    }
+    QPushButton[glass="sidebar"]:hover {
+        background: $accentTint;
+        color: $accent;
+        border-left: 3px solid $accent;
+    }
+    
+    QComboBox[glass="engine"] {
+        background: $control;
+        border: 1px solid $border;
+        border-radius: 8px;
+        color: $text;
+        padding: 8px 15px;
+        min-width: 120px;
+    }
+    QComboBox[glass="engine"]:hover {
+        background: $controlHover;
+    }
+    QComboBox[glass="engine"]::drop-down {
+        border: none;
+    }
+    QAbstractItemView[glass="popup"] {
+        background: $panel;
+        color: $text;
+        border: 1px solid $accent;
+        border-radius: 8px;
+        padding: 4px;
+        selection-background-color: $accentSoft;
+    }
+    
+    QTabWidget[glass="tabs"]::pane {
+        border: none;
+        background: $base;
+    }
+    QTabWidget[glass="tabs"] QTabBar::tab {
+        background: $control;
+        border: 1px solid $border;
+        border-bottom: none;
+        border-radius: 8px 8px 0 0;
+        color: $textSoft;
+        padding: 10px 20px;
+        margin-right: 5px;
+        min-width: 150px;
+    }
+    QTabWidget[glass="tabs"] QTabBar::tab:selected {
+        background: $accentSoft;
+        color: $text;
+        border-bottom: 2px solid $accent;
+    }
+    QTabWidget[glass="tabs"] QTabBar::tab:hover {
+        background: $controlHover;
+    }
+    QTabWidget[glass="tabs"] QTabBar::close-button {
+        image: url(none);
+        subcontrol-position: right;
+    }
+    QTabWidget[glass="tabs"] QTabBar::close-button:hover {
+        background: $danger;
+    }
+    
+    QLabel#securityStatus {
+        color: $success;
+        font-size: 12px;
+    }
+    QLabel#workspaceBadge {
+        background: $accentTint;
+        color: $accent;
+        padding: 4px 10px;
+        border-radius: 12px;
+        font-size: 11px;
+    }
+    QLabel#trackerStatus {
+        color: $textMuted;
+        font-size: 11px;
+    }
+    QLabel#resourceStatus {
+        color: $textFaint;
+        font-size: 11px;
+    }
+    
+    QDialog#taskManager {
+        background: $base;
+    }
+    QDialog#taskManager QTableWidget {
+        background: $panel;
+        color: $text;
+        border: 1px solid $border;
+        gridline-color: $control;
+    }
+    QDialog#taskManager QHeaderView::section {
+        background: $control;
+        color: $accent;
+        border: none;
+        padding: 6px;
+    }
+)";
+
+/**
+ * Liquid Glass defined once. styleSheet() expands a palette into the one
+ * application-wide stylesheet; chrome widgets are matched by object name
+ * or by their "glass" role property instead of carrying QSS of their own,
+ * so another button or tab costs a selector match, not a parse and a
+ * fresh cascade. Sheets are built once per theme and switching replaces
+ * the application's sheet, which repolishes every widget exactly once.
+ * QSS has no box-shadow, so focus and hover are shown by border color.
+ */
+class Theme {
+public:
+    static const std::vector<ThemePalette> &palettes() {
+        static const std::vector<ThemePalette> list = {
+            {"Liquid Glass", "#0a0a1f", "#1a0a2e", "rgba(15, 15, 35, 0.95)", "rgba(15, 15, 35, 0.85)",
+             "rgba(255, 255, 255, 0.05)", "rgba(255, 255, 255, 0.08)", "rgba(255, 255, 255, 0.1)",
+             "#00d4ff", "rgba(0, 212, 255, 0.1)", "rgba(0, 212, 255, 0.2)", "rgba(0, 212, 255, 0.3)",
+             "white", "rgba(255, 255, 255, 0.7)", "rgba(255, 255, 255, 0.6)", "rgba(255, 255, 255, 0.5)",
+             "#00ff88", "rgba(255, 0, 85, 0.3)"},
+            {"Frost", "#eef3f8", "#e1eaf6", "rgba(250, 252, 255, 0.96)", "rgba(255, 255, 255, 0.85)",
+             "rgba(10, 20, 40, 0.05)", "rgba(10, 20, 40, 0.08)", "rgba(10, 20, 40, 0.12)",
+             "#0077cc", "rgba(0, 119, 204, 0.1)", "rgba(0, 119, 204, 0.2)", "rgba(0, 119, 204, 0.3)",
+             "#101828", "rgba(16, 24, 40, 0.75)", "rgba(16, 24, 40, 0.6)", "rgba(16, 24, 40, 0.5)",
+             "#0a8f55", "rgba(220, 0, 70, 0.25)"}
+        };
+        return list;
+    }
+    
+    static const ThemePalette *find(const QString &name) {
+        for (const ThemePalette &palette : palettes()) {
+            if (name == QLatin1String(palette.name)) return &palette;
+        }
+        return nullptr;
+    }
+    
+    // The theme after `name`, wrapping around
+    static QString next(const QString &name) {
+        const std::vector<ThemePalette> &list = palettes();
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (name == QLatin1String(list[i].name)) return list[(i + 1) % list.size()].name;
+        }
+        return list.front().name;
+    }
+    
+    static QString styleSheet(const ThemePalette &palette) {
+        const QHash<QString, QString> colors = {
+            {"base", palette.base}, {"baseMid", palette.baseMid}, {"panel", palette.panel},
+            {"frame", palette.frame}, {"control", palette.control}, {"controlHover", palette.controlHover},
+            {"border", palette.border}, {"accent", palette.accent}, {"accentTint", palette.accentTint},
+            {"accentSoft", palette.accentSoft}, {"accentStrong", palette.accentStrong},
+            {"text", palette.text}, {"textSoft", palette.textSoft}, {"textMuted", palette.textMuted},
+            {"textFaint", palette.textFaint}, {"success", palette.success}, {"danger", palette.danger}
+        };
+        
+        static const QRegularExpression token("\\$(\\w+)");
+        const QString source = QString::fromUtf8(themeSheetTemplate);
+        QString sheet;
+        sheet.reserve(source.size() + source.size() / 4);
+        int last = 0;
+        for (auto it = token.globalMatch(source); it.hasNext();) {
+            const QRegularExpressionMatch match = it.next();
+            sheet += source.midRef(last, match.capturedStart() - last);
+            sheet += colors.value(match.captured(1));
+            last = match.capturedEnd();
+        }
+        sheet += source.midRef(last);
+        return sheet;
+    }
+    
+    // Unknown names fall back to the first theme; returns the one applied
+    static QString apply(const QString &name) {
+        const ThemePalette *palette = find(name);
+        if (!palette) palette = &palettes().front();
+        
+        static QHash<QString, QString> built;
+        auto sheet = built.find(palette->name);
+        if (sheet == built.end()) {
+            sheet = built.insert(palette->name, styleSheet(*palette));
+        }
+        qApp->setStyleSheet(sheet.value());
+        return palette->name;
+    }
+};
+
+// ============================================================================
+// CUSTOM STYLED WIDGETS
+// ============================================================================
+
+// Styled by the application stylesheet through their "glass" role; see Theme
+
+class GlassFrame : public QFrame {
+public:
+    GlassFrame(QWidget *parent = nullptr) : QFrame(parent) {
+        setProperty("glass", "frame");
+    }
+};
+
+class GlassButton : public QPushButton {
+public:
+    GlassButton(const QString &text, QWidget *parent = nullptr) : QPushButton(text, parent) {
+        setProperty("glass", "button");
+        setCursor(Qt::PointingHandCursor);
+    }
+};
+
+class GlassSearchBar : public QLineEdit {
+public:
+    GlassSearchBar(QWidget *parent = nullptr) : QLineEdit(parent) {
+        setProperty("glass", "search");
+        setPlaceholderText("🔍 Search or enter URL...");
+    }
+};
+
+// ============================================================================
+// FRAME TIMING
+// ============================================================================
+
+/**
+ * Measures how smoothly a widget animates: the interval between the
+ * paint events it gets while the timer runs. At 60 Hz a frame is due
+ * every 16.7 ms; an interval past one and a half of those means at least
+ * one frame was missed.
+ */
+class FrameTimer : public QObject {
+public:
+    struct Summary {
+        int frames = 0;
+        double fps = 0;
+        double p50Ms = 0;
+        double p95Ms = 0;
+        double maxMs = 0;
+        int missed = 0;     // Intervals over 25 ms
+    };
+    
+    explicit FrameTimer(QObject *parent = nullptr) : QObject(parent) {}
+    
+    void start(QWidget *target) {
+        stop();
+        widget = target;
+        intervals.clear();
+        lastFrameUs = -1;
+        clock.start();
+        widget->installEventFilter(this);
+    }
+    
+    Summary stop() {
+        if (widget) widget->removeEventFilter(this);
+        widget = nullptr;
+        
+        Summary summary;
+        if (intervals.isEmpty()) return summary;
+        QVector<qint64> sorted = intervals;
+        std::sort(sorted.begin(), sorted.end());
+        qint64 totalUs = 0;
+        for (qint64 interval : sorted) {
+            totalUs += interval;
+            if (interval > 25000) ++summary.missed;
+        }
+        summary.frames = sorted.size() + 1;
+        summary.fps = totalUs > 0 ? sorted.size() * 1e6 / totalUs : 0;
+        summary.p50Ms = sorted[sorted.size() / 2] / 1000.0;
+        summary.p95Ms = sorted[qMin(sorted.size() - 1, sorted.size() * 95 / 100)] / 1000.0;
+        summary.maxMs = sorted.last() / 1000.0;
+        return summary;
+    }
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override {
+        if (watched == widget && event->type() == QEvent::Paint) {
+            const qint64 now = clock.nsecsElapsed() / 1000;
+            if (lastFrameUs >= 0) intervals.append(now - lastFrameUs);
+            lastFrameUs = now;
+        }
+        return false;
+    }
+
+private:
+    QPointer<QWidget> widget;
+    QElapsedTimer clock;
+    qint64 lastFrameUs = -1;
+    QVector<qint64> intervals;
+};
+
+#endif // ASK_WIDGETS_H
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""
+Compile the ICANN section of the Public Suffix List into ask_public_suffix.h.
+
+The browser never parses the list at runtime; it walks the node table this
+script emits. Regenerate after updating the list:
+
+    python3 tools/generate_public_suffix.py public_suffix_list.dat > ask_public_suffix.h
+
+Labels are stored lowercase in ASCII (IDN labels as punycode). Each node's
+children are contiguous and sorted bytewise, so lookup is a binary search
+per label, right to left.
+"""
+
+import sys
+
+RULE, WILDCARD, EXCEPTION = 1, 2, 4
+
+
+class Node:
+    def __init__(self):
+        self.children = {}
+        self.flags = 0
+
+
+def ace(label):
+    if label.isascii():
+        return label.lower().encode()
+    return b"xn--" + label.lower().encode("punycode")
+
+
+def parse(path):
+    root = Node()
+    in_icann = False
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if "===BEGIN ICANN DOMAINS===" in line:
+                in_icann = True
+            elif "===END ICANN DOMAINS===" in line:
+                break
+            if not in_icann or not line or line.startswith("//"):
+                continue
+            rule = line.split()[0]
+            flag = RULE
+            if rule.startswith("!"):
+                flag, rule = EXCEPTION, rule[1:]
+            labels = rule.split(".")
+            if labels[0] == "*":
+                flag, labels = WILDCARD, labels[1:]
+            node = root
+            for label in reversed(labels):
+                node = node.children.setdefault(ace(label), Node())
+            node.flags |= flag
+    return root
+
+
+def main():
+    root = parse(sys.argv[1])
+
+    # Breadth-first, so every node's children sit in one contiguous run
+    nodes = [(b"", root)]
+    labels = bytearray()
+    offsets = {}
+    rows = []
+    i = 0
+    while i < len(nodes):
+        label, node = nodes[i]
+        first = len(nodes)
+        children = sorted(node.children.items())
+        nodes.extend(children)
+        if label not in offsets:
+            offsets[label] = len(labels)
+            labels += label
+        rows.append((offsets[label], len(label), first if children else 0, len(children), node.flags))
+        i += 1
+
+    assert len(nodes) < 65536 and len(labels) < 2 ** 32
+
+    out = sys.stdout
+    out.write("// Generated by tools/generate_public_suffix.py from the ICANN section of the\n")
+    out.write("// Public Suffix List (https://publicsuffix.org/list/). Do not edit.\n")
+    out.write("//\n")
+    out.write("// The list is subject to the terms of the Mozilla Public License, v. 2.0.\n")
+    out.write("// If a copy of the MPL was not distributed with this file, you can obtain\n")
+    out.write("// one at https://mozilla.org/MPL/2.0/.\n\n")
+    out.write("#ifndef ASK_PUBLIC_SUFFIX_H\n#define ASK_PUBLIC_SUFFIX_H\n\n")
+    out.write("#include <cstdint>\n\n")
+    out.write("struct PublicSuffixNode {\n")
+    out.write("    enum Flag : std::uint8_t { Rule = 1, Wildcard = 2, Exception = 4 };\n")
+    out.write("    std::uint32_t labelOffset;\n")
+    out.write("    std::uint8_t labelLength;\n")
+    out.write("    std::uint8_t flags;\n")
+    out.write("    std::uint16_t childCount;\n")
+    out.write("    std::uint16_t firstChild;\n")
+    out.write("};\n\n")
+    out.write("static constexpr char publicSuffixLabels[] =\n")
+    text = labels.decode("ascii")
+    for start in range(0, len(text), 96):
+        out.write('    "%s"\n' % text[start:start + 96])
+    out.write("    ;\n\n")
+    out.write("// Node 0 is the root\n")
+    out.write("static constexpr PublicSuffixNode publicSuffixNodes[] = {\n")
+    for offset, length, first, count, flags in rows:
+        out.write("    {%d, %d, %d, %d, %d},\n" % (offset, length, flags, count, first))
+    out.write("};\n\n")
+    out.write("#endif // ASK_PUBLIC_SUFFIX_H\n")
+
+
+if __name__ == "__main__":
+    main()